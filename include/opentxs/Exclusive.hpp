@@ -41,11 +41,14 @@ public:
     OPENTXS_EXPORT C& get();
     OPENTXS_EXPORT bool Release();
 
+    /** The optional pin is released only after the lock, so the owner of the
+     *  mutex can use it to decide when the object may be destroyed */
     OPENTXS_EXPORT Exclusive(
         Container* in,
         std::shared_mutex& lock,
         Save save,
-        const Callback callback = nullptr) noexcept;
+        const Callback callback = nullptr,
+        std::shared_ptr<void> pin = nullptr) noexcept;
     OPENTXS_EXPORT Exclusive() noexcept;
     Exclusive(const Exclusive&) = delete;
     OPENTXS_EXPORT Exclusive(Exclusive&&) noexcept;
@@ -60,6 +63,7 @@ private:
     Save save_{[](Container&, eLock&, bool) -> void {}};
     std::atomic<bool> success_{true};
     Callback callback_{nullptr};
+    std::shared_ptr<void> pin_{nullptr};
 };  // class Exclusive
 }  // namespace opentxs
 #endif
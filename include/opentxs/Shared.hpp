@@ -11,6 +11,7 @@
 #include <memory>
 #include <shared_mutex>
 #include <stdexcept>
+#include <utility>
 
 #ifdef SWIG
 %ignore opentxs::Shared::Shared(Shared&&);
@@ -43,19 +44,28 @@ public:
 
         p_ = nullptr;
         lock_.reset(nullptr);
+        pin_.reset();
 
         return true;
     }
 
-    OPENTXS_EXPORT Shared(const C* in, std::shared_mutex& lock) noexcept
+    /** The optional pin is held by every copy of this handle and is released
+     *  only after the lock, so the owner of the mutex can use it to decide
+     *  when the object may be destroyed */
+    OPENTXS_EXPORT Shared(
+        const C* in,
+        std::shared_mutex& lock,
+        std::shared_ptr<void> pin = nullptr) noexcept
         : p_(in)
         , lock_(new sLock(lock))
+        , pin_(pin)
     {
         assert(lock_);
     }
     OPENTXS_EXPORT Shared() noexcept
         : p_(nullptr)
         , lock_(nullptr)
+        , pin_(nullptr)
     {
     }
 
@@ -64,11 +74,13 @@ public:
         , lock_(
               (nullptr != rhs.lock_->mutex()) ? new sLock(*rhs.lock_->mutex())
                                               : nullptr)
+        , pin_(rhs.pin_)
     {
     }
     OPENTXS_EXPORT Shared(Shared&& rhs) noexcept
         : p_(rhs.p_)
         , lock_(rhs.lock_.release())
+        , pin_(std::move(rhs.pin_))
     {
         rhs.p_ = nullptr;
     }
@@ -82,6 +94,8 @@ public:
             lock_.reset(nullptr);
         }
 
+        pin_ = rhs.pin_;
+
         return *this;
     }
     OPENTXS_EXPORT Shared& operator=(Shared&& rhs) noexcept
@@ -89,6 +103,7 @@ public:
         p_ = rhs.p_;
         rhs.p_ = nullptr;
         lock_.reset(rhs.lock_.release());
+        pin_ = std::move(rhs.pin_);
 
         return *this;
     }
@@ -98,6 +113,7 @@ public:
 private:
     const C* p_{nullptr};
     std::unique_ptr<sLock> lock_{nullptr};
+    std::shared_ptr<void> pin_{nullptr};
 
 };  // class Shared
 }  // namespace opentxs
@@ -181,6 +181,26 @@ public:
     OPENTXS_EXPORT virtual std::shared_ptr<proto::StorageThread> Thread(
         const identifier::Nym& nymID,
         const Identifier& threadID) const = 0;
+    /**   Load part of a thread without reading the remaining segments
+     *
+     *    \param[in] nymID the identifier of the nym who owns the thread
+     *    \param[in] threadID the thread to load
+     *    \param[in] firstSegment the first segment to load
+     *    \param[in] segments the number of segments to load
+     */
+    OPENTXS_EXPORT virtual std::shared_ptr<proto::StorageThread> Thread(
+        const identifier::Nym& nymID,
+        const Identifier& threadID,
+        const std::size_t firstSegment,
+        const std::size_t segments) const = 0;
+    /**   Return the number of segments in which a thread is stored
+     *
+     *    \param[in] nymID the identifier of the nym who owns the thread
+     *    \param[in] threadID the thread to check
+     */
+    OPENTXS_EXPORT virtual std::size_t ThreadSegments(
+        const identifier::Nym& nymID,
+        const Identifier& threadID) const = 0;
     /**   Obtain a list of thread ids for the specified nym
      *
      *    \param[in] nym the identifier of the nym
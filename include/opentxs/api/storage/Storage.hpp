@@ -20,9 +20,11 @@
 #include <cstdint>
 #include <ctime>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace opentxs
 {
@@ -109,6 +111,12 @@ public:
         const identifier::UnitDefinition& unit,
         const std::uint64_t series,
         const std::string& key) const = 0;
+    /** Returns true if any of the keys, grouped by mint series, is spent */
+    OPENTXS_EXPORT virtual bool CheckTokenSpent(
+        const identifier::Server& notary,
+        const identifier::UnitDefinition& unit,
+        const std::map<std::uint64_t, std::vector<std::string>>& keys)
+        const = 0;
 #endif
     OPENTXS_EXPORT virtual std::string ContactAlias(
         const std::string& id) const = 0;
@@ -241,6 +249,14 @@ public:
         const std::string& nymId,
         const std::string& threadId,
         std::shared_ptr<proto::StorageThread>& thread) const = 0;
+    /// Loads only the items stored in segments [firstSegment, firstSegment +
+    /// segments) of the thread
+    OPENTXS_EXPORT virtual bool Load(
+        const std::string& nymId,
+        const std::string& threadId,
+        const std::size_t firstSegment,
+        const std::size_t segments,
+        std::shared_ptr<proto::StorageThread>& thread) const = 0;
     OPENTXS_EXPORT virtual bool Load(
         std::shared_ptr<proto::Ciphertext>& output,
         const bool checking = false) const = 0;
@@ -271,6 +287,13 @@ public:
         const identifier::UnitDefinition& unit,
         const std::uint64_t series,
         const std::string& key) const = 0;
+    /** Records every key, grouped by mint series, or none of them if any
+     *  key is already spent or repeated */
+    OPENTXS_EXPORT virtual bool MarkTokenSpent(
+        const identifier::Server& notary,
+        const identifier::UnitDefinition& unit,
+        const std::map<std::uint64_t, std::vector<std::string>>& keys)
+        const = 0;
 #endif
     OPENTXS_EXPORT virtual bool MoveThreadItem(
         const std::string& nymId,
@@ -434,6 +457,9 @@ public:
     OPENTXS_EXPORT virtual std::string ThreadAlias(
         const std::string& nymID,
         const std::string& threadID) const = 0;
+    OPENTXS_EXPORT virtual std::size_t ThreadSegments(
+        const std::string& nymID,
+        const std::string& threadID) const = 0;
     OPENTXS_EXPORT virtual std::string UnitDefinitionAlias(
         const std::string& id) const = 0;
     OPENTXS_EXPORT virtual ObjectList UnitDefinitionList() const = 0;
@@ -80,6 +80,12 @@ public:
         const String& strInput,
         std::string str_bookend = "-----BEGIN");
 
+    /** zlib level used by SetString. 0 stores the data without deflating it,
+     * which is much cheaper and still readable by every peer, since the
+     * result is an ordinary zlib stream. -1 selects the zlib default. */
+    OPENTXS_EXPORT static std::int32_t CompressionLevel();
+    OPENTXS_EXPORT static void SetCompressionLevel(const std::int32_t level);
+
     OPENTXS_EXPORT virtual bool GetData(Data& theData, bool bLineBreaks = true)
         const = 0;
     OPENTXS_EXPORT virtual bool GetString(
@@ -122,6 +122,9 @@ public:
     // it.
     //
     OPENTXS_EXPORT bool VerifyAccount(const identity::Nym& theNym) override;
+    // Verifies the box without loading its box receipts. Use LoadBoxReceipt
+    // to fetch any receipt whose full version is needed.
+    OPENTXS_EXPORT bool VerifyAbbreviated(const identity::Nym& theNym);
     // For ALL abbreviated transactions, load the actual box receipt for each.
     OPENTXS_EXPORT bool LoadBoxReceipts(
         std::set<std::int64_t>* psetUnloaded = nullptr);  // if psetUnloaded
@@ -229,6 +232,10 @@ protected:
         const String& pString = String::Factory());
     // return -1 if error, 0 if nothing, and 1 if the node was processed.
     std::int32_t ProcessXMLNode(irr::io::IrrXMLReader*& xml) override;
+    // Always writes the "OT LEDGER 1" format, even when the box was loaded
+    // from the legacy armored format. This is a one way storage upgrade:
+    // once a box has been saved, binaries older than this format can no
+    // longer read it.
     bool SaveGeneric(ledgerType theType);
     void UpdateContents(const PasswordPrompt& reason)
         override;  // Before transmission or
@@ -246,6 +253,7 @@ private:  // Private prevents erroneous use by other classes.
     std::tuple<bool, std::string, std::string, std::string> make_filename(
         const ledgerType theType);
 
+    bool load_raw(const char* raw);
     bool generate_ledger(
         const identifier::Nym& theNymID,
         const Identifier& theAcctID,
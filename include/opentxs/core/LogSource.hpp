@@ -90,17 +90,16 @@ public:
     OPENTXS_EXPORT ~LogSource() = default;
 
 private:
-    using Source = std::pair<OTZMQPushSocket, std::stringstream>;
+    class Buffer;
 
     static std::atomic<int> verbosity_;
     static std::atomic<bool> running_;
-    static std::mutex buffer_lock_;
-    static std::map<std::thread::id, Source> buffer_;
 
     const int level_{-1};
 
-    static Source& get_buffer(std::string& id) noexcept;
+    static Buffer& get_buffer() noexcept;
 
+    bool active() const noexcept;
     void send(const bool terminate) const noexcept;
 
     LogSource() = delete;
@@ -12,6 +12,7 @@
 #include "opentxs/core/Contract.hpp"
 #include "opentxs/core/Log.hpp"
 
+#include <atomic>
 #include <chrono>
 
 namespace opentxs
@@ -36,6 +37,9 @@ struct Manager;
 typedef std::map<std::int64_t, std::shared_ptr<OTCronItem>> mapOfCronItems;
 /** multimapOfCronItems: Mapped to date the item was added to Cron. */
 typedef std::multimap<Time, std::shared_ptr<OTCronItem>> multimapOfCronItems;
+/** multimapOfDueItems: Transaction number mapped to the time the item is next
+ * due for processing. */
+typedef std::multimap<Time, std::int64_t> multimapOfDueItems;
 /** Mapped (uniquely) to market ID. */
 typedef std::map<std::string, std::shared_ptr<OTMarket>> mapOfMarkets;
 /** Cron stores a bunch of these on this list, which the server refreshes from
@@ -56,6 +60,15 @@ public:
         __cron_ms_between_process = lMS;
     }
 
+    static std::chrono::milliseconds GetCronMsPerSlice()
+    {
+        return __cron_ms_per_slice;
+    }
+    static void SetCronMsPerSlice(std::chrono::milliseconds lMS)
+    {
+        __cron_ms_per_slice = lMS;
+    }
+
     static std::int32_t GetCronRefillAmount() { return __trans_refill_amount; }
     static void SetCronRefillAmount(std::int32_t nAmount)
     {
@@ -94,6 +107,9 @@ public:
     mapOfCronItems::iterator FindItemOnMap(std::int64_t lTransactionNum);
     multimapOfCronItems::iterator FindItemOnMultimap(
         std::int64_t lTransactionNum);
+    /** Called by an item whose next due date changed outside of
+     * ProcessCronItems, such as a smart contract setting its timer. */
+    void RescheduleItem(const OTCronItem& item);
     // MARKETS
     bool AddMarket(
         std::shared_ptr<OTMarket> theMarket,
@@ -127,7 +143,12 @@ public:
      * transaction numbers in there must be enough to last for the entire
      * ProcessCronItems() call, and all the trades and payment plans within,
      * since it will not be replenished again at least until the call has
-     * finished.) */
+     * finished.)
+     *
+     * Only items which are due are processed, and each call returns once
+     * GetCronMsPerSlice() has elapsed. If due items remain, computeTimeout()
+     * returns zero so the caller can run another slice after letting other
+     * work proceed. */
     void ProcessCronItems();
 
     std::chrono::milliseconds computeTimeout();
@@ -170,16 +191,25 @@ private:
     static std::int32_t __trans_refill_amount;
     // Number of milliseconds (ideally) between each "Cron Process" event.
     static std::chrono::milliseconds __cron_ms_between_process;
+    // Maximum number of milliseconds spent in each call to ProcessCronItems.
+    static std::chrono::milliseconds __cron_ms_per_slice;
     // Int. The maximum number of cron items any given Nym can have
     // active at the same time.
     static std::int32_t __cron_max_items_per_nym;
-    static Time last_executed_;
 
     // A list of all valid markets.
     mapOfMarkets m_mapMarkets;
     // Cron Items are found on both lists.
     mapOfCronItems m_mapCronItems;
     multimapOfCronItems m_multimapCronItems;
+    // Items are processed in order of this list rather than by visiting every
+    // item on each round. Each item has at most one entry.
+    multimapOfDueItems m_multimapDueItems;
+    // Entry in m_multimapDueItems for each scheduled transaction number
+    std::map<std::int64_t, multimapOfDueItems::iterator> m_mapDueEntries;
+    // Time the first entry of m_multimapDueItems comes due, readable without
+    // holding the lock which protects cron
+    std::atomic<Time> m_tNextDue;
     // Always store this in any object that's associated with a specific server.
     OTServerID m_NOTARY_ID;
     // I can't put receipts in people's inboxes without a supply of these.
@@ -190,6 +220,10 @@ private:
     // I'll need this for later.
     Nym_p m_pServerNym{nullptr};
 
+    void ScheduleItem(const OTCronItem& item, const Time earliest);
+    void UnscheduleItem(const std::int64_t lTransactionNum);
+    void UpdateNextDue();
+
     explicit OTCron(const api::internal::Core& server);
 
     OTCron() = delete;
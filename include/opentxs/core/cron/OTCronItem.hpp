@@ -78,7 +78,7 @@ public:
         const PasswordPrompt& reason);
 
     inline bool IsFlaggedForRemoval() const { return m_bRemovalFlag; }
-    inline void FlagForRemoval() { m_bRemovalFlag = true; }
+    OPENTXS_EXPORT void FlagForRemoval();
     inline void SetCronPointer(OTCron& theCron) { m_pCron = &theCron; }
 
     OPENTXS_EXPORT static std::unique_ptr<OTCronItem> LoadCronReceipt(
@@ -125,6 +125,10 @@ public:
     {
         return m_PROCESS_INTERVAL;
     }
+    // Earliest time at which ProcessCron may have anything to do. OTCron
+    // schedules the item by this date. Items which only act on particular
+    // dates override it, so they are not woken on every process interval.
+    virtual Time GetNextDueDate() const;
 
     inline OTCron* GetCron() const { return m_pCron; }
     void setServerNym(Nym_p serverNym) { serverNym_ = serverNym; }
@@ -214,6 +218,12 @@ protected:
     virtual void onRemovalFromCron(const PasswordPrompt& reason) {
     }  // called by HookRemovalFromCron().
     void ClearClosingNumbers();
+    // Due date for an item whose next action happens at date, adjusted for
+    // expiry, removal and the process interval.
+    Time next_due_date(const Time date) const;
+    // Must be called when the result of GetNextDueDate changes outside of
+    // ProcessCron.
+    void reschedule() const;
 
     OTCronItem(
         const api::internal::Core& api,
@@ -214,6 +214,9 @@ public:
                                                               // which is my
                                                               // chance to
                                                               // expire, etc.
+    // The next initial or plan payment date, allowing for the retry delay
+    // after a failed payment.
+    Time GetNextDueDate() const override;
     void InitPaymentPlan();
     void Release() override;
     void Release_PaymentPlan();
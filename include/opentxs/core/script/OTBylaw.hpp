@@ -55,6 +55,8 @@ class OTBylaw
 
     OTScriptable* m_pOwnerAgreement;  // This Bylaw is owned by an agreement
                                       // (OTScriptable-derived.)
+    mutable std::string m_strDigest;  // Digest of the language and clauses.
+                                      // Empty until needed. NOT serialized.
     OTBylaw(const OTBylaw&) = delete;
     OTBylaw(OTBylaw&&) = delete;
     OTBylaw& operator=(const OTBylaw&) = delete;
@@ -110,6 +112,10 @@ public:
     OPENTXS_EXPORT bool UpdateClause(
         std::string str_Name,
         std::string str_Code);
+    // Identifies the language and clauses, so that a script engine prepared
+    // for them can be reused. Calculated once after each change to a clause.
+    const std::string& GetDigest() const;
+    void ClausesChanged() { m_strDigest.clear(); }
 
     OPENTXS_EXPORT OTVariable* GetVariable(std::string str_Name);  // not a
                                                                    // reference,
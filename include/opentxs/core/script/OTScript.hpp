@@ -110,6 +110,13 @@ public:
     // respective parties.
 
     virtual bool ExecuteScript(OTVariable* pReturnVar = nullptr);
+
+    // A script which is kept for reuse has its native calls registered once,
+    // after which Prepared() is called. Reset() then drops every party,
+    // account, and variable registered since, so that they can be registered
+    // again for the next execution.
+    virtual void Prepared() {}
+    virtual void Reset();
 };
 
 OPENTXS_EXPORT std::shared_ptr<OTScript> OTScriptFactory(
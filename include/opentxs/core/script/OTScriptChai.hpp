@@ -11,6 +11,8 @@
 #if OT_SCRIPT_CHAI
 #include "opentxs/core/script/OTScript.hpp"
 
+#include <memory>
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4702)  // warning C4702: unreachable code
@@ -41,9 +43,16 @@ public:
     ~OTScriptChai() final;
 
     bool ExecuteScript(OTVariable* pReturnVar = nullptr) final;
+    void Prepared() final;
+    void Reset() final;
     chaiscript::ChaiScript* const chai_{nullptr};
 
 private:
+    struct Baseline;
+
+    // Engine state captured by Prepared(), restored by Reset()
+    std::unique_ptr<Baseline> baseline_;
+
     OTScriptChai(const OTScriptChai&) = delete;
     OTScriptChai(OTScriptChai&&) = delete;
     OTScriptChai& operator=(const OTScriptChai&) = delete;
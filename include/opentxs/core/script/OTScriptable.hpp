@@ -13,6 +13,7 @@
 
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -355,11 +356,23 @@ protected:
                           // smart contract would normally want to log its
                           // transaction #, not just the clause name.)
 
+    // Returns an engine for the bylaw with the native calls already
+    // registered, set to run str_code. Engines are kept for reuse, so the
+    // caller only needs to register parties and variables.
+    std::shared_ptr<OTScript> LoadScript(
+        const OTBylaw& theBylaw,
+        const std::string& str_code);
+
     OTScriptable(const api::internal::Core& api);
 
 private:
     typedef Contract ot_super;
 
+    struct Scripts;
+
+    // Script engines kept for reuse by each bylaw. NOT serialized.
+    std::unique_ptr<Scripts> scripts_;
+
     static bool is_ot_namechar_invalid(char c);
 
     OTScriptable() = delete;
@@ -129,6 +129,9 @@ public:
                                                               // which is my
                                                               // chance to
                                                               // expire, etc.
+    // The timer set by the script, if any. Otherwise onProcess runs on every
+    // process interval.
+    Time GetNextDueDate() const override;
 
     bool HasTransactionNum(const std::int64_t& lInput) const override;
     void GetAllTransactionNumbers(NumList& numlistOutput) const override;
@@ -337,6 +340,7 @@ protected:
     void SetNextProcessDate(const Time tNEXT_DATE)
     {
         m_tNextProcessDate = tNEXT_DATE;
+        reschedule();
     }
     const Time GetNextProcessDate() const { return m_tNextProcessDate; }
 
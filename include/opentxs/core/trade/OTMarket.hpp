@@ -23,7 +23,10 @@
 #include "opentxs/core/OTStorage.hpp"
 #include "opentxs/Types.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <functional>
 #include <map>
 #include <string>
 
@@ -45,11 +48,15 @@ struct Core;
 #define MAX_MARKET_QUERY_DEPTH                                                 \
     50  // todo add this to the ini file. (Now that we actually have one.)
 
-// Multiple offers, mapped by price limit.
-// Using multi-map since there will be more than one offer for each single
-// price.
-// (Map would only allow a single item on the map for each price.)
-typedef std::multimap<std::int64_t, OTOffer*> mapOfOffers;
+// The offers at a single price limit, first in line at the front.
+typedef std::deque<OTOffer*> OfferQueue;
+// Bid price levels, highest price first. (Market orders are at price 0, so
+// they are last.)
+typedef std::map<std::int64_t, OfferQueue, std::greater<std::int64_t>>
+    mapOfBidLevels;
+// Ask price levels, lowest price first. (Market orders are at price 0, so
+// they are first.)
+typedef std::map<std::int64_t, OfferQueue> mapOfAskLevels;
 // The same offers are also mapped (uniquely) to transaction number.
 typedef std::map<std::int64_t, OTOffer*> mapOfOffersTrnsNum;
 
@@ -100,12 +107,18 @@ public:
         OTTrade& theTrade,
         OTOffer& theOffer,
         const PasswordPrompt& reason);
+    // Calls visitor with each offer on the other side of the market that
+    // theOffer may trade with, in the order it meets them: best price first,
+    // then first in line at each price. Stops when visitor returns false.
+    void VisitMatches(
+        OTOffer& theOffer,
+        const std::function<bool(OTOffer&)>& visitor);
 
     std::int64_t GetHighestBidPrice();
     std::int64_t GetLowestAskPrice();
 
-    mapOfOffers::size_type GetBidCount() { return m_mapBids.size(); }
-    mapOfOffers::size_type GetAskCount() { return m_mapAsks.size(); }
+    std::size_t GetBidCount() const { return m_nBidCount; }
+    std::size_t GetAskCount() const { return m_nAskCount; }
     void SetInstrumentDefinitionID(
         const identifier::UnitDefinition& INSTRUMENT_DEFINITION_ID)
     {
@@ -157,6 +170,10 @@ public:
     inline OTCron* GetCron() { return m_pCron; }
     bool LoadMarket();
     bool SaveMarket(const PasswordPrompt& reason);
+    // Saves the market and cron, which hold the offers and trades updated by
+    // a fill. ProcessTrade calls this for each fill, before it saves any of
+    // the accounts involved.
+    bool SaveFill(const PasswordPrompt& reason);
 
     void InitMarket();
 
@@ -182,8 +199,10 @@ private:
 
     OTDB::TradeListMarket* m_pTradeList{nullptr};
 
-    mapOfOffers m_mapBids;  // The buyers, ordered by price limit
-    mapOfOffers m_mapAsks;  // The sellers, ordered by price limit
+    mapOfBidLevels m_mapBids;  // The buyers, ordered by price limit
+    mapOfAskLevels m_mapAsks;  // The sellers, ordered by price limit
+    std::size_t m_nBidCount{0};
+    std::size_t m_nAskCount{0};
 
     mapOfOffersTrnsNum m_mapOffers;  // All of the offers on a single list,
                                      // ordered by transaction number.
@@ -229,6 +248,9 @@ private:
         const identifier::UnitDefinition& CURRENCY_TYPE_ID,
         const std::int64_t& lScale);
 
+    template <typename Levels>
+    static bool remove_offer(Levels& levels, const OTOffer& theOffer);
+
     void rollback_four_accounts(
         Account& p1,
         bool b1,
@@ -12,6 +12,10 @@
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Proto.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace opentxs
 {
 namespace api
@@ -27,10 +31,21 @@ namespace crypto
 class AsymmetricProvider
 {
 public:
+    struct VerifyItem {
+        const Data& plaintext_;
+        const key::Asymmetric& key_;
+        const Data& signature_;
+        const proto::HashType hash_;
+    };
+
     OPENTXS_EXPORT static proto::AsymmetricKeyType CurveToKeyType(
         const EcdsaCurve& curve);
     OPENTXS_EXPORT static EcdsaCurve KeyTypeToCurve(
         const proto::AsymmetricKeyType& type);
+    /** Number of signature verifications answered from, or missing from, the
+     * verification cache shared by all providers. */
+    OPENTXS_EXPORT static std::uint64_t VerificationCacheHits() noexcept;
+    OPENTXS_EXPORT static std::uint64_t VerificationCacheMisses() noexcept;
 
     OPENTXS_EXPORT virtual bool SeedToCurveKey(
         const ReadView seed,
@@ -67,6 +82,11 @@ public:
         const key::Asymmetric& theKey,
         const Data& signature,
         const proto::HashType hashType) const = 0;
+    /** Verifies signatures made with keys of this provider's type. Large
+     * batches are spread over a few threads. Returns the positions of the
+     * items which failed to verify. */
+    OPENTXS_EXPORT virtual std::vector<std::size_t> VerifyBatch(
+        const std::vector<VerifyItem>& items) const = 0;
     OPENTXS_EXPORT virtual bool VerifyContractSignature(
         const String& strContractToVerify,
         const key::Asymmetric& theKey,
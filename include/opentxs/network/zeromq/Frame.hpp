@@ -11,6 +11,7 @@
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Proto.hpp"
 
+#include <functional>
 #include <string>
 #include <type_traits>
 
@@ -21,6 +22,7 @@ struct zmq_msg_t;
 %ignore opentxs::network::zeromq::Frame::bytes;
 %ignore opentxs::network::zeromq::Frame::data;
 %ignore opentxs::network::zeromq::Frame::operator zmq_msg_t*;
+%ignore opentxs::network::zeromq::Frame::Release;
 %ignore opentxs::Pimpl<opentxs::network::zeromq::Frame>::Pimpl(opentxs::network::zeromq::Frame const &);
 %ignore opentxs::Pimpl<opentxs::network::zeromq::Frame>::operator opentxs::network::zeromq::Frame&;
 %ignore opentxs::Pimpl<opentxs::network::zeromq::Frame>::operator const opentxs::network::zeromq::Frame &;
@@ -42,6 +44,9 @@ namespace zeromq
 class Frame
 {
 public:
+    /// Invoked by libzmq once the last copy of a wrapped buffer is released
+    using Release = std::function<void()>;
+
     OPENTXS_EXPORT virtual operator std::string() const noexcept = 0;
 
 #ifndef SWIG
@@ -8,13 +8,17 @@
 
 #include "opentxs/Forward.hpp"
 
+#include "opentxs/Bytes.hpp"
 #include "opentxs/Proto.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
 
 #ifdef SWIG
 // clang-format off
 %ignore opentxs::Pimpl<opentxs::network::zeromq::Message>::Pimpl(opentxs::network::zeromq::Message const &);
 %ignore opentxs::Pimpl<opentxs::network::zeromq::Message>::operator opentxs::network::zeromq::Message&;
 %ignore opentxs::Pimpl<opentxs::network::zeromq::Message>::operator const opentxs::network::zeromq::Message &;
+%ignore opentxs::network::zeromq::Message::AddFrame(void*, const std::size_t, opentxs::network::zeromq::Frame::Release);
+%ignore opentxs::network::zeromq::Message::AppendBytes;
 %ignore opentxs::network::zeromq::Message::at(const std::size_t) const;
 %ignore opentxs::network::zeromq::Message::begin() const;
 %ignore opentxs::network::zeromq::Message::end() const;
@@ -83,6 +87,31 @@ public:
     OPENTXS_EXPORT virtual Frame& AddFrame(
         const void* input,
         const std::size_t size) = 0;
+    /** Appends a frame which wraps an existing buffer without copying it
+     *
+     *  The buffer must remain valid and unmodified until release is called.
+     *  Copies of the message share the buffer, so release runs only after
+     *  every copy has been destroyed or sent, possibly on a libzmq thread.
+     *
+     *  \warning Adding this pure virtual changed the vtable of Message.
+     *  Code compiled against earlier headers, including any external
+     *  Message implementation, must be rebuilt.
+     */
+    OPENTXS_EXPORT virtual Frame& AddFrame(
+        void* input,
+        const std::size_t size,
+        Frame::Release release) = 0;
+    /** Appends a frame sized by the returned allocator
+     *
+     *  The frame memory is allocated by libzmq and written in place, so
+     *  callers filling it from a socket or parser avoid an intermediate
+     *  buffer. The allocator must be invoked at most once.
+     *
+     *  \warning Adding this pure virtual changed the vtable of Message.
+     *  Code compiled against earlier headers, including any external
+     *  Message implementation, must be rebuilt.
+     */
+    OPENTXS_EXPORT virtual AllocateOutput AppendBytes() noexcept = 0;
     OPENTXS_EXPORT virtual Frame& at(const std::size_t index) = 0;
 
     OPENTXS_EXPORT virtual void EnsureDelimiter() = 0;
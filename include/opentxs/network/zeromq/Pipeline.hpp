@@ -38,6 +38,11 @@ public:
     {
         return push(Context().Message(data));
     }
+    /** Moves the frames of data into the pipeline without copying them */
+    OPENTXS_EXPORT bool Push(network::zeromq::Message& data) const noexcept
+    {
+        return push(data);
+    }
     OPENTXS_EXPORT virtual bool Start(const std::string& endpoint) const
         noexcept = 0;
 
@@ -12,6 +12,8 @@
 
 #include "opentxs/core/Log.hpp"
 
+#include <utility>
+
 namespace opentxs
 {
 template <class C>
@@ -21,6 +23,7 @@ Exclusive<C>::Exclusive() noexcept
     , save_{[](Container&, eLock&, bool) -> void {}}
     , success_{true}
     , callback_{nullptr}
+    , pin_{nullptr}
 {
 }
 
@@ -29,12 +32,14 @@ Exclusive<C>::Exclusive(
     Container* in,
     std::shared_mutex& lock,
     Save save,
-    const Callback callback) noexcept
+    const Callback callback,
+    std::shared_ptr<void> pin) noexcept
     : p_{in}
     , lock_{new eLock(lock)}
     , save_{save}
     , success_{true}
     , callback_{callback}
+    , pin_{pin}
 {
     OT_ASSERT(lock_)
 }
@@ -46,6 +51,7 @@ Exclusive<C>::Exclusive(Exclusive&& rhs) noexcept
     , save_{rhs.save_}
     , success_{rhs.success_.load()}
     , callback_{rhs.callback_}
+    , pin_{std::move(rhs.pin_)}
 {
     rhs.p_ = nullptr;
     rhs.save_ = Save{nullptr};
@@ -65,6 +71,7 @@ Exclusive<C>& Exclusive<C>::operator=(Exclusive&& rhs) noexcept
     rhs.success_.store(false);
     callback_ = std::move(rhs.callback_);
     rhs.callback_ = Callback{nullptr};
+    pin_ = std::move(rhs.pin_);
 
     return *this;
 }
@@ -138,6 +145,8 @@ template <class C>
 Exclusive<C>::~Exclusive()
 {
     Release();
+    lock_.reset();
+    pin_.reset();
 }
 }  // namespace opentxs
 #endif  // OPENTXS_EXCLUSIVE_TPP
@@ -7,6 +7,7 @@
 
 #include "opentxs/core/contract/peer/PeerReply.hpp"
 #include "opentxs/core/contract/peer/PeerRequest.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
 
 namespace opentxs
 {
@@ -1675,11 +1676,17 @@ public:
         const Flag& running);
     static network::zeromq::Context* ZMQContext();
     OPENTXS_EXPORT static auto ZMQFrame() -> network::zeromq::Frame*;
+    OPENTXS_EXPORT static auto ZMQFrame(const std::size_t size)
+        -> network::zeromq::Frame*;
     OPENTXS_EXPORT static auto ZMQFrame(
         const void* data,
         const std::size_t size) -> network::zeromq::Frame*;
     OPENTXS_EXPORT static auto ZMQFrame(const ProtobufType& data)
         -> network::zeromq::Frame*;
+    OPENTXS_EXPORT static auto ZMQFrame(
+        void* data,
+        const std::size_t size,
+        network::zeromq::Frame::Release release) -> network::zeromq::Frame*;
     OPENTXS_EXPORT static auto ZMQMessage() -> network::zeromq::Message*;
     OPENTXS_EXPORT static auto ZMQMessage(
         const void* data,
@@ -205,6 +205,7 @@ namespace internal
 {
 struct Database;
 struct GCS;
+class GCSView;
 }  // namespace internal
 
 namespace p2p
@@ -0,0 +1,188 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace opentxs::api::implementation
+{
+/** A map divided into shards which are locked independently, so that
+ *  loading an object in one shard does not block lookups in the others.
+ *
+ *  Each shard keeps its rows in least recently used order. If a bound is
+ *  set, inserting a row evicts the oldest rows which are neither pinned
+ *  nor referenced by any outstanding handle. Those rows are skipped, so a
+ *  shard may temporarily exceed its bound.
+ *
+ *  Policy provides static shard_hash(const Key&) and evictable(const Row&)
+ *  functions. The latter decides whether an unpinned row is still referenced
+ *  by a handle which does not pin it.
+ */
+template <typename Key, typename Row, typename Policy>
+class Cache
+{
+public:
+    class Shard
+    {
+    public:
+        std::mutex lock_;
+
+        /** Returns nullptr if the key is not present */
+        Row* find(const Key& key) noexcept
+        {
+            auto it = map_.find(key);
+
+            if (map_.end() == it) { return nullptr; }
+
+            auto& entry = it->second;
+            order_.splice(order_.begin(), order_, entry.position_);
+
+            return &entry.row_;
+        }
+        Row& operator[](const Key& key) noexcept(false)
+        {
+            auto [it, added] = map_.try_emplace(key);
+            auto& entry = it->second;
+
+            if (added) {
+                order_.emplace_front(key);
+                entry.position_ = order_.begin();
+                evict();
+            } else {
+                order_.splice(order_.begin(), order_, entry.position_);
+            }
+
+            return entry.row_;
+        }
+        /** Keeps the row from being evicted until the returned pointer
+         *  and all of its copies are destroyed
+         *
+         *  The shard must be locked by the caller. The pin may be
+         *  released without the shard lock.
+         */
+        std::shared_ptr<void> pin(const Key& key) noexcept(false)
+        {
+            auto& pins = map_.at(key).pins_;
+            ++pins;
+
+            return {&pins, [](std::atomic<std::size_t>* in) { --(*in); }};
+        }
+        std::size_t erase(const Key& key) noexcept
+        {
+            auto it = map_.find(key);
+
+            if (map_.end() == it) { return 0; }
+
+            order_.erase(it->second.position_);
+            map_.erase(it);
+
+            return 1;
+        }
+        template <typename Function>
+        void for_each(Function function)
+        {
+            for (auto& [key, value] : map_) { function(key, value.row_); }
+        }
+
+        Shard(const std::size_t bound) noexcept
+            : lock_()
+            , bound_(bound)
+            , map_()
+            , order_()
+        {
+        }
+
+    private:
+        using Order = std::list<Key>;
+
+        struct Entry {
+            Row row_{};
+            typename Order::iterator position_{};
+            // Pins are only added while the shard is locked, so a row
+            // which is found unpinned under the lock stays unpinned
+            std::atomic<std::size_t> pins_{0};
+        };
+
+        using Map = std::map<Key, Entry>;
+
+        const std::size_t bound_;
+        Map map_;
+        Order order_;
+
+        // The most recently used row is never a candidate, since the
+        // caller of operator[] is about to use it
+        void evict() noexcept
+        {
+            if (0 == bound_) { return; }
+
+            auto candidate = order_.end();
+
+            while ((map_.size() > bound_) &&
+                   (std::next(order_.begin()) != candidate)) {
+                --candidate;
+                auto it = map_.find(*candidate);
+
+                OT_ASSERT(map_.end() != it)
+
+                auto& entry = it->second;
+
+                if ((0 == entry.pins_) && Policy::evictable(entry.row_)) {
+                    map_.erase(it);
+                    candidate = order_.erase(candidate);
+                }
+            }
+        }
+
+        Shard() = delete;
+        Shard(const Shard&) = delete;
+        Shard(Shard&&) = delete;
+        Shard& operator=(const Shard&) = delete;
+        Shard& operator=(Shard&&) = delete;
+    };
+
+    Shard& shard(const Key& key) const noexcept
+    {
+        return *shards_.at(Policy::shard_hash(key) % shards_.size());
+    }
+    const std::vector<std::unique_ptr<Shard>>& shards() const noexcept
+    {
+        return shards_;
+    }
+
+    Cache(const std::size_t shards, const std::size_t bound) noexcept
+        : shards_()
+    {
+        OT_ASSERT(0 < shards);
+
+        // Round up so the total capacity is never less than the bound
+        const auto perShard = (bound + shards - 1) / shards;
+
+        for (std::size_t i{0}; i < shards; ++i) {
+            shards_.emplace_back(std::make_unique<Shard>(perShard));
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+    Cache() = delete;
+    Cache(const Cache&) = delete;
+    Cache(Cache&&) = delete;
+    Cache& operator=(const Cache&) = delete;
+    Cache& operator=(Cache&&) = delete;
+};
+}  // namespace opentxs::api::implementation
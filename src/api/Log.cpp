@@ -5,16 +5,13 @@
 
 #include "stdafx.hpp"
 
-#include "opentxs/core/crypto/OTPassword.hpp"
-#include "opentxs/network/zeromq/socket/Pull.hpp"
+#include "opentxs/core/LogSource.hpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
 #include "opentxs/network/zeromq/socket/Sender.tpp"
 #include "opentxs/network/zeromq/Context.hpp"
-#include "opentxs/network/zeromq/Frame.hpp"
-#include "opentxs/network/zeromq/FrameSection.hpp"
-#include "opentxs/network/zeromq/ListenCallback.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 
+#include "core/LogQueue.hpp"
 #include "internal/api/Api.hpp"
 
 #ifdef ANDROID
@@ -25,7 +22,8 @@
 
 #include "Log.hpp"
 
-#define LOG_SINK "inproc://opentxs/logsink/1"
+// Upper bound on how long the sink sleeps before checking for shutdown
+#define OT_LOG_SINK_WAIT_MILLISECONDS 250
 
 namespace zmq = opentxs::network::zeromq;
 
@@ -42,45 +40,55 @@ api::internal::Log* Factory::Log(
 namespace opentxs::api::implementation
 {
 Log::Log(const zmq::Context& zmq, const std::string& endpoint)
-    : callback_(zmq::ListenCallback::Factory(
-          std::bind(&Log::callback, this, std::placeholders::_1)))
-    , socket_(zmq.PullSocket(callback_, zmq::socket::Socket::Direction::Bind))
-    , publish_socket_(zmq.PublishSocket())
+    : publish_socket_(zmq.PublishSocket())
     , publish_{!endpoint.empty()}
+    , running_(true)
+    , thread_()
 {
-    const auto started = socket_->Start(LOG_SINK);
-
-    if (false == started) { abort(); }
-
     if (publish_) {
         const auto publishStarted = publish_socket_->Start(endpoint);
         if (false == publishStarted) { abort(); }
     }
+
+    thread_ = std::thread{&Log::run, this};
 }
 
-void Log::callback(zmq::Message& message)
+void Log::drain(const std::chrono::milliseconds& wait) noexcept
 {
-    if (message.Body().size() < 3) { return; }
-
-    int level{-1};
-    const auto& levelFrame = message.Body_at(0);
-    const auto& messageFrame = message.Body_at(1);
-    const auto& id = message.Body_at(2);
-    OTPassword::safe_memcpy(
-        &level, sizeof(level), levelFrame.data(), levelFrame.size());
+    auto& queue = internal::LogQueue::Global();
+    auto batch = queue.Take(wait);
+
+    for (auto& pRecord : batch) {
+        auto& record = *pRecord;
 #ifdef ANDROID
-    print_android(level, messageFrame, id);
+        print_android(record.level_, record.text_, record.thread_);
 #else
-    print(level, messageFrame, id);
+        print(record.level_, record.text_, record.thread_);
 #endif
 
-    if (publish_) { publish_socket_->Send(message); }
+        if (publish_) {
+            auto message = zmq::Message::Factory();
+            message->PrependEmptyFrame();
+            message->AddFrame(std::to_string(record.level_));
+            message->AddFrame(record.text_);
+            message->AddFrame(record.thread_);
+            publish_socket_->Send(message);
+        }
 
-    if (message.Body().size() >= 4) {
-        const auto& promiseFrame = message.Body_at(3);
-        auto* pPromise = promiseFrame.as<std::promise<void>*>();
+        if (nullptr != record.promise_) { record.promise_->set_value(); }
+    }
 
-        if (nullptr != pPromise) { pPromise->set_value(); }
+    const auto dropped = queue.Dropped();
+
+    if (0 < dropped) {
+        const auto text = std::to_string(dropped) +
+                          " log records dropped because the log sink fell "
+                          "behind";
+#ifdef ANDROID
+        print_android(0, text, "");
+#else
+        print(0, text, "");
+#endif
     }
 }
 
@@ -123,4 +131,22 @@ void Log::print_android(
     }
 }
 #endif
+
+void Log::run() noexcept
+{
+    const auto wait = std::chrono::milliseconds(OT_LOG_SINK_WAIT_MILLISECONDS);
+
+    while (running_.load()) { drain(wait); }
+
+    // Print anything flushed during shutdown
+    drain(std::chrono::milliseconds(0));
+}
+
+Log::~Log()
+{
+    running_.store(false);
+    internal::LogQueue::Global().Notify();
+
+    if (thread_.joinable()) { thread_.join(); }
+}
 }  // namespace opentxs::api::implementation
@@ -7,6 +7,10 @@
 
 #include "Internal.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 namespace opentxs::api::implementation
 {
 class Log : virtual public api::internal::Log
@@ -16,17 +20,17 @@ public:
         const opentxs::network::zeromq::Context& zmq,
         const std::string& endpoint);
 
-    ~Log() = default;
+    ~Log();
 
 private:
     friend api::Factory;
 
-    OTZMQListenCallback callback_;
-    OTZMQPullSocket socket_;
     OTZMQPublishSocket publish_socket_;
     const bool publish_;
+    std::atomic<bool> running_;
+    std::thread thread_;
 
-    void callback(opentxs::network::zeromq::Message& message);
+    void drain(const std::chrono::milliseconds& wait) noexcept;
     void print(
         const int level,
         const std::string& text,
@@ -37,6 +41,7 @@ private:
         const std::string& text,
         const std::string& thread);
 #endif
+    void run() noexcept;
 
     Log() = delete;
     Log(const Log&) = delete;
@@ -14,6 +14,7 @@
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
+#include "opentxs/api/Settings.hpp"
 #if OT_CASH
 #include "opentxs/blind/Purse.hpp"
 #endif
@@ -49,8 +50,10 @@
 #include "internal/core/Core.hpp"
 #include "Exclusive.tpp"
 
+#include <algorithm>
 #include <functional>
 #include <stdexcept>
+#include <string_view>
 
 #include "Wallet.hpp"
 
@@ -58,6 +61,14 @@ template class opentxs::Exclusive<opentxs::Account>;
 template class opentxs::Shared<opentxs::Account>;
 template class opentxs::Pimpl<opentxs::network::zeromq::Message>;
 
+// Zero disables the bound for that object type
+#define OT_WALLET_ACCOUNT_CACHE_SIZE 65536
+#define OT_WALLET_CACHE_SHARDS 16
+#define OT_WALLET_ISSUER_CACHE_SIZE 4096
+#define OT_WALLET_NYM_CACHE_SIZE 65536
+#define OT_WALLET_SERVER_CACHE_SIZE 1024
+#define OT_WALLET_UNIT_CACHE_SIZE 4096
+
 #define OT_METHOD "opentxs::api::implementation::Wallet::"
 
 namespace opentxs::api::implementation
@@ -91,16 +102,21 @@ Wallet::Wallet(const api::internal::Core& core)
     : api_(core)
     , context_map_()
     , context_map_lock_()
-    , account_map_()
-    , nym_map_()
-    , server_map_()
-    , unit_map_()
-    , issuer_map_()
-    , account_map_lock_()
-    , nym_map_lock_()
-    , server_map_lock_()
-    , unit_map_lock_()
-    , issuer_map_lock_()
+    , account_map_(
+          OT_WALLET_CACHE_SHARDS,
+          cache_bound(core, "account_cache_size", OT_WALLET_ACCOUNT_CACHE_SIZE))
+    , nym_map_(
+          OT_WALLET_CACHE_SHARDS,
+          cache_bound(core, "nym_cache_size", OT_WALLET_NYM_CACHE_SIZE))
+    , server_map_(
+          OT_WALLET_CACHE_SHARDS,
+          cache_bound(core, "server_cache_size", OT_WALLET_SERVER_CACHE_SIZE))
+    , unit_map_(
+          OT_WALLET_CACHE_SHARDS,
+          cache_bound(core, "unit_cache_size", OT_WALLET_UNIT_CACHE_SIZE))
+    , issuer_map_(
+          OT_WALLET_CACHE_SHARDS,
+          cache_bound(core, "issuer_cache_size", OT_WALLET_ISSUER_CACHE_SIZE))
     , peer_map_lock_()
     , peer_lock_()
     , nymfile_map_lock_()
@@ -138,9 +154,11 @@ Wallet::AccountLock& Wallet::account(
     const Identifier& account,
     const bool create) const
 {
-    OT_ASSERT(CheckLock(lock, account_map_lock_))
+    auto& shard = account_map_.shard(account);
+
+    OT_ASSERT(CheckLock(lock, shard.lock_))
 
-    auto& row = account_map_[account];
+    auto& row = shard[account];
     auto& [rowMutex, pAccount] = row;
 
     if (pAccount) {
@@ -188,7 +206,8 @@ Wallet::AccountLock& Wallet::account(
 
 SharedAccount Wallet::Account(const Identifier& accountID) const
 {
-    Lock mapLock(account_map_lock_);
+    auto& shard = account_map_.shard(accountID);
+    Lock mapLock(shard.lock_);
 
     try {
         auto& row = account(mapLock, accountID, false);
@@ -197,7 +216,10 @@ SharedAccount Wallet::Account(const Identifier& accountID) const
         auto& rowMutex = std::get<0>(row);
         auto& pAccount = std::get<1>(row);
 
-        if (pAccount) { return SharedAccount(pAccount.get(), rowMutex); }
+        if (pAccount) {
+            return SharedAccount(
+                pAccount.get(), rowMutex, shard.pin(accountID));
+        }
     } catch (...) {
 
         return {};
@@ -348,16 +370,17 @@ auto Wallet::BasketContract(
     const std::chrono::milliseconds& timeout) const noexcept(false)
     -> OTBasketContract
 {
-    UnitDefinition(id, timeout);
+    // Holding the contract keeps it from being evicted before the cast
+    const auto unit = UnitDefinition(id, timeout);
+    auto& shard = unit_map_.shard(id.str());
+    Lock mapLock(shard.lock_);
+    auto* row = shard.find(id.str());
 
-    Lock mapLock(unit_map_lock_);
-    auto it = unit_map_.find(id.str());
-
-    if (unit_map_.end() == it) {
+    if (nullptr == row) {
         throw std::runtime_error("Basket contract ID not found");
     }
 
-    auto output = std::dynamic_pointer_cast<contract::unit::Basket>(it->second);
+    auto output = std::dynamic_pointer_cast<contract::unit::Basket>(*row);
 
     if (output) {
 
@@ -367,6 +390,23 @@ auto Wallet::BasketContract(
     }
 }
 
+std::size_t Wallet::cache_bound(
+    const api::internal::Core& core,
+    const char* key,
+    const std::int64_t defaultValue)
+{
+    std::int64_t output{0};
+    bool notUsed{false};
+    core.Config().CheckSet_long(
+        String::Factory("wallet"),
+        String::Factory(key),
+        defaultValue,
+        output,
+        notUsed);
+
+    return static_cast<std::size_t>(std::max<std::int64_t>(output, 0));
+}
+
 ExclusiveAccount Wallet::CreateAccount(
     const identifier::Nym& ownerNymID,
     const identifier::Server& notaryID,
@@ -376,8 +416,6 @@ ExclusiveAccount Wallet::CreateAccount(
     TransactionNumber stash,
     const PasswordPrompt& reason) const
 {
-    Lock mapLock(account_map_lock_);
-
     try {
         const auto contract = UnitDefinition(instrumentDefinitionID);
         std::unique_ptr<opentxs::Account> newAccount(
@@ -395,6 +433,8 @@ ExclusiveAccount Wallet::CreateAccount(
         OT_ASSERT(newAccount)
 
         const auto& accountID = newAccount->GetRealAccountID();
+        auto& shard = account_map_.shard(accountID);
+        Lock mapLock(shard.lock_);
         auto& row = account(mapLock, accountID, true);
         // WTF clang? This is perfectly valid c++17. Fix your shit.
         // auto& [rowMutex, pAccount] = row;
@@ -440,7 +480,8 @@ ExclusiveAccount Wallet::CreateAccount(
                 this->save(reason, id, in, lock, success);
             };
 
-            return ExclusiveAccount(&pAccount, rowMutex, callback);
+            return ExclusiveAccount(
+                &pAccount, rowMutex, callback, nullptr, shard.pin(accountID));
         }
     } catch (...) {
 
@@ -450,7 +491,8 @@ ExclusiveAccount Wallet::CreateAccount(
 
 bool Wallet::DeleteAccount(const Identifier& accountID) const
 {
-    Lock mapLock(account_map_lock_);
+    auto& shard = account_map_.shard(accountID);
+    Lock mapLock(shard.lock_);
 
     try {
         auto& row = account(mapLock, accountID, false);
@@ -481,10 +523,11 @@ SharedAccount Wallet::IssuerAccount(
     const identifier::UnitDefinition& unitID) const
 {
     const auto accounts = api_.Storage().AccountsByContract(unitID);
-    Lock mapLock(account_map_lock_);
 
     try {
         for (const auto& accountID : accounts) {
+            auto& shard = account_map_.shard(accountID);
+            Lock mapLock(shard.lock_);
             auto& row = account(mapLock, accountID, false);
             // WTF clang? This is perfectly valid c++17. Fix your shit.
             // auto& [rowMutex, pAccount] = row;
@@ -494,7 +537,8 @@ SharedAccount Wallet::IssuerAccount(
             if (pAccount) {
                 if (pAccount->IsIssuer()) {
 
-                    return SharedAccount(pAccount.get(), rowMutex);
+                    return SharedAccount(
+                        pAccount.get(), rowMutex, shard.pin(accountID));
                 }
             }
         }
@@ -511,7 +555,8 @@ ExclusiveAccount Wallet::mutable_Account(
     const PasswordPrompt& reason,
     const AccountCallback callback) const
 {
-    Lock mapLock(account_map_lock_);
+    auto& shard = account_map_.shard(accountID);
+    Lock mapLock(shard.lock_);
 
     try {
         auto& [rowMutex, pAccount] = account(mapLock, accountID, false);
@@ -527,7 +572,8 @@ ExclusiveAccount Wallet::mutable_Account(
                 this->save(reason, id, in, lock, success);
             };
 
-            return ExclusiveAccount(&pAccount, rowMutex, save, callback);
+            return ExclusiveAccount(
+                &pAccount, rowMutex, save, callback, shard.pin(accountID));
         }
     } catch (...) {
 
@@ -553,12 +599,14 @@ bool Wallet::UpdateAccount(
     const std::string& label,
     const PasswordPrompt& reason) const
 {
-    Lock mapLock(account_map_lock_);
+    auto& shard = account_map_.shard(accountID);
+    Lock mapLock(shard.lock_);
     auto& row = account(mapLock, accountID, true);
     // WTF clang? This is perfectly valid c++17. Fix your shit.
     // auto& [rowMutex, pAccount] = row;
     auto& rowMutex = std::get<0>(row);
     auto& pAccount = std::get<1>(row);
+    const auto pin = shard.pin(accountID);
     eLock rowLock(rowMutex);
     mapLock.unlock();
     const auto& localNym = *context.Nym();
@@ -707,6 +755,21 @@ proto::ContactItemType Wallet::extract_unit(
     }
 }
 
+// Handles returned by Account(), mutable_Account() and mutable_Issuer() pin
+// their row, which the cache checks before asking here. Nym_p, NymData,
+// Issuer() and the contract wrappers hold a reference to the shared_ptr.
+bool Wallet::evictable(const AccountLock&) noexcept { return true; }
+
+bool Wallet::evictable(const NymLock& row) noexcept
+{
+    return 1 >= row.second.use_count();
+}
+
+bool Wallet::evictable(const IssuerLock& row) noexcept
+{
+    return 1 >= row.second.use_count();
+}
+
 #if OT_CASH
 std::mutex& Wallet::get_purse_lock(
     const identifier::Nym& nym,
@@ -842,7 +905,8 @@ bool Wallet::ImportAccount(std::unique_ptr<opentxs::Account>& imported) const
     }
 
     const auto& accountID = imported->GetRealAccountID();
-    Lock mapLock(account_map_lock_);
+    auto& shard = account_map_.shard(accountID);
+    Lock mapLock(shard.lock_);
 
     try {
         auto& row = account(mapLock, accountID, true);
@@ -850,6 +914,7 @@ bool Wallet::ImportAccount(std::unique_ptr<opentxs::Account>& imported) const
         // auto& [rowMutex, pAccount] = row;
         auto& rowMutex = std::get<0>(row);
         auto& pAccount = std::get<1>(row);
+        const auto pin = shard.pin(accountID);
         eLock rowLock(rowMutex);
         mapLock.unlock();
 
@@ -924,7 +989,9 @@ std::shared_ptr<const api::client::Issuer> Wallet::Issuer(
     const identifier::Nym& nymID,
     const identifier::Nym& issuerID) const
 {
-    auto& [lock, pIssuer] = issuer(nymID, issuerID, false);
+    auto& shard = issuer_map_.shard({nymID, issuerID});
+    Lock mapLock(shard.lock_);
+    auto& [lock, pIssuer] = issuer(mapLock, nymID, issuerID, false);
     const auto& notUsed [[maybe_unused]] = lock;
 
     return pIssuer;
@@ -934,12 +1001,20 @@ Editor<api::client::Issuer> Wallet::mutable_Issuer(
     const identifier::Nym& nymID,
     const identifier::Nym& issuerID) const
 {
-    auto& [lock, pIssuer] = issuer(nymID, issuerID, true);
+    auto& shard = issuer_map_.shard({nymID, issuerID});
+    Lock mapLock(shard.lock_);
+    auto& [lock, pIssuer] = issuer(mapLock, nymID, issuerID, true);
 
     OT_ASSERT(pIssuer);
 
+    // The pin keeps the row from being evicted while this thread waits for
+    // the issuer mutex without holding the shard lock, and until the editor
+    // has released the mutex
+    const auto pin = shard.pin({nymID, issuerID});
+    mapLock.unlock();
     std::function<void(api::client::Issuer*, const Lock&)> callback =
         [=](api::client::Issuer* in, const Lock& lock) -> void {
+        const auto& notUsed [[maybe_unused]] = pin;
         this->save(lock, in);
     };
 
@@ -947,12 +1022,17 @@ Editor<api::client::Issuer> Wallet::mutable_Issuer(
 }
 
 Wallet::IssuerLock& Wallet::issuer(
+    const Lock& lock,
     const identifier::Nym& nymID,
     const identifier::Nym& issuerID,
     const bool create) const
 {
-    Lock lock(issuer_map_lock_);
-    auto& output = issuer_map_[{nymID, issuerID}];
+    const auto id = IssuerID{nymID, issuerID};
+    auto& shard = issuer_map_.shard(id);
+
+    OT_ASSERT(CheckLock(lock, shard.lock_))
+
+    auto& output = shard[id];
     auto& [issuerMutex, pIssuer] = output;
     const auto& notUsed [[maybe_unused]] = issuerMutex;
 
@@ -1014,8 +1094,9 @@ Nym_p Wallet::Nym(
     const std::chrono::milliseconds& timeout) const
 {
     const std::string nym = id.str();
-    Lock mapLock(nym_map_lock_);
-    bool inMap = (nym_map_.find(nym) != nym_map_.end());
+    auto& shard = nym_map_.shard(nym);
+    Lock mapLock(shard.lock_);
+    bool inMap = (nullptr != shard.find(nym));
     bool valid = false;
 
     if (!inMap) {
@@ -1027,14 +1108,14 @@ Nym_p Wallet::Nym(
             OT_ASSERT(pSerialized)
 
             const auto& serialized = *pSerialized;
-            auto& pNym = nym_map_[nym].second;
+            auto& pNym = shard[nym].second;
             pNym.reset(opentxs::Factory::Nym(api_, serialized, alias));
 
             if (pNym && pNym->CompareID(id)) {
                 valid = pNym->VerifyPseudonym();
                 pNym->SetAliasStartup(alias);
             } else {
-                nym_map_.erase(nym);
+                shard.erase(nym);
             }
         } else {
             dht_nym_requester_->Send(nym);
@@ -1048,7 +1129,7 @@ Nym_p Wallet::Nym(
                 while (std::chrono::high_resolution_clock::now() < end) {
                     std::this_thread::sleep_for(interval);
                     mapLock.lock();
-                    bool found = (nym_map_.find(nym) != nym_map_.end());
+                    bool found = (nullptr != shard.find(nym));
                     mapLock.unlock();
 
                     if (found) { break; }
@@ -1059,11 +1140,11 @@ Nym_p Wallet::Nym(
             }
         }
     } else {
-        auto& pNym = nym_map_[nym].second;
+        auto& pNym = shard[nym].second;
         if (pNym) { valid = pNym->VerifyPseudonym(); }
     }
 
-    if (valid) { return nym_map_[nym].second; }
+    if (valid) { return shard[nym].second; }
 
     return nullptr;
 }
@@ -1102,8 +1183,9 @@ Nym_p Wallet::Nym(const proto::Nym& serialized) const
                 .Flush();
             candidate.WriteCredentials();
             SaveCredentialIDs(candidate);
-            Lock mapLock(nym_map_lock_);
-            auto& mapNym = nym_map_[id].second;
+            auto& shard = nym_map_.shard(id);
+            Lock mapLock(shard.lock_);
+            auto& mapNym = shard[id].second;
             // TODO update existing nym rather than destroying it
             mapNym.reset(pCandidate.release());
             nym_publisher_->Send(id);
@@ -1138,11 +1220,13 @@ Nym_p Wallet::Nym(
     if (nym.VerifyPseudonym()) {
         nym.SetAlias(name);
 
+        auto& shard = nym_map_.shard(nym.ID().str());
+
         {
-            Lock mapLock(nym_map_lock_);
-            auto it = nym_map_.find(nym.ID().str());
+            Lock mapLock(shard.lock_);
+            auto* existing = shard.find(nym.ID().str());
 
-            if (nym_map_.end() != it) { return it->second.second; }
+            if (nullptr != existing) { return existing->second; }
         }
 
         if (SaveCredentialIDs(nym)) {
@@ -1152,8 +1236,8 @@ Nym_p Wallet::Nym(
                 auto nymfile = mutable_nymfile(pNym, pNym, nym.ID(), reason);
             }
 
-            Lock mapLock(nym_map_lock_);
-            auto& pMapNym = nym_map_[nym.ID().str()].second;
+            Lock mapLock(shard.lock_);
+            auto& pMapNym = shard[nym.ID().str()].second;
             pMapNym = pNym;
 
             return std::move(pNym);
@@ -1181,18 +1265,18 @@ NymData Wallet::mutable_Nym(
             .Flush();
     }
 
-    Lock mapLock(nym_map_lock_);
-    auto it = nym_map_.find(nym);
+    auto& shard = nym_map_.shard(nym);
+    Lock mapLock(shard.lock_);
+    auto* row = shard.find(nym);
 
-    if (nym_map_.end() == it) { OT_FAIL }
+    if (nullptr == row) { OT_FAIL }
 
     std::function<void(NymData*, Lock&)> callback = [&](NymData* nymData,
                                                         Lock& lock) -> void {
         this->save(nymData, lock);
     };
 
-    return NymData(
-        api_.Factory(), it->second.first, it->second.second, callback);
+    return NymData(api_.Factory(), row->first, row->second, callback);
 }
 
 std::unique_ptr<const opentxs::NymFile> Wallet::Nymfile(
@@ -1271,30 +1355,47 @@ std::mutex& Wallet::nymfile_lock(const identifier::Nym& nymID) const
 
 Nym_p Wallet::NymByIDPartialMatch(const std::string& partialId) const
 {
-    Lock mapLock(nym_map_lock_);
-    bool inMap = (nym_map_.find(partialId) != nym_map_.end());
-    bool valid = false;
+    {
+        auto& shard = nym_map_.shard(partialId);
+        Lock mapLock(shard.lock_);
+        auto* row = shard.find(partialId);
 
-    if (!inMap) {
-        for (auto& it : nym_map_) {
-            if (it.first.compare(0, partialId.length(), partialId) == 0)
-                if (it.second.second->VerifyPseudonym())
-                    return it.second.second;
-        }
-        for (auto& it : nym_map_) {
-            if (it.second.second->Alias().compare(
-                    0, partialId.length(), partialId) == 0)
-                if (it.second.second->VerifyPseudonym())
-                    return it.second.second;
+        if (nullptr != row) {
+            auto& pNym = row->second;
+
+            if (pNym && pNym->VerifyPseudonym()) { return pNym; }
+
+            return nullptr;
         }
-    } else {
-        auto& pNym = nym_map_[partialId].second;
-        if (pNym) { valid = pNym->VerifyPseudonym(); }
     }
 
-    if (valid) { return nym_map_[partialId].second; }
+    Nym_p output{nullptr};
+    const auto search = [&](const bool alias) -> void {
+        for (const auto& pShard : nym_map_.shards()) {
+            auto& shard = *pShard;
+            Lock mapLock(shard.lock_);
+            shard.for_each([&](const std::string& id, NymLock& row) -> void {
+                if (output) { return; }
 
-    return nullptr;
+                const auto& pNym = row.second;
+
+                if (false == bool(pNym)) { return; }
+
+                const auto& name = alias ? pNym->Alias() : id;
+
+                if (name.compare(0, partialId.length(), partialId) == 0)
+                    if (pNym->VerifyPseudonym()) output = pNym;
+            });
+
+            if (output) { return; }
+        }
+    };
+
+    search(false);
+
+    if (false == bool(output)) { search(true); }
+
+    return output;
 }
 
 ObjectList Wallet::NymList() const { return api_.Storage().NymList(); }
@@ -1889,23 +1990,25 @@ Editor<blind::Purse> Wallet::mutable_Purse(
 bool Wallet::RemoveServer(const identifier::Server& id) const
 {
     std::string server(id.str());
-    Lock mapLock(server_map_lock_);
-    auto deleted = server_map_.erase(server);
-
-    if (0 != deleted) { return api_.Storage().RemoveServer(server); }
+    auto& shard = server_map_.shard(server);
+    Lock mapLock(shard.lock_);
+    shard.erase(server);
 
-    return false;
+    // The contract may have been evicted, so the cache is no indication of
+    // whether it exists
+    return api_.Storage().RemoveServer(server);
 }
 
 bool Wallet::RemoveUnitDefinition(const identifier::UnitDefinition& id) const
 {
     std::string unit(id.str());
-    Lock mapLock(unit_map_lock_);
-    auto deleted = unit_map_.erase(unit);
+    auto& shard = unit_map_.shard(unit);
+    Lock mapLock(shard.lock_);
+    shard.erase(unit);
 
-    if (0 != deleted) { return api_.Storage().RemoveUnitDefinition(unit); }
-
-    return false;
+    // The contract may have been evicted, so the cache is no indication of
+    // whether it exists
+    return api_.Storage().RemoveUnitDefinition(unit);
 }
 
 void Wallet::publish_server(const identifier::Server& id) const
@@ -2086,10 +2189,12 @@ bool Wallet::SaveCredentialIDs(const identity::Nym& nym) const
 bool Wallet::SetNymAlias(const identifier::Nym& id, const std::string& alias)
     const
 {
-    Lock mapLock(nym_map_lock_);
-    auto& nym = nym_map_[id.str()].second;
+    auto& shard = nym_map_.shard(id.str());
+    Lock mapLock(shard.lock_);
+    auto* row = shard.find(id.str());
 
-    nym->SetAlias(alias);
+    // A nym which is not in memory will pick up the alias when loaded
+    if ((nullptr != row) && row->second) { row->second->SetAlias(alias); }
 
     return api_.Storage().SetNymAlias(id.str(), alias);
 }
@@ -2099,8 +2204,9 @@ OTServerContract Wallet::Server(
     const std::chrono::milliseconds& timeout) const
 {
     const std::string server = id.str();
-    Lock mapLock(server_map_lock_);
-    bool inMap = (server_map_.find(server) != server_map_.end());
+    auto& shard = server_map_.shard(server);
+    Lock mapLock(shard.lock_);
+    bool inMap = (nullptr != shard.find(server));
     bool valid = false;
 
     if (!inMap) {
@@ -2117,7 +2223,7 @@ OTServerContract Wallet::Server(
             }
 
             if (nym) {
-                auto& pServer = server_map_[server];
+                auto& pServer = shard[server];
                 pServer =
                     opentxs::Factory::ServerContract(api_, nym, *serialized);
 
@@ -2125,7 +2231,7 @@ OTServerContract Wallet::Server(
                     valid = true;  // Factory() performs validation
                     pServer->InitAlias(alias);
                 } else {
-                    server_map_.erase(server);
+                    shard.erase(server);
                 }
             }
         } else {
@@ -2140,8 +2246,7 @@ OTServerContract Wallet::Server(
                 while (std::chrono::high_resolution_clock::now() < end) {
                     std::this_thread::sleep_for(interval);
                     mapLock.lock();
-                    bool found =
-                        (server_map_.find(server) != server_map_.end());
+                    bool found = (nullptr != shard.find(server));
                     mapLock.unlock();
 
                     if (found) { break; }
@@ -2152,11 +2257,11 @@ OTServerContract Wallet::Server(
             }
         }
     } else {
-        auto& pServer = server_map_[server];
+        auto& pServer = shard[server];
         if (pServer) { valid = pServer->Validate(); }
     }
 
-    if (valid) { return OTServerContract{server_map_[server]}; }
+    if (valid) { return OTServerContract{shard[server]}; }
 
     throw std::runtime_error("Server contract not found");
 }
@@ -2182,8 +2287,9 @@ OTServerContract Wallet::server(
     }
 
     if (api_.Storage().Store(contract->Contract(), contract->Alias())) {
-        Lock mapLock(server_map_lock_);
-        server_map_[server].reset(contract.release());
+        auto& shard = server_map_.shard(server);
+        Lock mapLock(shard.lock_);
+        shard[server].reset(contract.release());
         mapLock.unlock();
         publish_server(id);
     } else {
@@ -2229,8 +2335,9 @@ OTServerContract Wallet::Server(const proto::ServerContract& contract) const
                     candidate->Contract(), candidate->EffectiveName());
 
                 if (stored) {
-                    Lock mapLock(server_map_lock_);
-                    server_map_[server].reset(candidate.release());
+                    auto& shard = server_map_.shard(server);
+                    Lock mapLock(shard.lock_);
+                    shard[server].reset(candidate.release());
                     mapLock.unlock();
                     publish_server(serverID);
                 }
@@ -2330,6 +2437,22 @@ OTNymID Wallet::server_to_nym(Identifier& input) const
     return output;
 }
 
+std::size_t Wallet::shard_hash(const std::string& key) noexcept
+{
+    return std::hash<std::string>{}(key);
+}
+
+std::size_t Wallet::shard_hash(const Identifier& key) noexcept
+{
+    return std::hash<std::string_view>{}(std::string_view{
+        static_cast<const char*>(key.data()), key.size()});
+}
+
+std::size_t Wallet::shard_hash(const IssuerID& key) noexcept
+{
+    return shard_hash(key.first) ^ (shard_hash(key.second) << 1);
+}
+
 bool Wallet::SetServerAlias(
     const identifier::Server& id,
     const std::string& alias) const
@@ -2338,8 +2461,9 @@ bool Wallet::SetServerAlias(
     const bool saved = api_.Storage().SetServerAlias(server, alias);
 
     if (saved) {
-        Lock mapLock(server_map_lock_);
-        server_map_.erase(server);
+        auto& shard = server_map_.shard(server);
+        Lock mapLock(shard.lock_);
+        shard.erase(server);
         publish_server(id);
 
         return true;
@@ -2356,8 +2480,9 @@ bool Wallet::SetUnitDefinitionAlias(
     const bool saved = api_.Storage().SetUnitDefinitionAlias(unit, alias);
 
     if (saved) {
-        Lock mapLock(unit_map_lock_);
-        unit_map_.erase(unit);
+        auto& shard = unit_map_.shard(unit);
+        Lock mapLock(shard.lock_);
+        shard.erase(unit);
 
         return true;
     }
@@ -2375,8 +2500,9 @@ OTUnitDefinition Wallet::UnitDefinition(
     const std::chrono::milliseconds& timeout) const
 {
     const std::string unit = id.str();
-    Lock mapLock(unit_map_lock_);
-    bool inMap = (unit_map_.find(unit) != unit_map_.end());
+    auto& shard = unit_map_.shard(unit);
+    Lock mapLock(shard.lock_);
+    bool inMap = (nullptr != shard.find(unit));
     bool valid = false;
 
     if (!inMap) {
@@ -2393,7 +2519,7 @@ OTUnitDefinition Wallet::UnitDefinition(
             }
 
             if (nym) {
-                auto& pUnit = unit_map_[unit];
+                auto& pUnit = shard[unit];
                 pUnit =
                     opentxs::Factory::UnitDefinition(api_, nym, *serialized);
 
@@ -2401,7 +2527,7 @@ OTUnitDefinition Wallet::UnitDefinition(
                     valid = true;  // Factory() performs validation
                     pUnit->InitAlias(alias);
                 } else {
-                    unit_map_.erase(unit);
+                    shard.erase(unit);
                 }
             }
         } else {
@@ -2416,7 +2542,7 @@ OTUnitDefinition Wallet::UnitDefinition(
                 while (std::chrono::high_resolution_clock::now() < end) {
                     std::this_thread::sleep_for(interval);
                     mapLock.lock();
-                    bool found = (unit_map_.find(unit) != unit_map_.end());
+                    bool found = (nullptr != shard.find(unit));
                     mapLock.unlock();
 
                     if (found) { break; }
@@ -2427,11 +2553,11 @@ OTUnitDefinition Wallet::UnitDefinition(
             }
         }
     } else {
-        auto& pUnit = unit_map_[unit];
+        auto& pUnit = shard[unit];
         if (pUnit) { valid = pUnit->Validate(); }
     }
 
-    if (valid) { return OTUnitDefinition{unit_map_[unit]}; }
+    if (valid) { return OTUnitDefinition{shard[unit]}; }
 
     throw std::runtime_error("Unit definition does not exist");
 }
@@ -2444,14 +2570,9 @@ OTUnitDefinition Wallet::unit_definition(
     if (contract) {
         if (contract->Validate()) {
             if (api_.Storage().Store(contract->Contract(), contract->Alias())) {
-                Lock mapLock(unit_map_lock_);
-                auto it = unit_map_.find(unit);
-
-                if (unit_map_.end() == it) {
-                    unit_map_.emplace(unit, std::move(contract));
-                } else {
-                    it->second = std::move(contract);
-                }
+                auto& shard = unit_map_.shard(unit);
+                Lock mapLock(shard.lock_);
+                shard[unit] = std::move(contract);
 
                 mapLock.unlock();
             }
@@ -2478,14 +2599,9 @@ OTUnitDefinition Wallet::UnitDefinition(
             if (candidate->Validate()) {
                 if (api_.Storage().Store(
                         candidate->Contract(), candidate->Alias())) {
-                    Lock mapLock(unit_map_lock_);
-                    auto it = unit_map_.find(unit);
-
-                    if (unit_map_.end() == it) {
-                        unit_map_.emplace(unit, std::move(candidate));
-                    } else {
-                        it->second = std::move(candidate);
-                    }
+                    auto& shard = unit_map_.shard(unit);
+                    Lock mapLock(shard.lock_);
+                    shard[unit] = std::move(candidate);
 
                     mapLock.unlock();
                 }
@@ -17,11 +17,17 @@
 #include "opentxs/network/zeromq/socket/Request.tpp"
 #include "opentxs/network/zeromq/socket/Sender.tpp"
 
+#include "api/Cache.hpp"
 #include "internal/consensus/Consensus.hpp"
 #include "internal/identity/Identity.hpp"
 
+#include <list>
 #include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
 #include <tuple>
+#include <vector>
 
 namespace opentxs::api::implementation
 {
@@ -253,20 +259,23 @@ protected:
     Wallet(const api::internal::Core& core);
 
 private:
-    using AccountMap = std::map<OTIdentifier, AccountLock>;
+    using AccountMap = Cache<OTIdentifier, AccountLock, Wallet>;
     using NymLock =
         std::pair<std::mutex, std::shared_ptr<identity::internal::Nym>>;
-    using NymMap = std::map<std::string, NymLock>;
-    using ServerMap = std::map<std::string, std::shared_ptr<contract::Server>>;
-    using UnitMap = std::map<std::string, std::shared_ptr<contract::Unit>>;
+    using NymMap = Cache<std::string, NymLock, Wallet>;
+    using ServerMap =
+        Cache<std::string, std::shared_ptr<contract::Server>, Wallet>;
+    using UnitMap = Cache<std::string, std::shared_ptr<contract::Unit>, Wallet>;
     using IssuerID = std::pair<OTIdentifier, OTIdentifier>;
     using IssuerLock =
         std::pair<std::mutex, std::shared_ptr<api::client::Issuer>>;
-    using IssuerMap = std::map<IssuerID, IssuerLock>;
+    using IssuerMap = Cache<IssuerID, IssuerLock, Wallet>;
     using PurseID = std::tuple<OTNymID, OTServerID, OTUnitID>;
     using UnitNameMap = std::map<std::string, proto::ContactItemType>;
     using UnitNameReverse = std::map<proto::ContactItemType, std::string>;
 
+    template <typename, typename, typename>
+    friend class implementation::Cache;
     friend opentxs::Factory;
 
     static const UnitNameMap unit_of_account_;
@@ -277,11 +286,6 @@ private:
     mutable ServerMap server_map_;
     mutable UnitMap unit_map_;
     mutable IssuerMap issuer_map_;
-    mutable std::mutex account_map_lock_;
-    mutable std::mutex nym_map_lock_;
-    mutable std::mutex server_map_lock_;
-    mutable std::mutex unit_map_lock_;
-    mutable std::mutex issuer_map_lock_;
     mutable std::mutex peer_map_lock_;
     mutable std::map<std::string, std::mutex> peer_lock_;
     mutable std::mutex nymfile_map_lock_;
@@ -301,7 +305,22 @@ private:
     OTZMQRequestSocket dht_unit_requester_;
     OTZMQPushSocket find_nym_;
 
+    static std::size_t cache_bound(
+        const api::internal::Core& core,
+        const char* key,
+        const std::int64_t defaultValue);
+    static bool evictable(const AccountLock& row) noexcept;
+    static bool evictable(const NymLock& row) noexcept;
+    static bool evictable(const IssuerLock& row) noexcept;
+    template <typename T>
+    static bool evictable(const std::shared_ptr<T>& row) noexcept
+    {
+        return 1 >= row.use_count();
+    }
     static UnitNameReverse reverse_unit_map(const UnitNameMap& map);
+    static std::size_t shard_hash(const std::string& key) noexcept;
+    static std::size_t shard_hash(const Identifier& key) noexcept;
+    static std::size_t shard_hash(const IssuerID& key) noexcept;
 
     std::string account_alias(
         const std::string& accountID,
@@ -381,6 +400,7 @@ private:
         const Identifier& accountID,
         const bool create) const;
     IssuerLock& issuer(
+        const Lock& lock,
         const identifier::Nym& nymID,
         const identifier::Nym& issuerID,
         const bool create) const;
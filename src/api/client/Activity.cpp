@@ -786,6 +786,29 @@ std::shared_ptr<proto::StorageThread> Activity::Thread(
     return output;
 }
 
+std::shared_ptr<proto::StorageThread> Activity::Thread(
+    const identifier::Nym& nymID,
+    const Identifier& threadID,
+    const std::size_t firstSegment,
+    const std::size_t segments) const
+{
+    sLock lock(shared_lock_);
+    std::shared_ptr<proto::StorageThread> output;
+    api_.Storage().Load(
+        nymID.str(), threadID.str(), firstSegment, segments, output);
+
+    return output;
+}
+
+std::size_t Activity::ThreadSegments(
+    const identifier::Nym& nymID,
+    const Identifier& threadID) const
+{
+    sLock lock(shared_lock_);
+
+    return api_.Storage().ThreadSegments(nymID.str(), threadID.str());
+}
+
 void Activity::thread_preload_thread(
     OTPasswordPrompt reason,
     const std::string nymID,
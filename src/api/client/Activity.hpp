@@ -173,6 +173,14 @@ public:
     std::shared_ptr<proto::StorageThread> Thread(
         const identifier::Nym& nymID,
         const Identifier& threadID) const final;
+    std::shared_ptr<proto::StorageThread> Thread(
+        const identifier::Nym& nymID,
+        const Identifier& threadID,
+        const std::size_t firstSegment,
+        const std::size_t segments) const final;
+    std::size_t ThreadSegments(
+        const identifier::Nym& nymID,
+        const Identifier& threadID) const final;
 
     /**   Obtain a list of thread ids for the specified nym
      *
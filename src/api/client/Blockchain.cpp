@@ -760,6 +760,13 @@ OTIdentifier Blockchain::NewHDSubaccount(
         auto accountID = Identifier::Factory();
         auto& tree = balance_lists_.Get(chain).Nym(nymID);
         tree.AddHDNode(accountPath, accountID);
+#if OT_BLOCKCHAIN
+
+        if (false == accountID->empty()) {
+            Lock lock(lock_);
+            rescan(lock, chain, tree.GetHD().at(accountID));
+        }
+#endif  // OT_BLOCKCHAIN
 
         return accountID;
     } catch (...) {
@@ -953,8 +960,15 @@ bool Blockchain::Start(const Chain type, const std::string& seednode) const
                 type,
                 opentxs::Factory::BlockchainNetworkBitcoin(
                     api_, *this, type, seednode, ""));
+            const auto connected = it->second->Connect();
 
-            return it->second->Connect();
+            for (const auto& nym : balance_lists_.Get(type)) {
+                for (const auto& account : nym.GetHD()) {
+                    rescan(lock, type, account);
+                }
+            }
+
+            return connected;
         }
         default: {
         }
@@ -963,6 +977,29 @@ bool Blockchain::Start(const Chain type, const std::string& seednode) const
     return false;
 }
 
+void Blockchain::rescan(
+    [[maybe_unused]] const Lock& lock,
+    const Chain chain,
+    const blockchain::HD& account) const noexcept
+{
+    auto it = networks_.find(chain);
+
+    // Subaccounts of chains which are not running are scanned by Start()
+    if (networks_.end() == it) { return; }
+
+    OT_ASSERT(it->second);
+
+    const auto id = OTIdentifier{account.ID()};
+    it->second->FilterOracle().Rescan(account, [chain, id](const auto& found) {
+        for (const auto& [height, hash] : found) {
+            LogNormal(opentxs::blockchain::internal::DisplayString(chain))(
+                " block ")(height)(" (")(hash->asHex())(
+                ") matches subaccount ")(id->str())
+                .Flush();
+        }
+    });
+}
+
 auto Blockchain::Stop(const Chain type) const noexcept -> bool
 {
     Lock lock(lock_);
@@ -203,6 +203,12 @@ private:
         std::set<OTIdentifier>& contacts) const noexcept;
     std::string p2pkh(const Chain chain, const Data& pubkeyHash) const noexcept;
     std::string p2sh(const Chain chain, const Data& scriptHash) const noexcept;
+#if OT_BLOCKCHAIN
+    void rescan(
+        const Lock& lock,
+        const Chain chain,
+        const blockchain::HD& account) const noexcept;
+#endif  // OT_BLOCKCHAIN
     bool update_transactions(
         const Lock& lock,
         const identifier::Nym& nym,
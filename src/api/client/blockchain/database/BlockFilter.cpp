@@ -16,6 +16,9 @@
 
 namespace opentxs::api::client::blockchain::database::implementation
 {
+using GCSView = opentxs::blockchain::internal::GCSView;
+using Mode = opentxs::storage::lmdb::LMDB::Mode;
+
 BlockFilter::BlockFilter(
     [[maybe_unused]] const api::internal::Core& api,
     opentxs::storage::lmdb::LMDB& lmdb) noexcept(false)
@@ -102,6 +105,32 @@ auto BlockFilter::LoadFilterHeader(
     return output;
 }
 
+auto BlockFilter::ReadFilters(
+    const FilterType type,
+    const std::vector<ReadView>& blockHashes,
+    const FilterVisitor& cb) const noexcept -> bool
+{
+    try {
+        const auto table = translate_filter(type);
+        auto tx = lmdb_.TransactionRO();
+        auto serialized = ReadView{};
+        const auto load = [&serialized](const auto in) { serialized = in; };
+
+        for (std::size_t i{0}; i < blockHashes.size(); ++i) {
+            serialized = {};
+            lmdb_.Load(table, blockHashes.at(i), load, Mode::One, tx);
+            const auto view = GCSView{serialized};
+
+            if (false == cb(i, view)) { break; }
+        }
+
+        return true;
+    } catch (...) {
+
+        return false;
+    }
+}
+
 auto BlockFilter::StoreFilterHeaders(
     const FilterType type,
     const std::vector<FilterHeader>& headers) const noexcept -> bool
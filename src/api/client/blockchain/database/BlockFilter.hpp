@@ -14,6 +14,7 @@
 #include "util/LMDB.hpp"
 
 #include <cstdint>
+#include <vector>
 
 namespace opentxs::api::client::blockchain::database::implementation
 {
@@ -32,6 +33,10 @@ public:
         const FilterType type,
         const ReadView blockHash,
         const AllocateOutput header) const noexcept -> bool;
+    auto ReadFilters(
+        const FilterType type,
+        const std::vector<ReadView>& blockHashes,
+        const FilterVisitor& cb) const noexcept -> bool;
     auto StoreFilterHeaders(
         const FilterType type,
         const std::vector<FilterHeader>& headers) const noexcept -> bool;
@@ -74,6 +74,13 @@ public:
     {
         return filters_.LoadFilterHeader(type, blockHash, header);
     }
+    auto ReadFilters(
+        const FilterType type,
+        const std::vector<ReadView>& blockHashes,
+        const FilterVisitor& cb) const noexcept -> bool
+    {
+        return filters_.ReadFilters(type, blockHashes, cb);
+    }
     auto StoreBlockHeader(
         const opentxs::blockchain::block::Header& header) const noexcept -> bool
     {
@@ -178,6 +178,18 @@ api::storage::StorageInternal* Factory::Storage(
         defaultGcInterval,
         configGcInterval,
         notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("writer_threads"),
+        storageConfig.storage_writer_threads_,
+        storageConfig.storage_writer_threads_,
+        notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("write_queue_limit"),
+        storageConfig.storage_write_queue_limit_,
+        storageConfig.storage_write_queue_limit_,
+        notUsed);
     config.CheckSet_str(
         String::Factory(STORAGE_CONFIG_KEY),
         String::Factory("path"),
@@ -277,6 +289,18 @@ api::storage::StorageInternal* Factory::Storage(
         String::Factory(storageConfig.lmdb_root_key_),
         storageConfig.lmdb_root_key_,
         notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("lmdb_group_commit_window"),
+        storageConfig.lmdb_group_commit_window_,
+        storageConfig.lmdb_group_commit_window_,
+        notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("lmdb_group_commit_bytes"),
+        storageConfig.lmdb_group_commit_bytes_,
+        storageConfig.lmdb_group_commit_bytes_,
+        notUsed);
 #endif
 
     if (haveGCInterval) {
@@ -674,6 +698,14 @@ bool Storage::CheckTokenSpent(
 {
     return Root().Tree().Notary(notary.str()).CheckSpent(unit, series, key);
 }
+
+bool Storage::CheckTokenSpent(
+    const identifier::Server& notary,
+    const identifier::UnitDefinition& unit,
+    const std::map<std::uint64_t, std::vector<std::string>>& keys) const
+{
+    return Root().Tree().Notary(notary.str()).CheckSpent(unit, keys);
+}
 #endif
 
 void Storage::Cleanup_Storage()
@@ -1164,6 +1196,28 @@ bool Storage::Load(
     return bool(thread);
 }
 
+bool Storage::Load(
+    const std::string& nymId,
+    const std::string& threadId,
+    const std::size_t firstSegment,
+    const std::size_t segments,
+    std::shared_ptr<proto::StorageThread>& thread) const
+{
+    const bool exists =
+        Root().Tree().Nyms().Nym(nymId).Threads().Exists(threadId);
+
+    if (!exists) { return false; }
+
+    thread.reset(new proto::StorageThread);
+
+    if (!thread) { return false; }
+
+    *thread = Root().Tree().Nyms().Nym(nymId).Threads().Thread(threadId).Items(
+        firstSegment, segments);
+
+    return bool(thread);
+}
+
 bool Storage::Load(
     std::shared_ptr<proto::Ciphertext>& output,
     const bool checking) const
@@ -1261,6 +1315,20 @@ bool Storage::MarkTokenSpent(
         .get()
         .MarkSpent(unit, series, key);
 }
+
+bool Storage::MarkTokenSpent(
+    const identifier::Server& notary,
+    const identifier::UnitDefinition& unit,
+    const std::map<std::uint64_t, std::vector<std::string>>& keys) const
+{
+    return mutable_Root()
+        .get()
+        .mutable_Tree()
+        .get()
+        .mutable_Notary(notary.str())
+        .get()
+        .MarkSpent(unit, keys);
+}
 #endif
 
 bool Storage::MoveThreadItem(
@@ -2546,6 +2614,17 @@ std::string Storage::ThreadAlias(
     return Root().Tree().Nyms().Nym(nymID).Threads().Thread(threadID).Alias();
 }
 
+std::size_t Storage::ThreadSegments(
+    const std::string& nymID,
+    const std::string& threadID) const
+{
+    const auto& threads = Root().Tree().Nyms().Nym(nymID).Threads();
+
+    if (false == threads.Exists(threadID)) { return 0; }
+
+    return threads.Thread(threadID).Segments();
+}
+
 std::string Storage::UnitDefinitionAlias(const std::string& id) const
 {
     return Root().Tree().Units().Alias(id);
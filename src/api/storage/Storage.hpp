@@ -95,6 +95,11 @@ public:
         const identifier::UnitDefinition& unit,
         const std::uint64_t series,
         const std::string& key) const final;
+    bool CheckTokenSpent(
+        const identifier::Server& notary,
+        const identifier::UnitDefinition& unit,
+        const std::map<std::uint64_t, std::vector<std::string>>& keys)
+        const final;
 #endif
     std::string ContactAlias(const std::string& id) const final;
     ObjectList ContactList() const final;
@@ -223,6 +228,12 @@ public:
         const std::string& nymId,
         const std::string& threadId,
         std::shared_ptr<proto::StorageThread>& thread) const final;
+    bool Load(
+        const std::string& nymId,
+        const std::string& threadId,
+        const std::size_t firstSegment,
+        const std::size_t segments,
+        std::shared_ptr<proto::StorageThread>& thread) const final;
     bool Load(
         std::shared_ptr<proto::Ciphertext>& output,
         const bool checking = false) const final;
@@ -253,6 +264,11 @@ public:
         const identifier::UnitDefinition& unit,
         const std::uint64_t series,
         const std::string& key) const final;
+    bool MarkTokenSpent(
+        const identifier::Server& notary,
+        const identifier::UnitDefinition& unit,
+        const std::map<std::uint64_t, std::vector<std::string>>& keys)
+        const final;
 #endif
     bool MoveThreadItem(
         const std::string& nymId,
@@ -398,6 +414,9 @@ public:
     std::string ThreadAlias(
         const std::string& nymID,
         const std::string& threadID) const final;
+    std::size_t ThreadSegments(
+        const std::string& nymID,
+        const std::string& threadID) const final;
     std::string UnitDefinitionAlias(const std::string& id) const final;
     ObjectList UnitDefinitionList() const final;
     std::size_t UnreadCount(
@@ -17,10 +17,53 @@
 
 #include "internal/blockchain/Blockchain.hpp"
 
+#include <boost/endian/conversion.hpp>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <map>
 
 #define BITMASK(n) ((1 << (n)) - 1)
 
+namespace
+{
+auto leading_ones(const std::uint64_t word) noexcept -> std::size_t
+{
+    const auto inverted = ~word;
+
+    if (0 == inverted) { return sizeof(word) * 8; }
+
+#if defined(_MSC_VER)
+    unsigned long index{};
+    _BitScanReverse64(&index, inverted);
+
+    return 63u - index;
+#else
+    return static_cast<std::size_t>(__builtin_clzll(inverted));
+#endif
+}
+
+auto load_le(const char* in) noexcept -> std::uint64_t
+{
+    std::uint64_t output{};
+    std::memcpy(&output, in, sizeof(output));
+    boost::endian::little_to_native_inplace(output);
+
+    return output;
+}
+
+constexpr auto rotl(const std::uint64_t x, const int b) noexcept
+    -> std::uint64_t
+{
+    return (x << b) | (x >> (64 - b));
+}
+}  // namespace
+
 namespace opentxs::blockchain::internal
 {
 BitReader::BitReader(const Data& input_data)
@@ -233,6 +276,253 @@ void BitWriter::write(std::size_t nbits, std::uint64_t value)
     }
 }
 
+GolombDecoder::GolombDecoder(
+    const std::uint32_t bits,
+    const ReadView filter) noexcept
+    : bits_(bits)
+    , data_(reinterpret_cast<const std::uint8_t*>(filter.data()))
+    , end_(data_ + filter.size())
+    , word_(0)
+    , available_(0)
+{
+    OT_ASSERT(bits_ <= (WORD_BITS - 8));
+
+    refill();
+}
+
+void GolombDecoder::consume(const std::size_t nbits) noexcept
+{
+    // word_ is left aligned: the next unread bit is always the most
+    // significant bit.
+    word_ = (nbits < WORD_BITS) ? (word_ << nbits) : 0;
+    available_ -= nbits;
+}
+
+std::uint64_t GolombDecoder::next() noexcept
+{
+    std::uint64_t quotient{0};
+
+    // The quotient is a run of 1 bits terminated by a 0 bit. Count the run a
+    // word at a time instead of a bit at a time.
+    while (true) {
+        const auto ones = leading_ones(word_);
+
+        if (ones < available_) {
+            quotient += ones;
+            consume(ones + 1);
+
+            break;
+        }
+
+        quotient += available_;
+        consume(available_);
+        refill();
+    }
+
+    if (available_ < bits_) { refill(); }
+
+    const std::uint64_t remainder =
+        (0 == bits_) ? 0 : (word_ >> (WORD_BITS - bits_));
+    consume(bits_);
+
+    return (quotient << bits_) + remainder;
+}
+
+void GolombDecoder::refill() noexcept
+{
+    if (WORD_BITS == available_) { return; }
+
+    const auto remaining = static_cast<std::size_t>(end_ - data_);
+
+    if (sizeof(std::uint64_t) <= remaining) {
+        // Load eight bytes at once and keep as many whole bytes as fit behind
+        // the buffered bits. The leading bits of the first byte which did not
+        // fit may also end up in word_, but the next refill will write the
+        // same values to the same positions.
+        std::uint64_t next{};
+        std::memcpy(&next, data_, sizeof(next));
+        boost::endian::big_to_native_inplace(next);
+        const auto bytes = (WORD_BITS - available_) / 8;
+        word_ |= next >> available_;
+        data_ += bytes;
+        available_ += bytes * 8;
+    } else {
+        while ((available_ <= (WORD_BITS - 8)) && (data_ != end_)) {
+            word_ |= static_cast<std::uint64_t>(*data_++)
+                     << (WORD_BITS - 8 - available_);
+            available_ += 8;
+        }
+
+        // Everything past the end of the filter reads as zero
+        if (data_ == end_) { available_ = WORD_BITS; }
+    }
+}
+
+SipHasher::SipHasher(const ReadView key) noexcept
+    : k0_(0)
+    , k1_(0)
+{
+    // Callers are responsible for validating the key size. A short key is
+    // zero padded rather than read past its end.
+    char bytes[16]{};
+
+    if (nullptr != key.data()) {
+        std::memcpy(bytes, key.data(), std::min(sizeof(bytes), key.size()));
+    }
+
+    k0_ = load_le(bytes);
+    k1_ = load_le(bytes + 8);
+}
+
+std::uint64_t SipHasher::operator()(const ReadView item) const noexcept
+{
+    auto state = init();
+
+    return finish(state, item, 0);
+}
+
+void SipHasher::operator()(
+    const std::vector<OTData>& items,
+    std::uint64_t* output) const noexcept
+{
+    auto views = std::array<ReadView, LANES>{};
+    std::size_t i{0};
+
+    for (; (i + LANES) <= items.size(); i += LANES) {
+        for (std::size_t lane{0}; lane < LANES; ++lane) {
+            views[lane] = items[i + lane]->Bytes();
+        }
+
+        hash_lanes(views.data(), output + i);
+    }
+
+    for (; i < items.size(); ++i) { output[i] = (*this)(items[i]->Bytes()); }
+}
+
+void SipHasher::compress(State& state, const std::uint64_t block) noexcept
+{
+    state.v3_ ^= block;
+    round(state);
+    round(state);
+    state.v0_ ^= block;
+}
+
+std::uint64_t SipHasher::finish(
+    State& state,
+    const ReadView item,
+    std::size_t offset) noexcept
+{
+    const auto size = item.size();
+
+    for (; (offset + 8) <= size; offset += 8) {
+        compress(state, load_le(item.data() + offset));
+    }
+
+    auto last = static_cast<std::uint64_t>(size) << 56;
+
+    for (std::size_t i{0}; offset < size; ++i, ++offset) {
+        last |= static_cast<std::uint64_t>(
+                    static_cast<std::uint8_t>(item[offset]))
+                << (8 * i);
+    }
+
+    compress(state, last);
+    state.v2_ ^= 0xff;
+    round(state);
+    round(state);
+    round(state);
+    round(state);
+
+    return state.v0_ ^ state.v1_ ^ state.v2_ ^ state.v3_;
+}
+
+void SipHasher::hash_lanes(const ReadView* items, std::uint64_t* output) const
+    noexcept
+{
+    // The state of each lane is kept in its own array slot so the compiler
+    // can run the rounds for all lanes with vector instructions. Lanes are
+    // only compressed together for the blocks all of them have in common,
+    // after which each lane is finished separately.
+    std::uint64_t v0[LANES]{};
+    std::uint64_t v1[LANES]{};
+    std::uint64_t v2[LANES]{};
+    std::uint64_t v3[LANES]{};
+    std::uint64_t m[LANES]{};
+    auto common = items[0].size();
+
+    for (std::size_t lane{0}; lane < LANES; ++lane) {
+        const auto state = init();
+        v0[lane] = state.v0_;
+        v1[lane] = state.v1_;
+        v2[lane] = state.v2_;
+        v3[lane] = state.v3_;
+        common = std::min(common, items[lane].size());
+    }
+
+    common -= common % 8;
+
+    for (std::size_t offset{0}; offset < common; offset += 8) {
+        for (std::size_t lane{0}; lane < LANES; ++lane) {
+            m[lane] = load_le(items[lane].data() + offset);
+            v3[lane] ^= m[lane];
+        }
+
+        for (int r{0}; r < 2; ++r) {
+            for (std::size_t lane{0}; lane < LANES; ++lane) {
+                v0[lane] += v1[lane];
+                v1[lane] = rotl(v1[lane], 13);
+                v1[lane] ^= v0[lane];
+                v0[lane] = rotl(v0[lane], 32);
+                v2[lane] += v3[lane];
+                v3[lane] = rotl(v3[lane], 16);
+                v3[lane] ^= v2[lane];
+                v0[lane] += v3[lane];
+                v3[lane] = rotl(v3[lane], 21);
+                v3[lane] ^= v0[lane];
+                v2[lane] += v1[lane];
+                v1[lane] = rotl(v1[lane], 17);
+                v1[lane] ^= v2[lane];
+                v2[lane] = rotl(v2[lane], 32);
+            }
+        }
+
+        for (std::size_t lane{0}; lane < LANES; ++lane) {
+            v0[lane] ^= m[lane];
+        }
+    }
+
+    for (std::size_t lane{0}; lane < LANES; ++lane) {
+        auto state = State{v0[lane], v1[lane], v2[lane], v3[lane]};
+        output[lane] = finish(state, items[lane], common);
+    }
+}
+
+SipHasher::State SipHasher::init() const noexcept
+{
+    return State{k0_ ^ 0x736f6d6570736575ull,
+                 k1_ ^ 0x646f72616e646f6dull,
+                 k0_ ^ 0x6c7967656e657261ull,
+                 k1_ ^ 0x7465646279746573ull};
+}
+
+void SipHasher::round(State& state) noexcept
+{
+    state.v0_ += state.v1_;
+    state.v1_ = rotl(state.v1_, 13);
+    state.v1_ ^= state.v0_;
+    state.v0_ = rotl(state.v0_, 32);
+    state.v2_ += state.v3_;
+    state.v3_ = rotl(state.v3_, 16);
+    state.v3_ ^= state.v2_;
+    state.v0_ += state.v3_;
+    state.v3_ = rotl(state.v3_, 21);
+    state.v3_ ^= state.v0_;
+    state.v2_ += state.v1_;
+    state.v1_ = rotl(state.v1_, 17);
+    state.v1_ ^= state.v2_;
+    state.v2_ = rotl(state.v2_, 32);
+}
+
 SerializedBloomFilter::SerializedBloomFilter(
     const std::uint32_t tweak,
     const BloomUpdateFlag update,
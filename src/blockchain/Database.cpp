@@ -71,6 +71,7 @@ const opentxs::storage::lmdb::TableNames Database::table_names_{
     {BlockHeaderDisconnected, "disconnected_block_headers"},
     {BlockFilterBest, "filter_tips"},
     {BlockFilterHeaderBest, "filter_header_tips"},
+    {BlockFilterRescan, "filter_rescan_positions"},
 };
 
 const std::map<
@@ -125,7 +126,8 @@ Database::Database(
            {BlockHeaderSiblings, 0},
            {BlockHeaderDisconnected, MDB_DUPSORT},
            {BlockFilterBest, MDB_INTEGERKEY},
-           {BlockFilterHeaderBest, MDB_INTEGERKEY}},
+           {BlockFilterHeaderBest, MDB_INTEGERKEY},
+           {BlockFilterRescan, 0}},
           0)
     , filters_(api, common_, lmdb_, type)
     , headers_(api, network, common_, lmdb_, type)
@@ -177,6 +179,19 @@ auto Database::Filters::CurrentHeaderTip(const filter::Type type) const noexcept
     return output;
 }
 
+auto Database::Filters::CurrentRescanTip(
+    const filter::Type type,
+    const Identifier& key) const noexcept -> block::Position
+{
+    auto output{blank_position_};
+    auto cb = [this, &output](const auto in) {
+        output = blockchain::internal::Deserialize(api_, in);
+    };
+    lmdb_.Load(Table::BlockFilterRescan, rescan_key(type, key), cb);
+
+    return output;
+}
+
 auto Database::Filters::CurrentTip(const filter::Type type) const noexcept
     -> block::Position
 {
@@ -287,6 +302,30 @@ auto Database::Filters::SetHeaderTip(
         .first;
 }
 
+auto Database::Filters::rescan_key(
+    const filter::Type type,
+    const Identifier& key) noexcept -> std::string
+{
+    const auto value = static_cast<std::uint32_t>(type);
+    auto output = std::string{tsv(value)};
+    output.append(static_cast<const char*>(key.data()), key.size());
+
+    return output;
+}
+
+auto Database::Filters::SetRescanTip(
+    const filter::Type type,
+    const Identifier& key,
+    const block::Position position) const noexcept -> bool
+{
+    return lmdb_
+        .Store(
+            Table::BlockFilterRescan,
+            rescan_key(type, key),
+            reader(blockchain::internal::Serialize(position)))
+        .first;
+}
+
 auto Database::Filters::SetTip(
     const filter::Type type,
     const block::Position position) const noexcept -> bool
@@ -101,10 +101,22 @@ public:
     {
         return headers_.LoadHeader(hash);
     }
+    bool ReadFilters(
+        const filter::Type type,
+        const std::vector<ReadView>& blocks,
+        const FilterVisitor& cb) const noexcept final
+    {
+        return common_.ReadFilters(type, blocks, cb);
+    }
     std::vector<block::pHash> RecentHashes() const noexcept final
     {
         return headers_.RecentHashes();
     }
+    block::Position RescanTip(const filter::Type type, const Identifier& key)
+        const noexcept final
+    {
+        return filters_.CurrentRescanTip(type, key);
+    }
     bool SetFilterHeaderTip(
         const filter::Type type,
         const block::Position position) const noexcept final
@@ -116,6 +128,13 @@ public:
     {
         return filters_.SetTip(type, position);
     }
+    bool SetRescanTip(
+        const filter::Type type,
+        const Identifier& key,
+        const block::Position position) const noexcept final
+    {
+        return filters_.SetRescanTip(type, key, position);
+    }
     client::Hashes SiblingHashes() const noexcept final
     {
         return headers_.SiblingHashes();
@@ -153,6 +172,9 @@ private:
     struct Filters {
         block::Position CurrentHeaderTip(const filter::Type type) const
             noexcept;
+        block::Position CurrentRescanTip(
+            const filter::Type type,
+            const Identifier& key) const noexcept;
         block::Position CurrentTip(const filter::Type type) const noexcept;
         bool HaveFilter(const filter::Type type, const block::Hash& block) const
             noexcept
@@ -171,6 +193,10 @@ private:
         bool SetHeaderTip(
             const filter::Type type,
             const block::Position position) const noexcept;
+        bool SetRescanTip(
+            const filter::Type type,
+            const Identifier& key,
+            const block::Position position) const noexcept;
         bool SetTip(const filter::Type type, const block::Position position)
             const noexcept;
         bool StoreHeaders(
@@ -198,6 +224,11 @@ private:
             std::map<filter::Type, std::pair<std::string, std::string>>>
             genesis_filters_;
 
+        // Rescan positions are kept per filter type and subaccount
+        static auto rescan_key(
+            const filter::Type type,
+            const Identifier& key) noexcept -> std::string;
+
         const api::internal::Core& api_;
         const Common& common_;
         const opentxs::storage::lmdb::LMDB& lmdb_;
@@ -274,6 +305,7 @@ private:
         BlockHeaderDisconnected = 5,
         BlockFilterBest = 6,
         BlockFilterHeaderBest = 7,
+        BlockFilterRescan = 8,
     };
 
     enum class Key : std::size_t {
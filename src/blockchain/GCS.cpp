@@ -7,10 +7,7 @@
 
 #include "Internal.hpp"
 
-#include "opentxs/api/crypto/Hash.hpp"
-#include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/api/Core.hpp"
-#include "opentxs/core/crypto/OTPassword.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Log.hpp"
 
@@ -19,11 +16,15 @@
 #include "internal/blockchain/Blockchain.hpp"
 
 #include <boost/endian/buffers.hpp>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#if !defined(__SIZEOF_INT128__)
 #include <boost/multiprecision/cpp_int.hpp>
+#endif
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
-#include <set>
 #include <vector>
 
 #include "GCS.hpp"
@@ -31,7 +32,15 @@
 //#define OT_METHOD "opentxs::blockchain::implementation::GCS::"
 
 namespace be = boost::endian;
-namespace mp = boost::multiprecision;
+
+namespace
+{
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 Product;
+#else
+using Product = boost::multiprecision::uint128_t;
+#endif
+}  // namespace
 
 #define BITMASK(n) ((1 << (n)) - 1)
 
@@ -117,6 +126,7 @@ GCS::GCS(
     , bits_(bits)
     , false_positive_rate_(fpRate)
     , key_(key)
+    , hasher_(key_->Bytes())
     , filter_elements_(filterElementCount)
     , filter_(filter)
 {
@@ -124,6 +134,11 @@ GCS::GCS(
         throw std::runtime_error(
             "Invalid key size: " + std::to_string(key_->size()));
     }
+
+    if (32 < bits_) {
+        throw std::runtime_error(
+            "Invalid bit parameter: " + std::to_string(bits_));
+    }
 }
 
 GCS::GCS(
@@ -137,21 +152,19 @@ GCS::GCS(
           fpRate,
           key,
           elements.size(),
-          build_gcs(api, bits, fpRate, key, elements))
+          build_gcs(bits, fpRate, key, elements))
 {
 }
 
 auto GCS::build_gcs(
-    const api::internal::Core& api,
     const std::uint32_t bits,
     const std::uint32_t fpRate,
     const Data& key,
     const std::vector<OTData>& elements) noexcept -> OTData
 {
     auto output = Data::Factory();
-
-    const auto items =
-        hashed_set_construct(api, fpRate, elements.size(), key, elements);
+    const auto items = hashed_set_construct(
+        Hasher{key.Bytes()}, fpRate, elements.size(), elements);
 
     BitWriter stream(output);
     std::uint64_t last_value{0};
@@ -177,18 +190,6 @@ auto GCS::Encode() const noexcept -> OTData
     return output;
 }
 
-auto GCS::golomb_decode(BitReader& stream) const noexcept -> std::uint64_t
-{
-    std::uint64_t quotient{0};
-
-    while (stream.read(1) == 1) { quotient++; }
-
-    auto remainder = stream.read(bits_);
-    std::uint64_t return_value = (quotient << bits_) + remainder;
-
-    return return_value;
-}
-
 auto GCS::golomb_encode(
     const std::uint32_t bits,
     BitWriter& stream,
@@ -220,10 +221,8 @@ auto GCS::Hash() const noexcept -> OTData
 }
 
 auto GCS::hash_to_range(
-    const api::internal::Core& api,
-    const Data& key,
-    const std::uint64_t maxRange,
-    const Data& item) noexcept -> std::uint64_t
+    const std::uint64_t hash,
+    const std::uint64_t maxRange) noexcept -> std::uint64_t
 {
     /*
      The items are first passed through the pseudorandom function SipHash, which
@@ -231,11 +230,8 @@ auto GCS::hash_to_range(
      uniformly random 64-bit output. Implementations of this BIP MUST use the
      SipHash parameters c = 2 and d = 4.
      */
-    mp::uint128_t siphash_128 = (siphash(api, key, item));
-    mp::uint128_t maxrange_128 = (maxRange);
-    mp::uint128_t multiplied = siphash_128 * maxrange_128;
-    mp::uint128_t bitshifted = (multiplied >> 64);
-    auto return64 = bitshifted.convert_to<std::uint64_t>();
+    const auto multiplied = static_cast<Product>(hash) * maxRange;
+    const auto return64 = static_cast<std::uint64_t>(multiplied >> 64);
 
     // let item = (siphash(key, target) * (N * (1 << fp))) >> 64
     // NOTICE The above commented code...we multiply the hash output
@@ -267,12 +263,6 @@ auto GCS::hash_to_range(
     return return64;
 }
 
-auto GCS::hash_to_range(const Data& item, const std::uint64_t maxRange) const
-    noexcept -> std::uint64_t
-{
-    return hash_to_range(api_, key_, maxRange, item);
-}
-
 /*
  N is elementCount, the number of elements in the original set that created
    the filter.
@@ -281,11 +271,10 @@ auto GCS::hash_to_range(const Data& item, const std::uint64_t maxRange) const
  P is the bit length of the remainder code. It's the bits_ member variable.
  */
 auto GCS::hashed_set_construct(
-    const api::internal::Core& api,
+    const Hasher& hasher,
     const std::uint32_t fpRate,
     const std::size_t elementCount,
-    const Data& key,
-    const std::vector<OTData>& elements) noexcept -> std::set<std::uint64_t>
+    const std::vector<OTData>& elements) noexcept -> std::vector<std::uint64_t>
 {
     // Original spec says: let F = N * M
     //  matches other items with probability 1/M for some integer parameter M
@@ -293,21 +282,57 @@ auto GCS::hashed_set_construct(
     // P a value which is computed as 1/fp where fp is the desired false
     // positive rate.
     const std::uint64_t maxRange = elementCount * fpRate;
-    std::set<std::uint64_t> set_items;  // hash values sorted ascending
+    auto output = std::vector<std::uint64_t>(elements.size());
+    hasher(elements, output.data());
 
-    for (const auto& item : elements) {
-        const std::uint64_t set_value = hash_to_range(api, key, maxRange, item);
-        set_items.insert(set_value);
-    }
+    for (auto& value : output) { value = hash_to_range(value, maxRange); }
 
-    return set_items;
+    // hash values sorted ascending
+    std::sort(output.begin(), output.end());
+    output.erase(std::unique(output.begin(), output.end()), output.end());
+
+    return output;
 }
 
 auto GCS::hashed_set_construct(const std::vector<OTData>& elements) const
-    noexcept -> std::set<std::uint64_t>
+    noexcept -> std::vector<std::uint64_t>
 {
     return hashed_set_construct(
-        api_, false_positive_rate_, filter_elements_, key_, elements);
+        hasher_, false_positive_rate_, filter_elements_, elements);
+}
+
+auto GCS::match(
+    const std::uint32_t bits,
+    const std::size_t elementCount,
+    const ReadView filter,
+    const std::vector<std::uint64_t>& targets) noexcept -> bool
+{
+    if (targets.empty()) { return false; }
+
+    // Both the filter and the targets are sorted ascending, so a single merge
+    // pass over each of them is sufficient.
+    BitDecoder stream(bits, filter);
+    auto target = targets.cbegin();
+    const auto end = targets.cend();
+    std::uint64_t value{0};
+
+    for (std::size_t i{0}; i < elementCount; ++i) {
+        value += stream.next();
+
+        while (*target < value) {
+            if (++target == end) { return false; }
+        }
+
+        if (*target == value) { return true; }
+    }
+
+    return false;
+}
+
+auto GCS::match(const std::vector<std::uint64_t>& targets) const noexcept
+    -> bool
+{
+    return match(bits_, filter_elements_, filter_->Bytes(), targets);
 }
 
 auto GCS::Serialize() const noexcept -> proto::GCS
@@ -323,83 +348,108 @@ auto GCS::Serialize() const noexcept -> proto::GCS
     return output;
 }
 
-auto GCS::siphash(
-    const api::internal::Core& api,
-    const Data& key,
-    const Data& item) noexcept -> std::uint64_t
+auto GCS::Test(const Data& target) const noexcept -> bool
 {
-    auto output = std::uint64_t{};
-    auto pPassword = api.Factory().BinarySecret();
-
-    OT_ASSERT(pPassword);
+    const std::uint64_t maxRange = filter_elements_ * false_positive_rate_;
 
-    auto& password = *pPassword;
-    password.setMemory(key);
-
-    OT_ASSERT(16 == password.getMemorySize());
-
-    const auto hashed = api.Crypto().Hash().SipHash(
-        password, item, output, siphash_c_, siphash_d_);
-
-    if (hashed) { return output; }
+    return match({hash_to_range(hasher_(target.Bytes()), maxRange)});
+}
 
-    return 0;
+auto GCS::Test(const std::vector<OTData>& targets) const noexcept -> bool
+{
+    return match(hashed_set_construct(targets));
 }
+}  // namespace opentxs::blockchain::implementation
 
-auto GCS::siphash(const Data& item) const noexcept -> std::uint64_t
+namespace opentxs::blockchain::internal
+{
+GCSView::GCSView(const ReadView serialized) noexcept
+    : valid_(false)
+    , bits_(0)
+    , fp_rate_(0)
+    , count_(0)
+    , key_()
+    , filter_()
 {
-    return siphash(api_, key_, item);
+    valid_ = parse(serialized) && (16 == key_.size()) && (32 >= bits_);
 }
 
-auto GCS::Test(const Data& target) const noexcept -> bool
+auto GCSView::parse(const ReadView in) noexcept -> bool
 {
-    const std::uint64_t max_range = filter_elements_ * false_positive_rate_;
-    auto target_hash = hash_to_range(target, max_range);
+    using Stream = google::protobuf::io::CodedInputStream;
+    using Wire = google::protobuf::internal::WireFormatLite;
 
-    BitReader stream(filter_);
-    std::uint64_t last_value{0};
+    if ((nullptr == in.data()) || (0 == in.size())) { return false; }
+
+    auto stream = Stream{reinterpret_cast<const std::uint8_t*>(in.data()),
+                         static_cast<int>(in.size())};
+    auto bytes = [&stream](ReadView& out) -> bool {
+        auto size = std::uint32_t{0};
+        const void* data{nullptr};
+        auto available = int{0};
+
+        if (false == stream.ReadVarint32(&size)) { return false; }
+
+        if (false == stream.GetDirectBufferPointer(&data, &available)) {
+            // zero length field at the end of the input
+            out = {};
+
+            return 0 == size;
+        }
+
+        if (static_cast<std::uint32_t>(available) < size) { return false; }
+
+        out = {static_cast<const char*>(data), size};
+
+        return stream.Skip(static_cast<int>(size));
+    };
+
+    while (const auto tag = stream.ReadTag()) {
+        const auto varint = Wire::WIRETYPE_VARINT == Wire::GetTagWireType(tag);
+        const auto delimited =
+            Wire::WIRETYPE_LENGTH_DELIMITED == Wire::GetTagWireType(tag);
+        auto success{false};
+
+        switch (Wire::GetTagFieldNumber(tag)) {
+            case proto::GCS::kBitsFieldNumber: {
+                success = varint && stream.ReadVarint32(&bits_);
+            } break;
+            case proto::GCS::kFprateFieldNumber: {
+                success = varint && stream.ReadVarint32(&fp_rate_);
+            } break;
+            case proto::GCS::kCountFieldNumber: {
+                success = varint && stream.ReadVarint32(&count_);
+            } break;
+            case proto::GCS::kKeyFieldNumber: {
+                success = delimited && bytes(key_);
+            } break;
+            case proto::GCS::kFilterFieldNumber: {
+                success = delimited && bytes(filter_);
+            } break;
+            default: {
+                success = Wire::SkipField(&stream, tag);
+            }
+        }
 
-    for (std::uint64_t i{0}; i < filter_elements_; ++i) {
-        auto delta = golomb_decode(stream);
-        auto set_item = last_value + delta;
-        if (set_item == target_hash) { return true; }
-        if (set_item > target_hash) { break; }
-        last_value = set_item;
+        if (false == success) { return false; }
     }
 
-    return false;
+    return stream.ConsumedEntireMessage();
 }
 
-auto GCS::Test(const std::vector<OTData>& targets) const noexcept -> bool
+auto GCSView::Test(const std::vector<OTData>& targets) const noexcept -> bool
 {
-    auto target_hashes_set = hashed_set_construct(targets);
-    std::vector<std::uint64_t> target_hashes;
+    using Implementation = implementation::GCS;
 
-    for (const auto& target_hash : target_hashes_set) {
-        target_hashes.push_back(target_hash);
-    }
+    if (false == valid_) { return false; }
 
-    BitReader stream(filter_);
-    std::uint64_t value{0};
-    std::size_t target_idx{0};
-    std::uint64_t target_val = target_hashes[target_idx];
-
-    for (std::size_t i{0}; i < filter_elements_; ++i) {
-        auto delta = golomb_decode(stream);
-        value += delta;
-        if (target_val == value) {
-            return true;
-        } else if (target_val > value) {
-            continue;
-        } else {
-            ++target_idx;
-
-            if (target_idx == targets.size()) { break; }
-
-            target_val = target_hashes[target_idx];
-        }
-    }
+    const auto hasher = SipHasher{key_};
 
-    return false;
+    return Implementation::match(
+        bits_,
+        count_,
+        filter_,
+        Implementation::hashed_set_construct(
+            hasher, fp_rate_, count_, targets));
 }
-}  // namespace opentxs::blockchain::implementation
+}  // namespace opentxs::blockchain::internal
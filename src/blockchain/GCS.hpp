@@ -20,23 +20,22 @@ public:
 
 private:
     friend opentxs::Factory;
+    friend internal::GCSView;
 
-    using BitReader = internal::BitReader;
+    using BitDecoder = internal::GolombDecoder;
     using BitWriter = internal::BitWriter;
-
-    static const int siphash_c_{2};
-    static const int siphash_d_{4};
+    using Hasher = internal::SipHasher;
 
     const VersionNumber version_;
     const api::internal::Core& api_;
     const std::uint32_t bits_;
     const std::uint32_t false_positive_rate_;
     const OTData key_;
+    const Hasher hasher_;
     const std::size_t filter_elements_;
     const OTData filter_;
 
     static OTData build_gcs(
-        const api::internal::Core& api,
         const std::uint32_t bits,
         const std::uint32_t fpRate,
         const Data& key,
@@ -46,27 +45,22 @@ private:
         BitWriter& stream,
         std::uint64_t delta) noexcept;
     static std::uint64_t hash_to_range(
-        const api::internal::Core& api,
-        const Data& key,
-        const std::uint64_t maxRange,
-        const Data& item) noexcept;
-    static std::set<std::uint64_t> hashed_set_construct(
-        const api::internal::Core& api,
+        const std::uint64_t hash,
+        const std::uint64_t maxRange) noexcept;
+    static std::vector<std::uint64_t> hashed_set_construct(
+        const Hasher& hasher,
         const std::uint32_t fpRate,
         const std::size_t elementCount,
-        const Data& key,
         const std::vector<OTData>& elements) noexcept;
-    static std::uint64_t siphash(
-        const api::internal::Core& api,
-        const Data& key,
-        const Data& item) noexcept;
+    static bool match(
+        const std::uint32_t bits,
+        const std::size_t elementCount,
+        const ReadView filter,
+        const std::vector<std::uint64_t>& targets) noexcept;
 
-    std::uint64_t golomb_decode(BitReader& stream) const noexcept;
-    std::uint64_t siphash(const Data& item) const noexcept;
-    std::uint64_t hash_to_range(const Data& item, const std::uint64_t maxRange)
-        const noexcept;
-    std::set<std::uint64_t> hashed_set_construct(
+    std::vector<std::uint64_t> hashed_set_construct(
         const std::vector<OTData>& elements) const noexcept;
+    bool match(const std::vector<std::uint64_t>& targets) const noexcept;
 
     GCS(const api::internal::Core& api,
         const std::uint32_t bits,
@@ -9,7 +9,9 @@
 
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Endpoints.hpp"
+#include "opentxs/api/Settings.hpp"
 #include "opentxs/core/Log.hpp"
+#include "opentxs/core/String.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
@@ -19,27 +21,34 @@
 
 #include <boost/bind.hpp>
 
+// 0 means one thread per hardware core
+#define OT_BLOCKCHAIN_IO_THREADS 0
+
 namespace opentxs::blockchain::client::internal
 {
+IO::Engine::Engine() noexcept
+    : context_()
+    , work_(std::make_unique<boost::asio::io_context::work>(context_))
+    , peers_(0)
+    , messages_(0)
+    , bytes_(0)
+{
+    OT_ASSERT(work_);
+}
+
 IO::IO(const api::Core& api) noexcept
     : api_(api)
-    , lock_()
     , cb_(zmq::ListenCallback::Factory([this](auto& in) { callback(in); }))
     , socket_(
           api.ZeroMQ().RouterSocket(cb_, zmq::socket::Socket::Direction::Bind))
-    , next_buffer_(-1)
-    , buffers_()
-    , context_()
-    , work_(std::make_unique<boost::asio::io_context::work>(context_))
+    , engines_(make_engines(api))
     , thread_pool_()
 {
-    OT_ASSERT(work_);
-
-    const auto limit = std::min(2u, std::thread::hardware_concurrency());
+    OT_ASSERT(0 < engines_.size());
 
-    for (unsigned int i{0}; i < limit; ++i) {
+    for (const auto& engine : engines_) {
         thread_pool_.create_thread(
-            boost::bind(&boost::asio::io_context::run, &context_));
+            boost::bind(&boost::asio::io_context::run, &engine->context_));
     }
 
     const auto listen =
@@ -48,6 +57,21 @@ IO::IO(const api::Core& api) noexcept
     OT_ASSERT(listen);
 }
 
+auto IO::Attach() const noexcept -> boost::asio::io_context&
+{
+    auto* output = engines_.front().get();
+
+    for (const auto& engine : engines_) {
+        if (engine->peers_.load() < output->peers_.load()) {
+            output = engine.get();
+        }
+    }
+
+    ++output->peers_;
+
+    return output->context_;
+}
+
 auto IO::callback(zmq::Message& in) noexcept -> void
 {
     const auto header = in.Header();
@@ -68,10 +92,22 @@ auto IO::callback(zmq::Message& in) noexcept -> void
     }
 }
 
-auto IO::clear_buffer(const int id) const noexcept -> void
+auto IO::Detach(tcp::socket& socket) const noexcept -> void
 {
-    Lock lock(lock_);
-    buffers_.erase(id);
+    auto* engine = this->engine(socket);
+
+    OT_ASSERT(nullptr != engine);
+
+    --engine->peers_;
+}
+
+auto IO::disconnect(const Space& id) const noexcept -> void
+{
+    auto work = api_.ZeroMQ().Message(id);
+    work->AddFrame(OTZMQWorkType{OT_ZMQ_DISCONNECT_SIGNAL});
+    work->AddFrame();
+    work->AddFrame();
+    socket_->Send(work);
 }
 
 auto IO::Connect(
@@ -80,70 +116,143 @@ auto IO::Connect(
     tcp::socket& socket) const noexcept -> void
 {
     socket.async_connect(endpoint, [this, id](const auto& e) {
-        auto work = api_.ZeroMQ().Message(id);
-
         if (e) {
             LogVerbose("asio connect error: ")(e.message()).Flush();
-            work->AddFrame(OTZMQWorkType{OT_ZMQ_DISCONNECT_SIGNAL});
-            work->AddFrame();
-            work->AddFrame();
-        } else {
-            work->AddFrame(OTZMQWorkType{OT_ZMQ_CONNECT_SIGNAL});
-            work->AddFrame();
-            work->AddFrame();
+            disconnect(id);
+
+            return;
         }
 
+        auto work = api_.ZeroMQ().Message(id);
+        work->AddFrame(OTZMQWorkType{OT_ZMQ_CONNECT_SIGNAL});
+        work->AddFrame();
+        work->AddFrame();
         socket_->Send(work);
     });
 }
 
-auto IO::get_buffer(const std::size_t bytes) const noexcept
-    -> std::pair<int, WritableView>
+auto IO::engine(tcp::socket& socket) const noexcept -> Engine*
+{
+    auto& context = socket.get_executor().context();
+
+    for (const auto& engine : engines_) {
+        if (&engine->context_ == &context) { return engine.get(); }
+    }
+
+    return nullptr;
+}
+
+auto IO::Load() const noexcept -> std::vector<ThreadLoad>
+{
+    auto output = std::vector<ThreadLoad>{};
+
+    for (const auto& engine : engines_) {
+        output.emplace_back(ThreadLoad{engine->peers_.load(),
+                                       engine->messages_.load(),
+                                       engine->bytes_.load()});
+    }
+
+    return output;
+}
+
+auto IO::make_engines(const api::Core& api) noexcept
+    -> std::vector<std::unique_ptr<Engine>>
 {
-    Lock lock(lock_);
-    auto id = ++next_buffer_;
-    auto& buffer = buffers_[id];
+    std::int64_t configured{0};
+    bool notUsed{false};
+    api.Config().CheckSet_long(
+        String::Factory("blockchain"),
+        String::Factory("io_threads"),
+        OT_BLOCKCHAIN_IO_THREADS,
+        configured,
+        notUsed);
+    const auto threads =
+        (0 < configured)
+            ? static_cast<std::size_t>(configured)
+            : std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    auto output = std::vector<std::unique_ptr<Engine>>{};
 
-    return {id, writer(buffer)(bytes)};
+    for (std::size_t i{0}; i < threads; ++i) {
+        output.emplace_back(std::make_unique<Engine>());
+    }
+
+    return output;
 }
 
 auto IO::Receive(
     const Space& id,
     const OTZMQWorkType type,
-    const std::size_t bytes,
+    const std::size_t headerBytes,
+    const BodySize bodySize,
     tcp::socket& socket) const noexcept -> void
 {
-    auto space = get_buffer(bytes);
-    auto asioBuffer =
-        boost::asio::buffer(space.second.data(), space.second.size());
+    auto* engine = this->engine(socket);
+
+    OT_ASSERT(nullptr != engine);
+
+    auto work = std::make_shared<OTZMQMessage>(api_.ZeroMQ().Message(id));
+    auto& message = work->get();
+    message.AddFrame(type);
+    message.AddFrame();
+    const auto header = message.AppendBytes()(headerBytes);
     boost::asio::async_read(
         socket,
-        asioBuffer,
-        [this, id, type, space{std::move(space)}](const auto& e, auto size) {
-            auto work = api_.ZeroMQ().Message(id);
-            auto& buffer = space.second;
-
+        boost::asio::buffer(header.data(), header.size()),
+        [this, id, bodySize, work, engine, &socket](const auto& e, auto) {
             if (e) {
                 LogVerbose("asio receive error: ")(e.message()).Flush();
-                work->AddFrame(OTZMQWorkType{OT_ZMQ_DISCONNECT_SIGNAL});
-                work->AddFrame();
-                work->AddFrame();
-            } else {
-                work->AddFrame(type);
-                work->AddFrame();
-                work->AddFrame(buffer.data(), buffer.size());
+                disconnect(id);
+
+                return;
+            }
+
+            auto& message = work->get();
+            const auto bytes = bodySize(message.Body_at(0));
+            const auto body = message.AppendBytes()(bytes);
+            ++engine->messages_;
+            engine->bytes_ += message.Body_at(0).size() + bytes;
+
+            if (0 == bytes) {
+                socket_->Send(message);
+
+                return;
             }
 
-            socket_->Send(work);
-            clear_buffer(space.first);
+            boost::asio::async_read(
+                socket,
+                boost::asio::buffer(body.data(), body.size()),
+                [this, id, work](const auto& e, auto) {
+                    if (e) {
+                        LogVerbose("asio receive error: ")(e.message())
+                            .Flush();
+                        disconnect(id);
+                    } else {
+                        socket_->Send(work->get());
+                    }
+                });
         });
 }
 
 auto IO::Shutdown() noexcept -> void
 {
-    context_.stop();
+    for (const auto& engine : engines_) { engine->context_.stop(); }
+
     thread_pool_.join_all();
-    work_.reset();
+    const auto load = Load();
+
+    for (std::size_t thread{0}; thread < engines_.size(); ++thread) {
+        auto& engine = *engines_.at(thread);
+
+        if (engine.work_) {
+            const auto& [peers, messages, bytes] = load.at(thread);
+            LogVerbose("Blockchain I/O thread ")(thread)(": ")(messages)(
+                " messages, ")(bytes)(" bytes received, ")(peers)(
+                " peers attached")
+                .Flush();
+            engine.work_.reset();
+        }
+    }
+
     socket_->Close();
 }
 
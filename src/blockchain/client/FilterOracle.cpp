@@ -7,6 +7,7 @@
 
 #include "Internal.hpp"
 
+#include "opentxs/api/client/blockchain/HD.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/blockchain/block/Header.hpp"
@@ -27,6 +28,9 @@
 #include "internal/blockchain/Blockchain.hpp"
 
 #include <mutex>
+#include <thread>
+
+#include "Rescan.hpp"
 
 #include "FilterOracle.hpp"
 
@@ -50,6 +54,7 @@ auto Factory::BlockchainFilterOracle(
 
 namespace opentxs::blockchain::client::implementation
 {
+const std::size_t FilterOracle::rescan_batch_{500};
 const std::chrono::seconds FilterOracle::FilterQueue::timeout_{15};
 const std::chrono::seconds FilterOracle::RequestQueue::limit_{15};
 
@@ -66,6 +71,12 @@ FilterOracle::FilterOracle(
     , default_type_(blockchain::internal::DefaultFilter(type))
     , header_requests_(api_)
     , outstanding_filters_(api_)
+    , rescan_(
+          api_,
+          database_,
+          network_.HeaderOracle(),
+          std::thread::hardware_concurrency(),
+          rescan_batch_)
 {
     init_executor({shutdown, api.Endpoints().BlockchainReorg()});
 }
@@ -534,6 +545,7 @@ auto FilterOracle::process_cfilter(const zmq::Message& in) noexcept -> void
         }
 
         database_.SetFilterTip(type, position);
+        rescan_.Update();
         LogNormal(blockchain::internal::DisplayString(network_.Chain()))(
             " filter chain updated to height ")(header.Height())
             .Flush();
@@ -589,6 +601,17 @@ auto FilterOracle::process_reorg(const zmq::Message& in) noexcept -> void
     request();
 }
 
+auto FilterOracle::Rescan(
+    const api::client::blockchain::HD& account,
+    const RescanCallback cb) const noexcept -> void
+{
+    rescan_.Schedule(
+        default_type_,
+        account.ID(),
+        implementation::Rescan::WalletElements(account),
+        RescanCallback{cb});
+}
+
 auto FilterOracle::request() noexcept -> bool
 {
     auto repeat = Cleanup{};
@@ -601,6 +624,8 @@ auto FilterOracle::request() noexcept -> bool
 auto FilterOracle::shutdown(std::promise<void>& promise) noexcept -> void
 {
     if (running_->Off()) {
+        rescan_.Stop();
+
         try {
             state_machine_.set_value(false);
         } catch (...) {
@@ -23,6 +23,9 @@ public:
         const ReadView previousHeader,
         const std::vector<ReadView> hashes) const noexcept final;
     void CheckBlocks() const noexcept final;
+    void Rescan(
+        const api::client::blockchain::HD& account,
+        const RescanCallback cb) const noexcept final;
 
     void Start() noexcept;
     std::shared_future<void> Shutdown() noexcept final
@@ -126,11 +129,14 @@ private:
         mutable std::map<block::pHash, Time> hashes_;
     };
 
+    static const std::size_t rescan_batch_;
+
     const internal::Network& network_;
     const internal::FilterDatabase& database_;
     const filter::Type default_type_;
     RequestQueue header_requests_;
     FilterQueue outstanding_filters_;
+    mutable implementation::Rescan rescan_;
 
     auto check_filters(
         const filter::Type type,
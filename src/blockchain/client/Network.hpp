@@ -29,6 +29,10 @@ class Network : virtual public internal::Network, public Executor<Network>
 public:
     bool AddPeer(const p2p::Address& address) const noexcept final;
     Type Chain() const noexcept final { return chain_; }
+    const internal::FilterOracle& FilterOracle() const noexcept final
+    {
+        return filters_;
+    }
     ChainHeight GetConfirmations(const std::string& txid) const noexcept final;
     ChainHeight GetHeight() const noexcept final
     {
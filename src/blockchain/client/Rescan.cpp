@@ -0,0 +1,322 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "Internal.hpp"
+
+#include "opentxs/api/client/blockchain/BalanceNode.hpp"
+#include "opentxs/api/client/blockchain/HD.hpp"
+#include "opentxs/api/Core.hpp"
+#include "opentxs/blockchain/client/HeaderOracle.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Log.hpp"
+
+#include "internal/blockchain/Blockchain.hpp"
+
+#include <algorithm>
+#include <future>
+
+#include "Rescan.hpp"
+
+#define OT_METHOD "opentxs::blockchain::client::implementation::Rescan::"
+
+namespace opentxs::blockchain::client::implementation
+{
+Rescan::Rescan(
+    const api::Core& api,
+    const internal::FilterDatabase& database,
+    const client::HeaderOracle& headers,
+    const unsigned int threads,
+    const std::size_t batch) noexcept
+    : api_(api)
+    , database_(database)
+    , headers_(headers)
+    , threads_(std::max(1u, threads))
+    , batch_(std::max(std::size_t{1}, batch))
+    , lock_()
+    , stop_(false)
+    , context_()
+    , jobs_lock_()
+    , jobs_()
+    , queue_()
+    , dispatching_(false)
+    , dispatcher_()
+{
+}
+
+auto Rescan::dispatch() noexcept -> void
+{
+    Lock lock(jobs_lock_);
+
+    while ((false == queue_.empty()) && (false == stop_.load())) {
+        auto key = queue_.front();
+        queue_.pop_front();
+        const auto it = jobs_.find(key);
+
+        if (jobs_.end() == it) { continue; }
+
+        // Schedule may replace the job while it runs
+        const auto job = it->second;
+        lock.unlock();
+        Run(job.type_, key, job.elements_, job.cb_);
+        lock.lock();
+    }
+
+    dispatching_ = false;
+}
+
+auto Rescan::enqueue(const Lock& lock, const Identifier& key) noexcept -> void
+{
+    OT_ASSERT(lock.owns_lock());
+
+    if (stop_.load()) { return; }
+
+    const auto queued = std::find_if(
+        queue_.begin(), queue_.end(), [&](const auto& item) {
+            return item.get() == key;
+        });
+
+    if (queue_.end() == queued) { queue_.emplace_back(key); }
+
+    if (dispatching_) { return; }
+
+    // The previous dispatcher released jobs_lock_ after it stopped
+    if (dispatcher_.joinable()) { dispatcher_.join(); }
+
+    dispatching_ = true;
+    dispatcher_ = std::thread(&Rescan::dispatch, this);
+}
+
+auto Rescan::Run(
+    const filter::Type type,
+    const Identifier& key,
+    const Elements& elements,
+    const Callback& cb) const noexcept -> block::Position
+{
+    Lock lock(lock_);
+    auto current = start_position(type, key);
+
+    if (elements.empty()) { return current; }
+
+    const auto window = static_cast<block::Height>(threads_ * batch_);
+    auto work = std::unique_ptr<boost::asio::io_context::work>{};
+    auto workers = std::vector<std::thread>{};
+
+    while (false == stop_.load()) {
+        const auto target = std::min(
+            database_.FilterTip(type).first, headers_.BestChain().first);
+
+        if (current.first >= target) { break; }
+
+        if (workers.empty()) {
+            const auto blocks =
+                static_cast<std::size_t>(target - current.first);
+            const auto batches = (blocks + batch_ - 1) / batch_;
+            context_.restart();
+            work = std::make_unique<boost::asio::io_context::work>(context_);
+
+            for (std::size_t i{0}; i < std::min(threads_, batches); ++i) {
+                workers.emplace_back([this] { context_.run(); });
+            }
+        }
+
+        const auto start = current.first + 1;
+        const auto stop = std::min(target, current.first + window);
+        auto jobs = std::vector<std::pair<block::Height, std::future<Chunk>>>{};
+
+        for (auto first{start}; first <= stop;
+             first += static_cast<block::Height>(batch_)) {
+            const auto last = std::min(
+                stop, first + static_cast<block::Height>(batch_) - 1);
+            auto task = std::make_shared<std::packaged_task<Chunk()>>(
+                [this, type, &elements, first, last] {
+                    return scan(type, elements, first, last);
+                });
+            jobs.emplace_back(last, task->get_future());
+            boost::asio::post(context_, [task] { (*task)(); });
+        }
+
+        auto matches = Matches{};
+        auto complete{current};
+        auto interrupted{false};
+
+        // Every job must finish before returning since the tasks refer to
+        // elements
+        for (auto& [last, future] : jobs) {
+            auto chunk = future.get();
+
+            if (interrupted) { continue; }
+
+            if (chunk.last_.first > complete.first) {
+                std::move(
+                    chunk.matches_.begin(),
+                    chunk.matches_.end(),
+                    std::back_inserter(matches));
+                complete = std::move(chunk.last_);
+            }
+
+            interrupted = (complete.first != last);
+        }
+
+        if (false == matches.empty()) { cb(matches); }
+
+        if (complete.first > current.first) {
+            if (false == database_.SetRescanTip(type, key, complete)) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed to save rescan progress")
+                    .Flush();
+            }
+
+            current = std::move(complete);
+        }
+
+        if (interrupted) { break; }
+    }
+
+    work.reset();
+
+    for (auto& worker : workers) { worker.join(); }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Rescan complete to height ")(
+        current.first)
+        .Flush();
+
+    return current;
+}
+
+auto Rescan::scan(
+    const filter::Type type,
+    const Elements& elements,
+    const block::Height first,
+    const block::Height last) const noexcept -> Chunk
+{
+    auto output = Chunk{{first - 1, make_blank<block::pHash>::value(api_)}};
+    auto hashes = std::vector<block::pHash>{};
+    auto views = std::vector<ReadView>{};
+    hashes.reserve(static_cast<std::size_t>(last - first + 1));
+
+    for (auto height{first}; height <= last; ++height) {
+        auto hash = headers_.BestHash(height);
+
+        if (hash->IsNull()) { break; }
+
+        hashes.emplace_back(std::move(hash));
+    }
+
+    views.reserve(hashes.size());
+    std::transform(
+        hashes.begin(),
+        hashes.end(),
+        std::back_inserter(views),
+        [](const auto& hash) { return hash->Bytes(); });
+    auto height{first};
+    // The filters are matched in place inside the read transaction so the
+    // serialized filters are never copied out of the database
+    const auto visit = [&](const auto i, const auto& filter) -> bool {
+        if (stop_.load()) { return false; }
+
+        if (false == bool(filter)) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": Filter for block ")(height)(
+                " not available")
+                .Flush();
+
+            return false;
+        }
+
+        const auto& hash = hashes.at(i);
+
+        if (filter.Test(elements)) {
+            output.matches_.emplace_back(height, hash);
+        }
+
+        output.last_ = block::Position{height++, hash};
+
+        return true;
+    };
+    database_.ReadFilters(type, views, visit);
+
+    return output;
+}
+
+auto Rescan::Schedule(
+    const filter::Type type,
+    const Identifier& key,
+    Elements&& elements,
+    Callback&& cb) noexcept -> void
+{
+    Lock lock(jobs_lock_);
+    jobs_[key] = Job{type, std::move(elements), std::move(cb)};
+    enqueue(lock, key);
+}
+
+auto Rescan::start_position(const filter::Type type, const Identifier& key)
+    const noexcept -> block::Position
+{
+    const auto saved = database_.RescanTip(type, key);
+
+    if (0 > saved.first) { return saved; }
+
+    // A reorg may have removed the saved position from the best chain
+    return headers_.CommonParent(saved).first;
+}
+
+auto Rescan::Stop() noexcept -> void { stop_.store(true); }
+
+auto Rescan::Update() noexcept -> void
+{
+    Lock lock(jobs_lock_);
+
+    for (const auto& [key, job] : jobs_) { enqueue(lock, key); }
+}
+
+auto Rescan::WalletElements(const api::client::blockchain::HD& account)
+    -> Elements
+{
+    auto output = Elements{};
+
+    for (const auto subchain : {Subchain::Internal, Subchain::External}) {
+        const auto generated = account.LastGenerated(subchain);
+
+        if (false == generated.has_value()) { continue; }
+
+        for (Bip32Index i{0}; i <= generated.value(); ++i) {
+            try {
+                const auto hash =
+                    account.BalanceElement(subchain, i).PubkeyHash();
+                // P2PKH
+                auto p2pkh = Data::Factory();
+                p2pkh += std::uint8_t{0x76};
+                p2pkh += std::uint8_t{0xa9};
+                p2pkh += static_cast<std::uint8_t>(hash->size());
+                p2pkh += hash;
+                p2pkh += std::uint8_t{0x88};
+                p2pkh += std::uint8_t{0xac};
+                output.emplace_back(std::move(p2pkh));
+                // P2WPKH
+                auto p2wpkh = Data::Factory();
+                p2wpkh += std::uint8_t{0x00};
+                p2wpkh += static_cast<std::uint8_t>(hash->size());
+                p2wpkh += hash;
+                output.emplace_back(std::move(p2wpkh));
+            } catch (...) {
+                break;
+            }
+        }
+    }
+
+    return output;
+}
+
+Rescan::~Rescan()
+{
+    Stop();
+    Lock lock(jobs_lock_);
+    auto dispatcher = std::move(dispatcher_);
+    lock.unlock();
+
+    if (dispatcher.joinable()) { dispatcher.join(); }
+}
+}  // namespace opentxs::blockchain::client::implementation
@@ -0,0 +1,120 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "internal/blockchain/client/Client.hpp"
+
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opentxs::blockchain::client::implementation
+{
+/** Matches stored compact filters against the elements of each subaccount
+ *
+ *  Every subaccount has its own saved rescan position, so a subaccount
+ *  imported after other rescans have finished is still checked from the
+ *  beginning of the chain. The height range between the saved position and
+ *  the filter tip is split into windows of threads * batch blocks. Each
+ *  window is checked in parallel and the saved position advances only after
+ *  every block in the window has been checked, so an interrupted rescan
+ *  resumes from the last complete window.
+ *
+ *  Worker threads only exist while a rescan is running.
+ */
+class Rescan
+{
+public:
+    using Elements = std::vector<OTData>;
+    using Matches = internal::FilterOracle::Matches;
+    using Callback = internal::FilterOracle::RescanCallback;
+
+    /// P2PKH and P2WPKH output scripts for every generated key in the account
+    static auto WalletElements(const api::client::blockchain::HD& account)
+        -> Elements;
+
+    /// Blocks until every stored filter has been checked for key
+    auto Run(
+        const filter::Type type,
+        const Identifier& key,
+        const Elements& elements,
+        const Callback& cb) const noexcept -> block::Position;
+    /// Registers the elements for key and rescans them in the background
+    auto Schedule(
+        const filter::Type type,
+        const Identifier& key,
+        Elements&& elements,
+        Callback&& cb) noexcept -> void;
+    auto Stop() noexcept -> void;
+    /// Rescans every registered subaccount after new filters were stored
+    auto Update() noexcept -> void;
+
+    Rescan(
+        const api::Core& api,
+        const internal::FilterDatabase& database,
+        const client::HeaderOracle& headers,
+        const unsigned int threads,
+        const std::size_t batch) noexcept;
+
+    ~Rescan();
+
+private:
+    struct Chunk {
+        Matches matches_;
+        // the highest position for which every filter was checked
+        block::Position last_;
+
+        Chunk(const block::Position& last) noexcept
+            : matches_()
+            , last_(last)
+        {
+        }
+    };
+
+    struct Job {
+        filter::Type type_;
+        Elements elements_;
+        Callback cb_;
+    };
+
+    const api::Core& api_;
+    const internal::FilterDatabase& database_;
+    const client::HeaderOracle& headers_;
+    const std::size_t threads_;
+    const std::size_t batch_;
+    mutable std::mutex lock_;
+    std::atomic<bool> stop_;
+    mutable boost::asio::io_context context_;
+    std::mutex jobs_lock_;
+    std::map<OTIdentifier, Job> jobs_;
+    std::deque<OTIdentifier> queue_;
+    bool dispatching_;
+    std::thread dispatcher_;
+
+    auto dispatch() noexcept -> void;
+    auto enqueue(const Lock& lock, const Identifier& key) noexcept -> void;
+    auto scan(
+        const filter::Type type,
+        const Elements& elements,
+        const block::Height first,
+        const block::Height last) const noexcept -> Chunk;
+    auto start_position(const filter::Type type, const Identifier& key) const
+        noexcept -> block::Position;
+
+    Rescan() = delete;
+    Rescan(const Rescan&) = delete;
+    Rescan(Rescan&&) = delete;
+    Rescan& operator=(const Rescan&) = delete;
+    Rescan& operator=(Rescan&&) = delete;
+};
+}  // namespace opentxs::blockchain::client::implementation
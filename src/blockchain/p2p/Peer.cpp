@@ -29,6 +29,9 @@
 #define OT_BLOCKCHAIN_PEER_PING_SECONDS 30
 #define OT_BLOCKCHAIN_PEER_DISCONNECT_SECONDS 40
 #define OT_BLOCKCHAIN_PEER_DOWNLOAD_ADDRESSES_MINUTES 10
+#define OT_BLOCKCHAIN_PEER_SEND_BATCH_BYTES 65536
+#define OT_BLOCKCHAIN_PEER_SEND_BATCH_MESSAGES 64
+#define OT_BLOCKCHAIN_PEER_SEND_QUEUE_BYTES 67108864
 
 #define OT_METHOD "opentxs::blockchain::p2p::implementation::Peer::"
 
@@ -51,11 +54,8 @@ Peer::Peer(
     , manager_(manager)
     , endpoint_(
           make_endpoint(address->Type(), address->Bytes(), address->Port()))
-    , send_promise_()
-    , send_future_(send_promise_.get_future())
     , address_(std::move(address))
     , download_peers_()
-    , header_(make_buffer(headerSize))
     , outgoing_handshake_(false)
     , incoming_handshake_(false)
     , subscribe_()
@@ -64,7 +64,7 @@ Peer::Peer(
     , connection_id_()
     , shutdown_endpoint_(shutdown)
     , context_(context)
-    , socket_(context_.operator boost::asio::io_context&())
+    , socket_(context_.Attach())
     , outgoing_message_(Data::Factory())
     , connection_id_promise_()
     , connection_promise_()
@@ -72,6 +72,10 @@ Peer::Peer(
     , handshake_promise_()
     , handshake_(handshake_promise_.get_future())
     , send_promises_()
+    , send_queue_(
+          OT_BLOCKCHAIN_PEER_SEND_BATCH_BYTES,
+          OT_BLOCKCHAIN_PEER_SEND_BATCH_MESSAGES,
+          OT_BLOCKCHAIN_PEER_SEND_QUEUE_BYTES)
     , activity_()
     , state_(State::Handshake)
     , cb_(zmq::ListenCallback::Factory([&](auto& in) { pipeline_d(in); }))
@@ -258,7 +262,7 @@ auto Peer::break_promises() noexcept -> void
 {
     handshake_promise_ = {};
     connection_promise_ = {};
-    send_promise_ = {};
+    send_queue_.Stop();
     send_promises_.Break();
 }
 
@@ -353,12 +357,6 @@ auto Peer::handshake() noexcept -> void
 
 auto Peer::init() noexcept -> void { connect(); }
 
-auto Peer::init_send_promise() noexcept -> void
-{
-    send_promise_ = SendPromise{};
-    send_future_ = send_promise_.get_future();
-}
-
 auto Peer::local_endpoint() noexcept -> tcp::socket::endpoint_type
 {
     try {
@@ -369,14 +367,6 @@ auto Peer::local_endpoint() noexcept -> tcp::socket::endpoint_type
     }
 }
 
-auto Peer::make_buffer(const std::size_t size) noexcept -> OTData
-{
-    auto output = Data::Factory();
-    output->SetSize(size);
-
-    return output;
-}
-
 auto Peer::make_endpoint(
     const Network type,
     const Data& raw,
@@ -442,8 +432,8 @@ auto Peer::pipeline(zmq::Message& message) noexcept -> void
         case Task::Heartbeat: {
             Trigger();
         } break;
-        case Task::SendMessage: {
-            transmit(message);
+        case Task::Disconnect: {
+            disconnect();
         } break;
         case Task::ReceiveMessage: {
             process_message(message);
@@ -494,38 +484,8 @@ auto Peer::pipeline_d(zmq::Message& message) noexcept -> void
         case Task::Disconnect: {
             disconnect();
         } break;
-        case Task::Header: {
-            const auto body = message.Body();
-
-            OT_ASSERT(0 < body.size());
-
-            const auto& messageHeader = body.at(0);
+        case Task::ReceiveMessage: {
             activity_.Bump();
-            const auto size = get_body_size(messageHeader);
-
-            if (0 < size) {
-                header_->Assign(messageHeader.Bytes());
-                context_.Receive(
-                    connection_id_,
-                    static_cast<OTZMQWorkType>(Task::Body),
-                    size,
-                    socket_);
-            } else {
-                auto message = MakeWork(Task::ReceiveMessage);
-                message->AddFrame(messageHeader);
-                message->AddFrame();
-                pipeline_->Push(message);
-                run();
-            }
-        } break;
-        case Task::Body: {
-            const auto body = message.Body();
-
-            OT_ASSERT(0 < body.size());
-
-            auto message = MakeWork(Task::ReceiveMessage);
-            message->AddFrame(header_);
-            message->AddFrame(body.at(0));
             pipeline_->Push(message);
             run();
         } break;
@@ -552,8 +512,9 @@ auto Peer::run() noexcept -> void
     if (running_.get()) {
         context_.Receive(
             connection_id_,
-            static_cast<OTZMQWorkType>(Task::Header),
+            static_cast<OTZMQWorkType>(Task::ReceiveMessage),
             header_bytes_,
+            [this](const auto& header) { return get_body_size(header); },
             socket_);
     }
 }
@@ -574,10 +535,16 @@ auto Peer::send(OTData in) noexcept -> SendStatus
 
     if (running_.get()) {
         auto [future, promise] = send_promises_.NewPromise();
-        auto message = MakeWork(Task::SendMessage);
-        message->AddFrame(in);
-        message->AddFrame(Data::Factory(&promise, sizeof(promise)));
-        pipeline_->Push(message);
+        auto start{false};
+
+        if (send_queue_.Push(std::move(in), promise, start)) {
+            if (start) {
+                asio::post(socket_.get_executor(), [this] { write(); });
+            }
+        } else {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Send queue is full").Flush();
+            send_promises_.SetPromise(promise, false);
+        }
 
         return std::move(future);
     } else {
@@ -669,95 +636,60 @@ void Peer::subscribe_work() noexcept
     }
 }
 
-auto Peer::transmit(zmq::Message& message) noexcept -> void
+auto Peer::update_address_activity() noexcept -> void
 {
-    if (false == running_.get()) { return; }
-
-    struct Cleanup {
-        Cleanup(const bool& sucess, const zmq::Frame& frame, Peer& parent)
-            : success_(sucess)
-            , parent_(parent)
-            , index_(0)
-        {
-            OT_ASSERT(sizeof(index_) == frame.size());
+    manager_.Database().AddOrUpdate(address_.UpdateTime(activity_.get()));
+}
 
-            std::memcpy(&index_, frame.data(), frame.size());
-        }
+auto Peer::update_address_services(
+    const std::set<p2p::Service>& services) noexcept -> void
+{
+    manager_.Database().AddOrUpdate(address_.UpdateServices(services));
+}
 
-        ~Cleanup() { parent_.send_promises_.SetPromise(index_, success_); }
+auto Peer::write() noexcept -> void
+{
+    auto batch = std::make_shared<SendQueue::Batch>();
 
-    private:
-        const bool& success_;
-        Peer& parent_;
-        int index_;
-    };
+    if (false == send_queue_.Next(*batch)) { return; }
 
-    if (2 < message.Body().size()) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid message").Flush();
+    auto buffers = std::vector<asio::const_buffer>{};
+    buffers.reserve(batch->size());
 
-        return;
+    for (const auto& [message, promise] : *batch) {
+        buffers.emplace_back(asio::buffer(message->data(), message->size()));
     }
 
-    const auto& payload = message.Body_at(0);
-    const auto& promiseFrame = message.Body_at(1);
-    auto success = bool{false};
-    const Cleanup cleanup{success, promiseFrame, *this};
-    LogTrace(OT_METHOD)(__FUNCTION__)(": Sending ")(payload.size())(
-        " byte message:")
-        .Flush();
-    LogTrace(Data::Factory(message.at(0))->asHex()).Flush();
-    init_send_promise();
-    auto work = [this, &payload]() -> void {
-        auto cb = [this](auto& error, auto bytes) -> void {
-            try {
-                this->send_promise_.set_value({error, bytes});
-            } catch (...) {
-            }
-        };
-        asio::async_write(
-            this->socket_, asio::buffer(payload.data(), payload.size()), cb);
-    };
+    asio::async_write(
+        socket_, buffers, [this, batch](const auto& error, auto bytes) {
+            const auto success = (false == bool(error));
 
-    auto& asio = context_.operator boost::asio::io_context&();
-    asio.post(work);
-    auto result = SendResult{};
-
-    try {
-        while (running_.get()) {
-            const auto status =
-                send_future_.wait_for(std::chrono::milliseconds(5));
-
-            if (std::future_status::ready == status) {
-                result = send_future_.get();
-                break;
+            for (const auto& [message, promise] : *batch) {
+                send_promises_.SetPromise(promise, success);
             }
-        }
-    } catch (...) {
-        return;
-    }
 
-    const auto& [error, bytes] = result;
+            if (success) {
+                LogTrace(OT_METHOD)(__FUNCTION__)(": Sent ")(batch->size())(
+                    " messages (")(bytes)(" bytes)")
+                    .Flush();
+            } else {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": ")(error.message())
+                    .Flush();
+                send_queue_.Stop();
 
-    if (error) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(error.message()).Flush();
-        success = false;
-        disconnect();
-    } else {
-        LogVerbose(OT_METHOD)(__FUNCTION__)(": Sent ")(bytes)(" bytes").Flush();
-        success = true;
-    }
-}
+                if (running_.get()) {
+                    pipeline_->Push(MakeWork(Task::Disconnect));
+                }
+            }
 
-auto Peer::update_address_activity() noexcept -> void
-{
-    manager_.Database().AddOrUpdate(address_.UpdateTime(activity_.get()));
+            write();
+        });
 }
 
-auto Peer::update_address_services(
-    const std::set<p2p::Service>& services) noexcept -> void
+Peer::~Peer()
 {
-    manager_.Database().AddOrUpdate(address_.UpdateServices(services));
+    Shutdown().get();
+    send_queue_.Wait();
+    context_.Detach(socket_);
 }
-
-Peer::~Peer() { Shutdown().get(); }
 }  // namespace opentxs::blockchain::p2p::implementation
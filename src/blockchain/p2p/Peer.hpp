@@ -19,6 +19,8 @@
 #include "internal/blockchain/client/Client.hpp"
 #include "internal/blockchain/p2p/P2P.hpp"
 
+#include "SendQueue.hpp"
+
 #include <boost/asio.hpp>
 
 #include <atomic>
@@ -46,9 +48,6 @@ public:
     ~Peer() override;
 
 protected:
-    using SendResult = std::pair<boost::system::error_code, std::size_t>;
-    using SendPromise = std::promise<SendResult>;
-    using SendFuture = std::future<SendResult>;
     using Task = client::internal::PeerManager::Task;
 
     struct Address {
@@ -97,11 +96,8 @@ protected:
     const client::internal::Network& network_;
     const client::internal::PeerManager& manager_;
     const tcp::endpoint endpoint_;
-    SendPromise send_promise_;
-    SendFuture send_future_;
     Address address_;
     DownloadPeers download_peers_;
-    OTData header_;
     bool outgoing_handshake_;
     bool incoming_handshake_;
     Subscriptions subscribe_;
@@ -178,12 +174,12 @@ private:
     std::promise<void> handshake_promise_;
     Handshake handshake_;
     SendPromises send_promises_;
+    SendQueue send_queue_;
     Activity activity_;
     mutable std::atomic<State> state_;
     OTZMQListenCallback cb_;
     OTZMQDealerSocket dealer_;
 
-    static OTData make_buffer(const std::size_t size) noexcept;
     static tcp::endpoint make_endpoint(
         const Network type,
         const Data& bytes,
@@ -198,7 +194,6 @@ private:
     void check_download_peers() noexcept;
     void connect() noexcept;
     void handshake() noexcept;
-    void init_send_promise() noexcept;
     void pipeline(zmq::Message& message) noexcept;
     void pipeline_d(zmq::Message& message) noexcept;
     virtual void process_message(const zmq::Message& message) noexcept = 0;
@@ -209,8 +204,8 @@ private:
     void shutdown(std::promise<void>& promise) noexcept;
     virtual void start_handshake() noexcept = 0;
     void subscribe_work() noexcept;
-    void transmit(zmq::Message& message) noexcept;
     void update_address_activity() noexcept;
+    void write() noexcept;
 
     Peer() = delete;
     Peer(const Peer&) = delete;
@@ -0,0 +1,91 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "Internal.hpp"
+
+#include "SendQueue.hpp"
+
+namespace opentxs::blockchain::p2p::implementation
+{
+SendQueue::SendQueue(
+    const std::size_t batchBytes,
+    const std::size_t batchMessages,
+    const std::size_t queueBytes) noexcept
+    : batch_bytes_(batchBytes)
+    , batch_messages_(batchMessages)
+    , queue_bytes_(queueBytes)
+    , lock_()
+    , idle_()
+    , queue_()
+    , bytes_(0)
+    , writing_(false)
+    , running_(true)
+{
+}
+
+auto SendQueue::Next(Batch& batch) noexcept -> bool
+{
+    Lock lock(lock_);
+    auto bytes = std::size_t{0};
+
+    while (running_ && (false == queue_.empty())) {
+        auto& next = queue_.front();
+        const auto size = next.first->size();
+        const auto full = (batch_bytes_ < (bytes + size)) ||
+                          (batch_messages_ <= batch.size());
+
+        if ((false == batch.empty()) && full) { break; }
+
+        bytes += size;
+        bytes_ -= size;
+        batch.emplace_back(std::move(next));
+        queue_.pop_front();
+    }
+
+    if (batch.empty()) {
+        writing_ = false;
+        idle_.notify_all();
+
+        return false;
+    }
+
+    return true;
+}
+
+auto SendQueue::Push(OTData message, const int promise, bool& start) noexcept
+    -> bool
+{
+    Lock lock(lock_);
+
+    if (false == running_) { return false; }
+
+    const auto size = message->size();
+
+    if ((0 < bytes_) && (queue_bytes_ < (bytes_ + size))) { return false; }
+
+    queue_.emplace_back(std::move(message), promise);
+    bytes_ += size;
+    start = (false == writing_);
+    writing_ = true;
+
+    return true;
+}
+
+auto SendQueue::Stop() noexcept -> void
+{
+    Lock lock(lock_);
+    running_ = false;
+    queue_.clear();
+    bytes_ = 0;
+}
+
+auto SendQueue::Wait() noexcept -> void
+{
+    Lock lock(lock_);
+    idle_.wait(lock, [this] { return false == writing_; });
+}
+}  // namespace opentxs::blockchain::p2p::implementation
@@ -0,0 +1,62 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "opentxs/core/Data.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace opentxs::blockchain::p2p::implementation
+{
+// Outgoing messages waiting to be written to a peer socket
+class SendQueue
+{
+public:
+    using Item = std::pair<OTData, int>;
+    using Batch = std::vector<Item>;
+
+    // Returns false if the message would exceed the queue size limit. A
+    // message is always accepted by an empty queue, whatever its size.
+    auto Push(OTData message, const int promise, bool& start) noexcept
+        -> bool;
+    // Moves the next batch of messages, up to the batch limits, into the
+    // argument. A message larger than the batch byte limit is sent alone.
+    //
+    // Returns false and marks the queue idle if nothing is queued
+    auto Next(Batch& batch) noexcept -> bool;
+    auto Stop() noexcept -> void;
+    auto Wait() noexcept -> void;
+
+    SendQueue(
+        const std::size_t batchBytes,
+        const std::size_t batchMessages,
+        const std::size_t queueBytes) noexcept;
+
+private:
+    const std::size_t batch_bytes_;
+    const std::size_t batch_messages_;
+    const std::size_t queue_bytes_;
+    std::mutex lock_;
+    std::condition_variable idle_;
+    std::deque<Item> queue_;
+    std::size_t bytes_;
+    bool writing_;
+    bool running_;
+
+    SendQueue() = delete;
+    SendQueue(const SendQueue&) = delete;
+    SendQueue(SendQueue&&) = delete;
+    SendQueue& operator=(const SendQueue&) = delete;
+    SendQueue& operator=(SendQueue&&) = delete;
+};
+}  // namespace opentxs::blockchain::p2p::implementation
@@ -21,6 +21,9 @@
 #include <zconf.h>
 #include <zlib.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
@@ -45,6 +48,16 @@ const char* OT_END_ARMORED_escaped = "- -----END OT ARMORED";
 const char* OT_BEGIN_SIGNED = "-----BEGIN SIGNED";
 const char* OT_BEGIN_SIGNED_escaped = "- -----BEGIN SIGNED";
 
+static std::atomic<std::int32_t> compression_level_{Z_DEFAULT_COMPRESSION};
+
+std::int32_t Armored::CompressionLevel() { return compression_level_.load(); }
+
+void Armored::SetCompressionLevel(const std::int32_t level)
+{
+    compression_level_.store(
+        std::max(Z_DEFAULT_COMPRESSION, std::min(level, Z_BEST_COMPRESSION)));
+}
+
 OTArmored Armored::Factory()
 {
     return OTArmored(new implementation::Armored());
@@ -175,52 +188,43 @@ Armored& Armored::operator=(const Armored& strValue)
 
 Armored* Armored::clone() const { return new Armored(*this); }
 
-// Source for these two functions: http://panthema.net/2007/0328-ZLibString.html
-/** Compress a STL string using zlib with given compression level and return
- * the binary data. */
-std::string Armored::compress_string(
-    const std::string& str,
-    std::int32_t compressionlevel = Z_BEST_COMPRESSION) const
+// Originally based on: http://panthema.net/2007/0328-ZLibString.html
+/** Compress a buffer using zlib with given compression level into output.
+ * The output is sized with deflateBound so the whole input is compressed by a
+ * single call, without intermediate blocks. */
+void Armored::compress_string(
+    const char* input,
+    const std::size_t size,
+    const std::int32_t level,
+    std::string& output)
 {
     z_stream zs;  // z_stream is zlib's control structure
     memset(&zs, 0, sizeof(zs));
 
-    if (deflateInit(&zs, compressionlevel) != Z_OK)
+    if (deflateInit(&zs, level) != Z_OK)
         throw(std::runtime_error("deflateInit failed while compressing."));
 
-    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(str.data()));
-    zs.avail_in = static_cast<uInt>(str.size());  // set the z_stream's input
-
-    std::int32_t ret;
-    char outbuffer[32768];
-    std::string outstring;
-
-    // retrieve the compressed bytes blockwise
-    do {
-        zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
-        zs.avail_out = sizeof(outbuffer);
-
-        ret = deflate(&zs, Z_FINISH);
-
-        if (outstring.size() < zs.total_out) {
-            // append the block to the output string
-            outstring.append(outbuffer, zs.total_out - outstring.size());
-        }
-    } while (ret == Z_OK);
+    output.resize(deflateBound(&zs, static_cast<uLong>(size)));
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input));
+    zs.avail_in = static_cast<uInt>(size);
+    zs.next_out = reinterpret_cast<Bytef*>(&output[0]);
+    zs.avail_out = static_cast<uInt>(output.size());
 
+    const std::int32_t ret = deflate(&zs, Z_FINISH);
+    output.resize(zs.total_out);
     deflateEnd(&zs);
 
     if (ret != Z_STREAM_END) {  // an error occurred that was not EOF
         std::ostringstream oss;
-        oss << "Exception during zlib compression: (" << ret << ") " << zs.msg;
+        oss << "Exception during zlib compression: (" << ret << ")";
+        if (zs.msg != nullptr) { oss << " " << zs.msg; }
         throw(std::runtime_error(oss.str()));
     }
-
-    return outstring;
 }
 
-/** Decompress an STL string using zlib and return the original data. */
-std::string Armored::decompress_string(const std::string& str) const
+/** Decompress a zlib stream into output, inflating directly into the output
+ * string and growing it as needed. */
+void Armored::decompress_string(const std::string& input, std::string& output)
 {
     z_stream zs;  // z_stream is zlib's control structure
     memset(&zs, 0, sizeof(zs));
@@ -228,26 +232,22 @@ std::string Armored::decompress_string(const std::string& str) const
     if (inflateInit(&zs) != Z_OK)
         throw(std::runtime_error("inflateInit failed while decompressing."));
 
-    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(str.data()));
-    zs.avail_in = static_cast<uInt>(str.size());
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    zs.avail_in = static_cast<uInt>(input.size());
 
+    // Signed XML typically compresses about 4:1
+    output.resize(std::max(input.size() * 4, std::size_t{1024}));
     std::int32_t ret;
-    char outbuffer[32768];
-    std::string outstring;
 
-    // get the decompressed bytes blockwise using repeated calls to inflate
     do {
-        zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
-        zs.avail_out = sizeof(outbuffer);
-
-        ret = inflate(&zs, 0);
-
-        if (outstring.size() < zs.total_out) {
-            outstring.append(outbuffer, zs.total_out - outstring.size());
-        }
+        if (zs.total_out == output.size()) { output.resize(2 * output.size()); }
 
+        zs.next_out = reinterpret_cast<Bytef*>(&output[zs.total_out]);
+        zs.avail_out = static_cast<uInt>(output.size() - zs.total_out);
+        ret = inflate(&zs, Z_NO_FLUSH);
     } while (ret == Z_OK);
 
+    output.resize(zs.total_out);
     inflateEnd(&zs);
 
     if (ret != Z_STREAM_END) {  // an error occurred that was not EOF
@@ -256,8 +256,6 @@ std::string Armored::decompress_string(const std::string& str) const
         if (zs.msg != nullptr) { oss << " " << zs.msg; }
         throw(std::runtime_error(oss.str()));
     }
-
-    return outstring;
 }
 
 // Base64-decode
@@ -293,7 +291,7 @@ bool Armored::GetString(opentxs::String& strData, bool bLineBreaks) const
 
     std::string str_uncompressed;
     try {
-        str_uncompressed = decompress_string(str_decoded);
+        decompress_string(str_decoded, str_uncompressed);
     } catch (const std::runtime_error&) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": decompress failed.").Flush();
 
@@ -522,7 +520,18 @@ bool Armored::SetString(
 
     if (strData.GetLength() < 1) return true;
 
-    std::string str_compressed = compress_string(strData.Get());
+    std::string str_compressed;
+    try {
+        compress_string(
+            strData.Get(),
+            strData.GetLength(),
+            CompressionLevel(),
+            str_compressed);
+    } catch (const std::runtime_error&) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": compression failed.").Flush();
+
+        return false;
+    }
 
     // "Success"
     if (str_compressed.size() == 0) {
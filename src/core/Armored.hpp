@@ -11,7 +11,10 @@
 
 #include "String.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 
 namespace opentxs::implementation
 {
@@ -50,10 +53,14 @@ private:
     static std::unique_ptr<OTDB::OTPacker> s_pPacker;
 
     Armored* clone() const override;
-    std::string compress_string(
-        const std::string& str,
-        std::int32_t compressionlevel) const;
-    std::string decompress_string(const std::string& str) const;
+    static void compress_string(
+        const char* input,
+        const std::size_t size,
+        const std::int32_t level,
+        std::string& output);
+    static void decompress_string(
+        const std::string& input,
+        std::string& output);
 
     explicit Armored(const Data& theValue);
     explicit Armored(const opentxs::String& strValue);
@@ -36,6 +36,7 @@
 #include <cstdlib>
 #include <sys/types.h>
 #include <cstdint>
+#include <cstring>
 #include <irrxml/irrXML.hpp>
 #include <memory>
 #include <ostream>
@@ -43,6 +44,16 @@
 #include <string>
 #include <utility>
 
+// Boxes are stored as the signed contract behind this header, instead of
+// being armored and compressed. Files without it are in the legacy format,
+// which is still read but never written, so a box saved by this version can
+// not be loaded by older binaries.
+//
+// TODO: the whole box is still rewritten and re-signed when one entry
+// changes. An encoding that updates a single entry in place, with an index
+// by transaction number, is not implemented yet.
+#define OT_LEDGER_HEADER "OT LEDGER 1\n"
+
 #define OT_METHOD "opentxs::Ledger::"
 
 namespace opentxs
@@ -163,6 +174,20 @@ bool Ledger::VerifyAccount(const identity::Nym& theNym)
     return OTTransactionType::VerifyAccount(theNym);
 }
 
+// Same as VerifyAccount, except the box receipts are not loaded. They stay
+// abbreviated until LoadBoxReceipt is called for the ones actually needed,
+// so a caller that only adds a receipt and saves the box never has to read
+// every receipt already in it.
+//
+// Nothing is lost by skipping them: VerifyAccount ignores receipts which fail
+// to load or whose hash does not match the box, and leaves them abbreviated.
+// The box itself is still verified, and a receipt is checked against its
+// hash whenever LoadBoxReceipt is called for it.
+bool Ledger::VerifyAbbreviated(const identity::Nym& theNym)
+{
+    return OTTransactionType::VerifyAccount(theNym);
+}
+
 // This makes sure that ALL transactions inside the ledger are saved as box
 // receipts
 // in their full (not abbreviated) form (as separate files.)
@@ -507,8 +532,6 @@ bool Ledger::LoadGeneric(ledgerType theType, const String& pString)
         strRawFile->Set(strFileContents.c_str());
     }
 
-    // NOTE: No need to deal with OT ARMORED INBOX file format here, since
-    //       LoadContractFromString already handles that automatically.
     if (!strRawFile->Exists()) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Unable to load box (")(path1)(
             PathSeparator())(m_strFilename)(") from empty string.")
@@ -516,7 +539,16 @@ bool Ledger::LoadGeneric(ledgerType theType, const String& pString)
         return false;
     }
 
-    bool bSuccess = LoadContractFromString(strRawFile);
+    const auto headerSize = std::strlen(OT_LEDGER_HEADER);
+    bool bSuccess{false};
+
+    if (0 == std::strncmp(strRawFile->Get(), OT_LEDGER_HEADER, headerSize)) {
+        bSuccess = load_raw(strRawFile->Get() + headerSize);
+    } else {
+        // NOTE: No need to deal with OT ARMORED INBOX file format here, since
+        //       LoadContractFromString already handles that automatically.
+        bSuccess = LoadContractFromString(strRawFile);
+    }
 
     if (!bSuccess) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed loading ")(pszType)(" ")(
@@ -559,17 +591,10 @@ bool Ledger::SaveGeneric(ledgerType theType)
         return false;
     }
 
-    auto strFinal = String::Factory();
-    auto ascTemp = Armored::Factory(strRawFile);
-
-    if (false ==
-        ascTemp->WriteArmoredString(strFinal, m_strContractType->Get())) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Error saving ")(pszType)(
-            " (failed writing armored string): ")(path1)(PathSeparator())(
-            m_strFilename)
-            .Flush();
-        return false;
-    }
+    // The signed contract is already plain text, so there is no need to pay
+    // for compressing and armoring it on every save and load.
+    auto strFinal = String::Factory(OT_LEDGER_HEADER);
+    strFinal->Concatenate(strRawFile);
 
     bool bSaved = OTDB::StorePlainString(
         api_,
@@ -592,6 +617,14 @@ bool Ledger::SaveGeneric(ledgerType theType)
     return bSaved;
 }
 
+bool Ledger::load_raw(const char* raw)
+{
+    Release();
+    m_strRawFile->Set(raw);
+
+    return ParseRawFile();
+}
+
 // If you know you have an inbox, outbox, or nymbox, then call
 // CalculateInboxHash,
 // CalculateOutboxHash, or CalculateNymboxHash. Otherwise, if in doubt, call
@@ -0,0 +1,116 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "Internal.hpp"
+
+#include <algorithm>
+
+#include "LogQueue.hpp"
+
+// Records waiting for the sink beyond this many are dropped and counted
+#define OT_LOG_QUEUE_LIMIT 65536
+
+namespace opentxs::internal
+{
+LogQueue::LogQueue(const std::size_t limit) noexcept
+    : limit_(limit)
+    , head_(nullptr)
+    , queued_(0)
+    , dropped_(0)
+    , wake_lock_()
+    , wake_()
+{
+}
+
+LogQueue& LogQueue::Global() noexcept
+{
+    static auto queue = LogQueue{OT_LOG_QUEUE_LIMIT};
+
+    return queue;
+}
+
+std::uint64_t LogQueue::Dropped() noexcept { return dropped_.exchange(0); }
+
+void LogQueue::Notify() noexcept
+{
+    // Acquiring the mutex ensures the sink is either waiting or will see the
+    // queued record before it waits
+    {
+        Lock lock(wake_lock_);
+    }
+
+    wake_.notify_one();
+}
+
+bool LogQueue::Push(
+    const int level,
+    const std::string& thread,
+    const std::string& text,
+    std::promise<void>* promise) noexcept
+{
+    const auto queued = queued_.fetch_add(1);
+
+    if ((nullptr == promise) && (limit_ <= queued)) {
+        queued_.fetch_sub(1);
+        dropped_.fetch_add(1);
+
+        return false;
+    }
+
+    auto* record = new Record{};
+    record->level_ = level;
+    record->thread_ = thread;
+    record->text_ = text;
+    record->promise_ = promise;
+    // The record belongs to the sink once it is in the queue, so the previous
+    // head must be tracked separately
+    auto* head = head_.load(std::memory_order_relaxed);
+
+    do {
+        record->next_ = head;
+    } while (false == head_.compare_exchange_weak(
+                          head, record, std::memory_order_release));
+
+    // Only the record which makes the queue non-empty needs to wake the sink.
+    // Later records are picked up in the same batch.
+    if (nullptr == head) { Notify(); }
+
+    return true;
+}
+
+LogQueue::Batch LogQueue::Take(const std::chrono::milliseconds& wait) noexcept
+{
+    auto* head = head_.exchange(nullptr, std::memory_order_acquire);
+
+    if (nullptr == head) {
+        Lock lock(wake_lock_);
+
+        if (nullptr == head_.load(std::memory_order_relaxed)) {
+            wake_.wait_for(lock, wait);
+        }
+
+        lock.unlock();
+        head = head_.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    auto output = Batch{};
+
+    while (nullptr != head) {
+        auto* next = head->next_;
+        output.emplace_back(head);
+        head = next;
+    }
+
+    // Records were pushed onto the front of the queue
+    std::reverse(output.begin(), output.end());
+    queued_.fetch_sub(output.size());
+
+    return output;
+}
+
+LogQueue::~LogQueue() { Take(std::chrono::milliseconds(0)); }
+}  // namespace opentxs::internal
@@ -0,0 +1,80 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace opentxs::internal
+{
+/** Hands flushed log records from any number of threads to the log sink
+ *
+ *  Records are pushed onto a lock-free stack. The sink takes the whole stack
+ *  at once, so pushing never waits for the sink to print.
+ */
+class LogQueue
+{
+public:
+    struct Record {
+        Record* next_{nullptr};
+        int level_{-1};
+        std::string thread_{};
+        std::string text_{};
+        std::promise<void>* promise_{nullptr};
+    };
+
+    using Batch = std::vector<std::unique_ptr<Record>>;
+
+    /** The queue shared by LogSource and api::implementation::Log */
+    static LogQueue& Global() noexcept;
+
+    /** Returns the number of records dropped since the previous call */
+    std::uint64_t Dropped() noexcept;
+    /** Wakes a sink which is waiting in Take */
+    void Notify() noexcept;
+    /** Queues a copy of the text
+     *
+     *  Once the limit is reached further records are dropped and counted,
+     *  unless a promise is provided. The sink sets the promise after it
+     *  prints the record.
+     *
+     *  \returns false if the record was dropped
+     */
+    bool Push(
+        const int level,
+        const std::string& thread,
+        const std::string& text,
+        std::promise<void>* promise = nullptr) noexcept;
+    /** Takes every queued record in the order they were pushed, waiting up
+     *  to the specified time if the queue is empty */
+    Batch Take(const std::chrono::milliseconds& wait) noexcept;
+
+    LogQueue(const std::size_t limit) noexcept;
+
+    ~LogQueue();
+
+private:
+    const std::size_t limit_;
+    std::atomic<Record*> head_;
+    std::atomic<std::size_t> queued_;
+    std::atomic<std::uint64_t> dropped_;
+    std::mutex wake_lock_;
+    std::condition_variable wake_;
+
+    LogQueue() = delete;
+    LogQueue(const LogQueue&) = delete;
+    LogQueue(LogQueue&&) = delete;
+    LogQueue& operator=(const LogQueue&) = delete;
+    LogQueue& operator=(LogQueue&&) = delete;
+};
+}  // namespace opentxs::internal
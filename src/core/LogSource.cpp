@@ -16,10 +16,6 @@
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/StringXML.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
-#include "opentxs/network/zeromq/socket/Sender.tpp"
-#include "opentxs/network/zeromq/Context.hpp"
-#include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/OT.hpp"
 
 #include <boost/stacktrace.hpp>
@@ -28,9 +24,10 @@
 #include <future>
 #include <sstream>
 
-#define LOG_SINK "inproc://opentxs/logsink/1"
+#include "LogQueue.hpp"
 
-namespace zmq = opentxs::network::zeromq;
+// Initial capacity of each thread's formatting buffer
+#define OT_LOG_BUFFER_RESERVE 1024
 
 namespace opentxs
 {
@@ -42,10 +39,36 @@ std::string stack_trace() noexcept
     return output.str();
 }
 
+class LogSource::Buffer
+{
+public:
+    const std::string thread_;
+    std::string text_;
+
+    Buffer() noexcept
+        : thread_(thread_id())
+        , text_()
+    {
+        text_.reserve(OT_LOG_BUFFER_RESERVE);
+    }
+
+private:
+    static std::string thread_id() noexcept
+    {
+        std::stringstream convert{};
+        convert << std::hex << std::this_thread::get_id();
+
+        return convert.str();
+    }
+
+    Buffer(const Buffer&) = delete;
+    Buffer(Buffer&&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+    Buffer& operator=(Buffer&&) = delete;
+};
+
 std::atomic<int> LogSource::verbosity_{0};
 std::atomic<bool> LogSource::running_{true};
-std::mutex LogSource::buffer_lock_{};
-std::map<std::thread::id, LogSource::Source> LogSource::buffer_{};
 
 LogSource::LogSource(const int logLevel) noexcept
     : level_(logLevel)
@@ -61,11 +84,9 @@ const LogSource& LogSource::operator()(char* in) const noexcept
 
 const LogSource& LogSource::operator()(const char* in) const noexcept
 {
-    if (verbosity_.load() < level_) { return *this; }
+    if (false == active()) { return *this; }
 
-    std::string id{};
-
-    if (running_.load()) { std::get<1>(get_buffer(id)) << in; }
+    if (running_.load() && (nullptr != in)) { get_buffer().text_ += in; }
 
     return *this;
 }
@@ -112,6 +133,8 @@ const LogSource& LogSource::operator()(const OTIdentifier& in) const noexcept
 
 const LogSource& LogSource::operator()(const Identifier& in) const noexcept
 {
+    if (false == active()) { return *this; }
+
     return operator()(in.str().c_str());
 }
 
@@ -122,6 +145,8 @@ const LogSource& LogSource::operator()(const OTNymID& in) const noexcept
 
 const LogSource& LogSource::operator()(const identifier::Nym& in) const noexcept
 {
+    if (false == active()) { return *this; }
+
     return operator()(in.str().c_str());
 }
 
@@ -133,6 +158,8 @@ const LogSource& LogSource::operator()(const OTServerID& in) const noexcept
 const LogSource& LogSource::operator()(const identifier::Server& in) const
     noexcept
 {
+    if (false == active()) { return *this; }
+
     return operator()(in.str().c_str());
 }
 
@@ -144,86 +171,82 @@ const LogSource& LogSource::operator()(const OTUnitID& in) const noexcept
 const LogSource& LogSource::operator()(
     const identifier::UnitDefinition& in) const noexcept
 {
+    if (false == active()) { return *this; }
+
     return operator()(in.str().c_str());
 }
 
 const LogSource& LogSource::operator()(const Time in) const noexcept
 {
+    if (false == active()) { return *this; }
+
     return operator()(formatTimestamp(in));
 }
 
+bool LogSource::active() const noexcept { return verbosity_.load() >= level_; }
+
 void LogSource::Assert(
     const char* file,
     const std::size_t line,
     const char* message) const noexcept
 {
     {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
-        buffer = std::stringstream{};
-        buffer << "OT ASSERT";
-
-        if (nullptr != file) { buffer << " in " << file << " line " << line; }
+        auto& buffer = get_buffer().text_;
+        buffer = "OT ASSERT";
+
+        if (nullptr != file) {
+            buffer += " in ";
+            buffer += file;
+            buffer += " line ";
+            buffer += std::to_string(line);
+        }
 
-        if (nullptr != message) { buffer << ": " << message; }
+        if (nullptr != message) {
+            buffer += ": ";
+            buffer += message;
+        }
 
-        buffer << "\n" << boost::stacktrace::stacktrace();
+        buffer += "\n";
+        buffer += stack_trace();
     }
 
     send(true);
     abort();
 }
 
-void LogSource::Flush() const noexcept { send(false); }
+void LogSource::Flush() const noexcept
+{
+    if (false == active()) { return; }
 
-LogSource::Source& LogSource::get_buffer(std::string& out) noexcept
+    send(false);
+}
+
+LogSource::Buffer& LogSource::get_buffer() noexcept
 {
-    const auto id = std::this_thread::get_id();
-    std::stringstream convert{};
-    convert << std::hex << id;
-    out = convert.str();
-    auto it = buffer_.find(id);
-
-    if (buffer_.end() == it) {
-        Lock lock(buffer_lock_);
-        auto inner = buffer_.emplace(
-            id,
-            Source{Context().ZMQ().PushSocket(
-                       zmq::socket::Socket::Direction::Connect),
-                   std::stringstream{}});
-        auto& source = std::get<0>(inner)->second;
-        auto& socket = std::get<0>(source).get();
-        socket.Start(LOG_SINK);
-
-        return source;
-    }
+    thread_local Buffer buffer{};
 
-    return it->second;
+    return buffer;
 }
 
 void LogSource::send(const bool terminate) const noexcept
 {
     if (running_.load()) {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
-        auto message = zmq::Message::Factory();
-        message->PrependEmptyFrame();
-        message->AddFrame(std::to_string(level_));
-        message->AddFrame(buffer.str());
-        message->AddFrame(id);
-        auto promise = std::promise<void>{};
-        auto future = promise.get_future();
-        const auto* pPromise = &promise;
+        auto& buffer = get_buffer();
+
+        if (buffer.text_.empty() && (false == terminate)) { return; }
+
+        auto& queue = internal::LogQueue::Global();
 
         if (terminate) {
-            message->AddFrame(&pPromise, sizeof(pPromise));
+            auto promise = std::promise<void>{};
+            auto future = promise.get_future();
+            queue.Push(level_, buffer.thread_, buffer.text_, &promise);
+            future.wait_for(std::chrono::seconds(10));
         } else {
-            promise.set_value();
+            queue.Push(level_, buffer.thread_, buffer.text_);
         }
 
-        socket->Send(message);
-        buffer = std::stringstream{};
-        future.wait_for(std::chrono::seconds(10));
+        buffer.text_.clear();
     }
 
     if (terminate) { abort(); }
@@ -237,7 +260,7 @@ void LogSource::SetVerbosity(const int level) noexcept
 void LogSource::Shutdown() noexcept
 {
     running_.store(false);
-    buffer_.clear();
+    internal::LogQueue::Global().Notify();
 }
 
 const LogSource& LogSource::StartLog(
@@ -253,16 +276,23 @@ void LogSource::Trace(
     const char* message) const noexcept
 {
     {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
-        buffer = std::stringstream{};
-        buffer << "Stack trace requested";
-
-        if (nullptr != file) { buffer << " in " << file << " line " << line; }
+        auto& buffer = get_buffer().text_;
+        buffer = "Stack trace requested";
+
+        if (nullptr != file) {
+            buffer += " in ";
+            buffer += file;
+            buffer += " line ";
+            buffer += std::to_string(line);
+        }
 
-        if (nullptr != message) { buffer << ": " << message; }
+        if (nullptr != message) {
+            buffer += ": ";
+            buffer += message;
+        }
 
-        buffer << "\n" << stack_trace();
+        buffer += "\n";
+        buffer += stack_trace();
     }
 
     send(false);
@@ -27,6 +27,9 @@
 #include "internal/api/Api.hpp"
 
 #include <irrxml/irrXML.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <cstring>
 #include <cstdint>
 #include <map>
@@ -53,13 +56,18 @@ std::chrono::milliseconds OTCron::__cron_ms_between_process{10000};
 // time.
 std::int32_t OTCron::__cron_max_items_per_nym{10};
 
-Time OTCron::last_executed_{};
+// The maximum number of milliseconds spent processing cron items before
+// returning to let client requests proceed.
+std::chrono::milliseconds OTCron::__cron_ms_per_slice{100};
 
 OTCron::OTCron(const api::internal::Core& server)
     : Contract(server)
     , m_mapMarkets()
     , m_mapCronItems()
     , m_multimapCronItems()
+    , m_multimapDueItems()
+    , m_mapDueEntries()
+    , m_tNextDue(Time::max())
     , m_NOTARY_ID(api_.Factory().ServerID())
     , m_listTransactionNumbers()
     , m_bIsActivated(false)
@@ -244,8 +252,8 @@ bool OTCron::GetMarketList(Armored& ascOutput, std::int32_t& nMarketCount)
 
         pMarketData->last_sale_date = pMarket->GetLastSaleDate();
 
-        const mapOfOffers::size_type theBidCount = pMarket->GetBidCount();
-        const mapOfOffers::size_type theAskCount = pMarket->GetAskCount();
+        const std::size_t theBidCount = pMarket->GetBidCount();
+        const std::size_t theAskCount = pMarket->GetAskCount();
 
         pMarketData->number_bids = std::to_string(theBidCount);
         pMarketData->number_asks = std::to_string(theAskCount);
@@ -584,9 +592,10 @@ void OTCron::UpdateContents(const PasswordPrompt& reason)
 
 std::chrono::milliseconds OTCron::computeTimeout()
 {
-    return GetCronMsBetweenProcess() -
-           std::chrono::duration_cast<std::chrono::milliseconds>(
-               Clock::now() - last_executed_);
+    const auto due = std::chrono::duration_cast<std::chrono::milliseconds>(
+        m_tNextDue.load() - Clock::now());
+
+    return std::min(due, GetCronMsBetweenProcess());
 }
 
 // Make sure to call this regularly so the CronItems get a chance to process and
@@ -600,10 +609,11 @@ void OTCron::ProcessCronItems()
         return;
     }
 
-    // check elapsed time since last items processing
+    // check whether any item is due
     if (computeTimeout().count() > 0) { return; }
 
-    last_executed_ = Clock::now();
+    const auto now = Clock::now();
+    const auto sliceEnd = now + GetCronMsPerSlice();
 
     const std::int32_t nTwentyPercent = OTCron::GetCronRefillAmount() / 5;
     if (GetTransactionCount() <= nTwentyPercent) {
@@ -621,11 +631,22 @@ void OTCron::ProcessCronItems()
     }
     bool bNeedToSave = false;
 
-    // loop through the cron items and tell each one to ProcessCron().
-    // If the item returns true, that means leave it on the list. Otherwise,
-    // if it returns false, that means "it's done: remove it."
-    for (auto it = m_multimapCronItems.begin();
-         it != m_multimapCronItems.end();) {
+    // Take each item which is due and tell it to ProcessCron().
+    // If the item returns true, that means leave it on the list and schedule
+    // it again. Otherwise, if it returns false, that means "it's done: remove
+    // it."
+    while (false == m_multimapDueItems.empty()) {
+        auto it = m_multimapDueItems.begin();
+
+        if (it->first > now) { break; }
+
+        if (Clock::now() >= sliceEnd) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(
+                ": Slice finished with items still due.")
+                .Flush();
+            break;
+        }
+
         if (GetTransactionCount() <= nTwentyPercent) {
             LogOutput(OT_METHOD)(__FUNCTION__)(
                 ": WARNING: Cron has fewer than 20 percent of its normal "
@@ -642,14 +663,21 @@ void OTCron::ProcessCronItems()
                 .Flush();
             break;
         }
-        auto pItem = it->second;
+        const auto lTransactionNum = it->second;
+        UnscheduleItem(lTransactionNum);
+        auto it_map = FindItemOnMap(lTransactionNum);
+
+        OT_ASSERT(m_mapCronItems.end() != it_map);
+
+        auto pItem = it_map->second;
         OT_ASSERT(false != bool(pItem));
         LogVerbose(OT_METHOD)(__FUNCTION__)(": Processing item number: ")(
             pItem->GetTransactionNum())
             .Flush();
 
         if (pItem->ProcessCron(reason)) {
-            it++;
+            // Items are never processed more often than once per round
+            ScheduleItem(*pItem, now + GetCronMsBetweenProcess());
             continue;
         }
         pItem->HookRemovalFromCron(
@@ -657,13 +685,17 @@ void OTCron::ProcessCronItems()
         LogNormal(OT_METHOD)(__FUNCTION__)(": Removing cron item: ")(
             pItem->GetTransactionNum())(".")
             .Flush();
-        it = m_multimapCronItems.erase(it);
-        auto it_map = FindItemOnMap(pItem->GetTransactionNum());
-        OT_ASSERT(m_mapCronItems.end() != it_map);
+        auto it_multimap = FindItemOnMultimap(lTransactionNum);
+        OT_ASSERT(m_multimapCronItems.end() != it_multimap);
+        m_multimapCronItems.erase(it_multimap);
         m_mapCronItems.erase(it_map);
+        // The removal hooks may have set a timer which rescheduled the item
+        UnscheduleItem(lTransactionNum);
 
         bNeedToSave = true;
     }
+    UpdateNextDue();
+
     if (bNeedToSave) SaveCron();
 }
 
@@ -727,6 +759,7 @@ bool OTCron::AddCronItem(
         theItem->SetCronPointer(*this);
         theItem->setServerNym(m_pServerNym);
         theItem->setNotaryID(m_NOTARY_ID);
+        ScheduleItem(*theItem, Clock::now());
 
         bool bSuccess = true;
 
@@ -821,6 +854,8 @@ bool OTCron::RemoveCronItem(
 
         m_mapCronItems.erase(it_map);            // Remove from MAP.
         m_multimapCronItems.erase(it_multimap);  // Remove from MULTIMAP.
+        UnscheduleItem(lTransactionNum);
+        UpdateNextDue();
 
         // An item has been removed from Cron. SAVE.
         return SaveCron();
@@ -829,6 +864,44 @@ bool OTCron::RemoveCronItem(
     return false;
 }
 
+void OTCron::RescheduleItem(const OTCronItem& item)
+{
+    auto it = FindItemOnMap(item.GetTransactionNum());
+
+    if (m_mapCronItems.end() == it) { return; }
+
+    ScheduleItem(*it->second, Clock::now());
+}
+
+// An item is due at the date it reports through GetNextDueDate, but never
+// before earliest. Any entry the item already has is replaced.
+void OTCron::ScheduleItem(const OTCronItem& item, const Time earliest)
+{
+    const auto lTransactionNum = item.GetTransactionNum();
+    UnscheduleItem(lTransactionNum);
+    const auto due = std::max(earliest, item.GetNextDueDate());
+    m_mapDueEntries.emplace(
+        lTransactionNum, m_multimapDueItems.emplace(due, lTransactionNum));
+    UpdateNextDue();
+}
+
+void OTCron::UnscheduleItem(const std::int64_t lTransactionNum)
+{
+    auto it = m_mapDueEntries.find(lTransactionNum);
+
+    if (m_mapDueEntries.end() == it) { return; }
+
+    m_multimapDueItems.erase(it->second);
+    m_mapDueEntries.erase(it);
+}
+
+void OTCron::UpdateNextDue()
+{
+    m_tNextDue.store(
+        m_multimapDueItems.empty() ? Time::max()
+                                   : m_multimapDueItems.begin()->first);
+}
+
 // Look up a transaction by transaction number and see if it is in the map.
 // If it is, return an iterator to it, otherwise return m_mapCronItems.end()
 //
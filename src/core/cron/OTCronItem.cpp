@@ -13,6 +13,7 @@
 #include "opentxs/api/Wallet.hpp"
 #include "opentxs/consensus/ClientContext.hpp"
 #include "opentxs/consensus/ServerContext.hpp"
+#include "opentxs/core/cron/OTCron.hpp"
 #include "opentxs/core/recurring/OTPaymentPlan.hpp"
 #include "opentxs/core/script/OTSmartContract.hpp"
 #include "opentxs/core/trade/OTTrade.hpp"
@@ -34,6 +35,7 @@
 
 #include <irrxml/irrXML.hpp>
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdint>
 #include <deque>
@@ -746,6 +748,38 @@ bool OTCronItem::CanRemoveItemFromCron(const ClientContext& context)
     // above. Only if that fails, do you need to dig deeper...
 }
 
+void OTCronItem::FlagForRemoval()
+{
+    m_bRemovalFlag = true;
+    reschedule();
+}
+
+Time OTCronItem::GetNextDueDate() const { return next_due_date(Time{}); }
+
+Time OTCronItem::next_due_date(const Time date) const
+{
+    auto output = date;
+    const auto expires = GetValidTo();
+
+    // ProcessCron removes the item once it expires or is flagged
+    if ((Time{} < expires) && (expires < output)) { output = expires; }
+
+    if (IsFlaggedForRemoval()) { output = Time{}; }
+
+    const auto last = GetLastProcessDate();
+
+    if (Time{} != last) {
+        output = std::max(output, last + GetProcessInterval());
+    }
+
+    return output;
+}
+
+void OTCronItem::reschedule() const
+{
+    if (nullptr != m_pCron) { m_pCron->RescheduleItem(*this); }
+}
+
 // OTCron calls this regularly, which is my chance to expire, etc.
 // Child classes will override this, AND call it (to verify valid date
 // range.)
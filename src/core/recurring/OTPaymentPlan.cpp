@@ -31,6 +31,8 @@
 #include "internal/api/Api.hpp"
 
 #include <irrxml/irrXML.hpp>
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <sys/types.h>
@@ -1598,6 +1600,51 @@ bool OTPaymentPlan::ProcessCron(const PasswordPrompt& reason)
     return true;
 }
 
+// Mirrors the checks in ProcessCron, so the plan is only woken when a payment
+// may be due or when it needs to be removed.
+Time OTPaymentPlan::GetNextDueDate() const
+{
+    const auto retry = [](const Time date, const Time failed) -> Time {
+        if (Time{} == failed) { return date; }
+
+        return std::max(date, failed + std::chrono::hours{24});
+    };
+    auto output = Time::max();
+    const auto due = [&](const Time date) { output = std::min(output, date); };
+
+    if (HasInitialPayment() && (false == IsInitialPaymentDone())) {
+        due(retry(GetInitialPaymentDate(), GetLastFailedInitialPaymentDate()));
+    }
+
+    if (HasPaymentPlan()) {
+        const auto start = GetPaymentPlanStartDate();
+        const auto length = GetPaymentPlanLength();
+
+        if ((GetMaximumNoPayments() > 0) &&
+            (GetNoPaymentsDone() >= GetMaximumNoPayments())) {
+            due(Time{});
+        } else {
+            auto next = start + GetTimeBetweenPayments() * GetNoPaymentsDone();
+
+            if (Time{} != GetDateOfLastPayment()) {
+                next = std::max(
+                    next, GetDateOfLastPayment() + GetTimeBetweenPayments());
+            }
+
+            due(retry(next, GetDateOfLastFailedPayment()));
+        }
+
+        if (length > std::chrono::seconds{0}) { due(start + length); }
+    } else if (HasInitialPayment() && IsInitialPaymentDone()) {
+        due(Time{});
+    }
+
+    // Nothing is paid before the plan becomes valid
+    if (Time::max() != output) { output = std::max(output, GetValidFrom()); }
+
+    return next_due_date(output);
+}
+
 void OTPaymentPlan::InitPaymentPlan()
 {
     m_strContractType = String::Factory("PAYMENT PLAN");
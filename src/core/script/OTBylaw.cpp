@@ -35,6 +35,7 @@ OTBylaw::OTBylaw()
     , m_mapHooks()
     , m_mapCallbacks()
     , m_pOwnerAgreement(nullptr)
+    , m_strDigest()
 {
 }
 
@@ -46,6 +47,7 @@ OTBylaw::OTBylaw(const char* szName, const char* szLanguage)
     , m_mapHooks()
     , m_mapCallbacks()
     , m_pOwnerAgreement(nullptr)
+    , m_strDigest()
 {
     if (nullptr != szName)
         m_strName->Set(szName);
@@ -497,6 +499,7 @@ bool OTBylaw::RemoveClause(std::string str_Name)
     // remove it from the map.
     //
     m_mapClauses.erase(it);
+    ClausesChanged();
 
     delete pClause;
     pClause = nullptr;
@@ -1018,6 +1021,7 @@ bool OTBylaw::AddClause(OTClause& theClause)
 
         // Make sure it has a pointer back to me.
         theClause.SetBylaw(*this);
+        ClausesChanged();
 
         return true;
     } else {
@@ -1030,6 +1034,34 @@ bool OTBylaw::AddClause(OTClause& theClause)
     }
 }
 
+const std::string& OTBylaw::GetDigest() const
+{
+    if (m_strDigest.empty()) {
+        // Each part is prefixed with its length so that moving text between
+        // a clause name and its code changes the digest.
+        const auto append = [](std::string& output, const std::string& part) {
+            output += std::to_string(part.size());
+            output += ':';
+            output += part;
+        };
+        std::string str_content{};
+        append(str_content, GetLanguage());
+
+        for (const auto& [str_name, pClause] : m_mapClauses) {
+            OT_ASSERT(nullptr != pClause);
+
+            append(str_content, str_name);
+            append(str_content, pClause->GetCode());
+        }
+
+        auto digest = Identifier::Factory();
+        digest->CalculateDigest(str_content);
+        m_strDigest = digest->str();
+    }
+
+    return m_strDigest;
+}
+
 const char* OTBylaw::GetLanguage() const
 {
     return m_strLanguage->Exists() ? m_strLanguage->Get()
@@ -7,6 +7,7 @@
 
 #include "opentxs/core/script/OTClause.hpp"
 
+#include "opentxs/core/script/OTBylaw.hpp"
 #include "opentxs/core/util/Tag.hpp"
 #include "opentxs/core/Armored.hpp"
 #include "opentxs/core/Log.hpp"
@@ -61,6 +62,8 @@ OTClause::~OTClause()
 void OTClause::SetCode(const std::string& str_code)
 {
     m_strCode->Set(str_code.c_str());
+
+    if (nullptr != m_pBylaw) { m_pBylaw->ClausesChanged(); }
 }
 
 const char* OTClause::GetCode() const
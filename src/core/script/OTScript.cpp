@@ -196,6 +196,14 @@ OTScript::~OTScript()
     // parties.
     // See OTSmartContract, rather, for that.
 
+    OTScript::Reset();
+}
+
+void OTScript::Reset()
+{
+    m_mapParties.clear();
+    m_mapAccounts.clear();
+
     while (!m_mapVariables.empty()) {
         OTVariable* pVar = m_mapVariables.begin()->second;
         OT_ASSERT(nullptr != pVar);
@@ -29,12 +29,18 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <map>
+#include <memory>
 #include <string>
 
 #define OT_METHOD "opentxs::OTScriptChai::"
 
 namespace opentxs
 {
+struct OTScriptChai::Baseline {
+    chaiscript::ChaiScript::State state_;
+    std::map<std::string, chaiscript::Boxed_Value> locals_;
+};
 
 bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
 {
@@ -351,30 +357,35 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
 OTScriptChai::OTScriptChai()
     : OTScript()
     , chai_(new chaiscript::ChaiScript)
+    , baseline_()
 {
 }
 
 OTScriptChai::OTScriptChai(const OTString& strValue)
     : OTScript(strValue)
     , chai_(new chaiscript::ChaiScript)
+    , baseline_()
 {
 }
 
 OTScriptChai::OTScriptChai(const char* new_string)
     : OTScript(new_string)
     , chai_(new chaiscript::ChaiScript)
+    , baseline_()
 {
 }
 
 OTScriptChai::OTScriptChai(const char* new_string, size_t sizeLength)
     : OTScript(new_string, sizeLength)
     , chai_(new chaiscript::ChaiScript)
+    , baseline_()
 {
 }
 
 OTScriptChai::OTScriptChai(const std::string& new_string)
     : OTScript(new_string)
     , chai_(new chaiscript::ChaiScript)
+    , baseline_()
 {
 }
 
@@ -383,35 +394,60 @@ OTScriptChai::OTScriptChai(const std::string& new_string)
 OTScriptChai::OTScriptChai()
     : OTScript()
     , chai_(new chaiscript::ChaiScript)
+    , baseline_()
 {
 }
 
 OTScriptChai::OTScriptChai(const String& strValue)
     : OTScript(strValue)
     , chai_(new chaiscript::ChaiScript)
+    , baseline_()
 {
 }
 
 OTScriptChai::OTScriptChai(const char* new_string)
     : OTScript(new_string)
     , chai_(new chaiscript::ChaiScript)
+    , baseline_()
 {
 }
 
 OTScriptChai::OTScriptChai(const char* new_string, size_t sizeLength)
     : OTScript(new_string, sizeLength)
     , chai_(new chaiscript::ChaiScript)
+    , baseline_()
 {
 }
 
 OTScriptChai::OTScriptChai(const std::string& new_string)
     : OTScript(new_string)
     , chai_(new chaiscript::ChaiScript)
+    , baseline_()
 {
 }
 
 #endif  // defined(OT_USE_CHAI_STDLIB)
 
+void OTScriptChai::Prepared()
+{
+    OT_ASSERT(nullptr != chai_);
+
+    baseline_.reset(new Baseline{chai_->get_state(), chai_->get_locals()});
+}
+
+// Restoring the engine state also discards any functions or globals the
+// previous script defined, so a reused engine behaves like a new one which
+// already has the native calls registered.
+void OTScriptChai::Reset()
+{
+    OTScript::Reset();
+
+    if (baseline_) {
+        chai_->set_state(baseline_->state_);
+        chai_->set_locals(baseline_->locals_);
+    }
+}
+
 OTScriptChai::~OTScriptChai()
 {
     if (nullptr != chai_) delete chai_;
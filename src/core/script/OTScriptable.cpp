@@ -50,9 +50,11 @@
 #include <cinttypes>
 #include <cstdint>
 #include <cstdlib>
+#include <map>
 #include <memory>
 #include <string>
 #include <sstream>
+#include <utility>
 
 #define OT_METHOD "opentxs::OTScriptable"
 
@@ -71,6 +73,13 @@
 
 namespace opentxs
 {
+struct OTScriptable::Scripts {
+    // By bylaw name: the digest of the bylaw the engine was prepared for,
+    // and the engine
+    std::map<std::string, std::pair<std::string, std::shared_ptr<OTScript>>>
+        map_;
+};
+
 OTScriptable::OTScriptable(const api::internal::Core& core)
     : Contract(core)
     , openingNumsInOrderOfSigning_()
@@ -80,7 +89,9 @@ OTScriptable::OTScriptable(const api::internal::Core& core)
     , m_bSpecifyInstrumentDefinitionID(false)
     , m_bSpecifyParties(false)  // These are.
     , m_strLabel(String::Factory())
+    , scripts_(new Scripts)
 {
+    OT_ASSERT(scripts_);
 }
 
 // virtual
@@ -276,6 +287,43 @@ void OTScriptable::RegisterOTNativeCallsWithScript([
     }
 }
 
+// Building an engine and registering the native calls costs far more than
+// running a typical clause, so each bylaw keeps one engine which is reset
+// between executions instead.
+std::shared_ptr<OTScript> OTScriptable::LoadScript(
+    const OTBylaw& theBylaw,
+    const std::string& str_code)
+{
+    const std::string& str_digest = theBylaw.GetDigest();
+    auto& [str_cached_digest, pCached] =
+        scripts_->map_[theBylaw.GetName().Get()];
+    std::shared_ptr<OTScript> pScript{};
+
+    // A script may call back into this scriptable while its engine is still
+    // running, in which case the nested call gets an engine of its own.
+    if (pCached && (str_digest == str_cached_digest) &&
+        (1 == pCached.use_count())) {
+        pScript = pCached;
+        pScript->Reset();
+    } else {
+        pScript = OTScriptFactory(theBylaw.GetLanguage());
+
+        if (false == bool(pScript)) { return pScript; }
+
+        RegisterOTNativeCallsWithScript(*pScript);
+        pScript->Prepared();
+
+        if (false == bool(pCached) || (str_digest != str_cached_digest)) {
+            str_cached_digest = str_digest;
+            pCached = pScript;
+        }
+    }
+
+    pScript->SetScript(str_code);
+
+    return pScript;
+}
+
 // static
 std::string OTScriptable::GetTime()  // Returns a string, containing seconds as
                                      // std::int32_t. (Time in seconds.)
@@ -529,21 +577,14 @@ bool OTScriptable::ExecuteCallback(
 
     const std::string str_code =
         theCallbackClause.GetCode();  // source code for the script.
-    const std::string str_language =
-        pBylaw->GetLanguage();  // language it's in. (Default is "chai")
 
-    std::shared_ptr<OTScript> pScript = OTScriptFactory(str_language, str_code);
+    std::shared_ptr<OTScript> pScript = LoadScript(*pBylaw, str_code);
 
     //
-    // SET UP THE NATIVE CALLS, REGISTER THE PARTIES, REGISTER THE VARIABLES,
-    // AND EXECUTE THE SCRIPT.
+    // REGISTER THE PARTIES, REGISTER THE VARIABLES, AND EXECUTE THE SCRIPT.
+    // (The native calls are already registered with the script.)
     //
     if (pScript) {
-        // Register the special server-side native OT calls we make available to
-        // all scripts.
-        //
-        RegisterOTNativeCallsWithScript(*pScript);
-
         // Register all the parties with the script.
         for (auto& it : m_mapParties) {
             const std::string str_party_name = it.first;
@@ -3485,6 +3526,9 @@ void OTScriptable::specifyAssetTypes(bool bNewState)
 
 void OTScriptable::Release_Scriptable()
 {
+    // The engines refer to this scriptable's parties and variables.
+    scripts_->map_.clear();
+
     // Go through the existing list of parties and bylaws at this point, and
     // delete them all.
     // (After all, I own them.)
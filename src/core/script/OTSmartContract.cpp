@@ -523,6 +523,7 @@ various sequence numbers. Hm.
 #endif
 #include <irrxml/irrXML.hpp>
 
+#include <algorithm>
 #include <cinttypes>
 #include <ctime>
 #include <memory>
@@ -3594,6 +3595,13 @@ bool OTSmartContract::ProcessCron(const PasswordPrompt& reason)
     return true;
 }
 
+// Nothing runs before the contract becomes valid, or before the timer set by
+// the script pops
+Time OTSmartContract::GetNextDueDate() const
+{
+    return next_due_date(std::max(GetNextProcessDate(), GetValidFrom()));
+}
+
 // virtual
 void OTSmartContract::SetDisplayLabel(const std::string* pstrLabel)
 {
@@ -3627,24 +3635,16 @@ void OTSmartContract::ExecuteClauses(
 
         const std::string str_code =
             pClause->GetCode();  // source code for the script.
-        const std::string str_language =
-            pBylaw->GetLanguage();  // language it's in. (Default is "chai")
 
-        std::shared_ptr<OTScript> pScript =
-            OTScriptFactory(str_language, str_code);
+        std::shared_ptr<OTScript> pScript = LoadScript(*pBylaw, str_code);
 
         std::unique_ptr<OTVariable> theVarAngel;
 
         //
-        // SET UP THE NATIVE CALLS, REGISTER THE PARTIES, REGISTER THE
-        // VARIABLES, AND EXECUTE THE SCRIPT.
+        // REGISTER THE PARTIES, REGISTER THE VARIABLES, AND EXECUTE THE
+        // SCRIPT. (The native calls are already registered with the script.)
         //
         if (pScript) {
-            // Register the special server-side native OT calls we make
-            // available to all scripts.
-            //
-            RegisterOTNativeCallsWithScript(*pScript);
-
             // Register all the parties with the script.
             //
             for (auto& it : m_mapParties) {
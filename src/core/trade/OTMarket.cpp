@@ -32,8 +32,11 @@
 
 #include <irrxml/irrXML.hpp>
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdint>
+#include <deque>
+#include <functional>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -51,6 +54,8 @@ OTMarket::OTMarket(const api::internal::Core& core, const char* szFilename)
     , m_pTradeList(nullptr)
     , m_mapBids()
     , m_mapAsks()
+    , m_nBidCount(0)
+    , m_nAskCount(0)
     , m_mapOffers()
     , m_NOTARY_ID(identifier::Server::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
@@ -72,6 +77,8 @@ OTMarket::OTMarket(const api::internal::Core& core)
     , m_pTradeList(nullptr)
     , m_mapBids()
     , m_mapAsks()
+    , m_nBidCount(0)
+    , m_nAskCount(0)
     , m_mapOffers()
     , m_NOTARY_ID(identifier::Server::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
@@ -94,6 +101,8 @@ OTMarket::OTMarket(
     , m_pTradeList(nullptr)
     , m_mapBids()
     , m_mapAsks()
+    , m_nBidCount(0)
+    , m_nAskCount(0)
     , m_mapOffers()
     , m_NOTARY_ID(NOTARY_ID)
     , m_INSTRUMENT_DEFINITION_ID(INSTRUMENT_DEFINITION_ID)
@@ -222,36 +231,36 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
     tag.add_attribute("lastSaleDate", m_strLastSaleDate);
     tag.add_attribute("lastSalePrice", std::to_string(m_lLastSalePrice));
 
-    // Save the offers for sale.
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
+    auto save_offer = [&tag](const OTOffer& theOffer) {
+        auto strOffer = String::Factory(theOffer);  // Extract the offer
+                                                    // contract into string
+                                                    // form.
         auto ascOffer =
             Armored::Factory(strOffer);  // Base64-encode that for storage.
 
         TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
         tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
+            "dateAdded", formatTimestamp(theOffer.GetDateAddedToMarket()));
         tag.add_tag(tagOffer);
+    };
+
+    // Save the offers for sale. (Each price level is written in the order its
+    // offers were added, so that order survives reloading the market.)
+    for (auto& [lPrice, queue] : m_mapAsks) {
+        for (OTOffer* pOffer : queue) {
+            OT_ASSERT(nullptr != pOffer);
+
+            save_offer(*pOffer);
+        }
     }
 
     // Save the bids.
-    for (auto& it : m_mapBids) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+    for (auto& [lPrice, queue] : m_mapBids) {
+        for (OTOffer* pOffer : queue) {
+            OT_ASSERT(nullptr != pOffer);
 
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
-        auto ascOffer =
-            Armored::Factory(strOffer);  // Base64-encode that for storage.
-
-        TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
-        tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
-        tag.add_tag(tagOffer);
+            save_offer(*pOffer);
+        }
     }
 
     std::string str_result;
@@ -264,11 +273,12 @@ std::int64_t OTMarket::GetTotalAvailableAssets()
 {
     std::int64_t lTotal = 0;
 
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+    for (auto& [lPrice, queue] : m_mapAsks) {
+        for (OTOffer* pOffer : queue) {
+            OT_ASSERT(nullptr != pOffer);
 
-        lTotal += pOffer->GetAmountAvailable();
+            lTotal += pOffer->GetAmountAvailable();
+        }
     }
 
     return lTotal;
@@ -465,77 +475,86 @@ bool OTMarket::GetOfferList(
         dynamic_cast<OTDB::OfferListMarket*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_MARKET)));
 
-    //    mapOfOffers            m_mapBids;        // The buyers, ordered by
-    // price limit
-    //    mapOfOffers            m_mapAsks;        // The sellers, ordered by
-    // price limit
+    // Both books are ordered best price first.
 
     std::int32_t nTempDepth = 0;
 
-    for (auto& it : m_mapBids) {
-        if (nTempDepth++ > lDepth) break;
-
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+    for (auto& [lLevelPrice, queue] : m_mapBids) {
+        if (nTempDepth > lDepth) break;
 
-        const std::int64_t& lPriceLimit = pOffer->GetPriceLimit();
-
-        if (0 == lPriceLimit)  // Skipping any market orders.
-            continue;
+        for (OTOffer* pOffer : queue) {
+            if (nTempDepth++ > lDepth) break;
 
-        // OfferDataMarket
-        std::unique_ptr<OTDB::BidData> pOfferData(dynamic_cast<OTDB::BidData*>(
-            OTDB::CreateObject(OTDB::STORED_OBJ_BID_DATA)));
+            OT_ASSERT(nullptr != pOffer);
 
-        const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
-        const std::int64_t lAvailableAssets = pOffer->GetAmountAvailable();
-        const std::int64_t& lMinimumIncrement = pOffer->GetMinimumIncrement();
-        const auto tDateAddedToMarket = pOffer->GetDateAddedToMarket();
+            const std::int64_t& lPriceLimit = pOffer->GetPriceLimit();
 
-        pOfferData->transaction_id = std::to_string(lTransactionNum);
-        pOfferData->price_per_scale = std::to_string(lPriceLimit);
-        pOfferData->available_assets = std::to_string(lAvailableAssets);
-        pOfferData->minimum_increment = std::to_string(lMinimumIncrement);
-        pOfferData->date = std::to_string(Clock::to_time_t(tDateAddedToMarket));
+            if (0 == lPriceLimit)  // Skipping any market orders.
+                continue;
 
-        // *pOfferData is CLONED at this time (I'm still responsible to delete.)
-        // That's also why I add it here, below: So the data is set right before
-        // the cloning occurs.
-        //
-        pOfferList->AddBidData(*pOfferData);
-        nOfferCount++;
+            // OfferDataMarket
+            std::unique_ptr<OTDB::BidData> pOfferData(
+                dynamic_cast<OTDB::BidData*>(
+                    OTDB::CreateObject(OTDB::STORED_OBJ_BID_DATA)));
+
+            const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
+            const std::int64_t lAvailableAssets = pOffer->GetAmountAvailable();
+            const std::int64_t& lMinimumIncrement =
+                pOffer->GetMinimumIncrement();
+            const auto tDateAddedToMarket = pOffer->GetDateAddedToMarket();
+
+            pOfferData->transaction_id = std::to_string(lTransactionNum);
+            pOfferData->price_per_scale = std::to_string(lPriceLimit);
+            pOfferData->available_assets = std::to_string(lAvailableAssets);
+            pOfferData->minimum_increment = std::to_string(lMinimumIncrement);
+            pOfferData->date =
+                std::to_string(Clock::to_time_t(tDateAddedToMarket));
+
+            // *pOfferData is CLONED at this time (I'm still responsible to
+            // delete.) That's also why I add it here, below: So the data is set
+            // right before the cloning occurs.
+            //
+            pOfferList->AddBidData(*pOfferData);
+            nOfferCount++;
+        }
     }
 
     nTempDepth = 0;
 
-    for (auto& it : m_mapAsks) {
-        if (nTempDepth++ > lDepth) break;
+    for (auto& [lLevelPrice, queue] : m_mapAsks) {
+        if (nTempDepth > lDepth) break;
 
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+        for (OTOffer* pOffer : queue) {
+            if (nTempDepth++ > lDepth) break;
 
-        // OfferDataMarket"
-        std::unique_ptr<OTDB::AskData> pOfferData(dynamic_cast<OTDB::AskData*>(
-            OTDB::CreateObject(OTDB::STORED_OBJ_ASK_DATA)));
+            OT_ASSERT(nullptr != pOffer);
 
-        const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
-        const std::int64_t& lPriceLimit = pOffer->GetPriceLimit();
-        const std::int64_t lAvailableAssets = pOffer->GetAmountAvailable();
-        const std::int64_t& lMinimumIncrement = pOffer->GetMinimumIncrement();
-        const auto tDateAddedToMarket = pOffer->GetDateAddedToMarket();
+            // OfferDataMarket"
+            std::unique_ptr<OTDB::AskData> pOfferData(
+                dynamic_cast<OTDB::AskData*>(
+                    OTDB::CreateObject(OTDB::STORED_OBJ_ASK_DATA)));
 
-        pOfferData->transaction_id = std::to_string(lTransactionNum);
-        pOfferData->price_per_scale = std::to_string(lPriceLimit);
-        pOfferData->available_assets = std::to_string(lAvailableAssets);
-        pOfferData->minimum_increment = std::to_string(lMinimumIncrement);
-        pOfferData->date = std::to_string(Clock::to_time_t(tDateAddedToMarket));
+            const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
+            const std::int64_t& lPriceLimit = pOffer->GetPriceLimit();
+            const std::int64_t lAvailableAssets = pOffer->GetAmountAvailable();
+            const std::int64_t& lMinimumIncrement =
+                pOffer->GetMinimumIncrement();
+            const auto tDateAddedToMarket = pOffer->GetDateAddedToMarket();
 
-        // *pOfferData is CLONED at this time (I'm still responsible to delete.)
-        // That's also why I add it here, below: So the data is set right before
-        // the cloning occurs.
-        //
-        pOfferList->AddAskData(*pOfferData);
-        nOfferCount++;
+            pOfferData->transaction_id = std::to_string(lTransactionNum);
+            pOfferData->price_per_scale = std::to_string(lPriceLimit);
+            pOfferData->available_assets = std::to_string(lAvailableAssets);
+            pOfferData->minimum_increment = std::to_string(lMinimumIncrement);
+            pOfferData->date =
+                std::to_string(Clock::to_time_t(tDateAddedToMarket));
+
+            // *pOfferData is CLONED at this time (I'm still responsible to
+            // delete.) That's also why I add it here, below: So the data is set
+            // right before the cloning occurs.
+            //
+            pOfferList->AddAskData(*pOfferData);
+            nOfferCount++;
+        }
     }
 
     // Now pack the list into strOutput...
@@ -585,17 +604,9 @@ bool OTMarket::GetOfferList(
     return false;
 }
 
-// To insure that offers of a specific price are always inserted at the upper
-// bound,
-// use this:  my_mmap.insert(my_mmap.upper_bound(key), my_mmap::value_type(key,
-// val));
-// This way I can read them from the lower bound later, and always get them in
-// the
-// order received for that price.
-//
-// typedef std::multimap<std::int64_t, OTOffer *>    mapOfOffers;
-// mapOfOffers    m_mapBids; // The buyers, ordered
-// mapOfOffers    m_mapAsks; // The sellers, ordered
+// Offers are kept in one queue per price level, and each new offer goes to the
+// back of the queue for its price. This way the front of the first level of
+// each book is always the offer which is first in line.
 
 OTOffer* OTMarket::GetOffer(const std::int64_t& lTransactionNum)
 {
@@ -654,59 +665,31 @@ bool OTMarket::RemoveOffer(
         // But it's still on one of the other lists...
         m_mapOffers.erase(it);
 
-        // The code operates the same whether ask or bid. Just use a pointer.
-        mapOfOffers* pMap = (pOffer->IsBid() ? &m_mapBids : &m_mapAsks);
-
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
-        OTOffer* pSameOffer = nullptr;
+        // The offer's price limit is the key of the level it is queued on, so
+        // only that level needs to be searched.
+        if (pOffer->IsBid()) {
+            bReturnValue = remove_offer(m_mapBids, *pOffer);
 
-        for (mapOfOffers::iterator iii = pMap->begin(); iii != pMap->end();
-             ++iii) {
-            pSameOffer = iii->second;
-
-            OT_ASSERT_MSG(
-                nullptr != pSameOffer,
-                "nullptr offer pointer in OTMarket::RemoveOffer.\n");
-
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
+            if (bReturnValue) { --m_nBidCount; }
+        } else {
+            bReturnValue = remove_offer(m_mapAsks, *pOffer);
 
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
+            if (bReturnValue) { --m_nAskCount; }
         }
 
-        if (nullptr == pSameOffer) {
+        if (false == bReturnValue) {
             LogOutput(OT_METHOD)(__FUNCTION__)(
                 ": Removed offer from offers list, but not found on bid/ask "
                 "list.")
                 .Flush();
-        } else  // This means it was found and removed from the second list as
-                // well.
-        {
-            bReturnValue = true;  // Success.
         }
 
-        // pOffer was found on the Offers list.
-        // pSameOffer was found on the Bid or Ask list, with the same
-        // transaction ID.
-        // They SHOULD be pointers to the SAME object.
-        // Therefore I CANNOT delete them both.
-        //
-        OT_ASSERT(pOffer == pSameOffer);
+        // pOffer was found on the Offers list. It must also have been on the
+        // Bid or Ask list, since the same pointer is stored on both.
+        OT_ASSERT(bReturnValue);
 
         delete pOffer;
         pOffer = nullptr;
-        pSameOffer = nullptr;
     }
 
     if (bReturnValue)
@@ -773,24 +756,37 @@ bool OTMarket::AddOffer(
         // So next, let's add it to the lists that are indexed by price:
 
         // Determine if it's a buy or sell, and add it to the right list.
+        // No bother checking if the offer is already on these lists, since
+        // the code above basically already verifies that for us.
+        //
+        // New offers go to the back of the line for their price. Offers
+        // being reloaded are placed by the date they were first added, so
+        // the line stays in order whatever order the market file lists them
+        // in.
+        OfferQueue& queue = theOffer.IsBid() ? m_mapBids[lPriceLimit]
+                                             : m_mapAsks[lPriceLimit];
+
+        if (bSaveFile) {
+            queue.push_back(&theOffer);
+        } else {
+            queue.insert(
+                std::upper_bound(
+                    queue.begin(),
+                    queue.end(),
+                    tDateAddedToMarket,
+                    [](const Time& time, const OTOffer* pOffer) {
+                        return time < pOffer->GetDateAddedToMarket();
+                    }),
+                &theOffer);
+        }
+
         if (theOffer.IsBid()) {
-            // No bother checking if the offer is already on this list,
-            // since the code above basically already verifies that for us.
-
-            m_mapBids.insert(
-                m_mapBids.lower_bound(lPriceLimit),  // highest bidders go
-                                                     // first, so I am last in
-                                                     // line at lower bound.
-                std::pair<std::int64_t, OTOffer*>(lPriceLimit, &theOffer));
+            ++m_nBidCount;
             LogTrace(OT_METHOD)(__FUNCTION__)(
                 "Offer added as a bid to the market.")
                 .Flush();
         } else {
-            m_mapAsks.insert(
-                m_mapAsks.upper_bound(lPriceLimit),  // lowest price sells
-                                                     // first, so I am last in
-                                                     // line at upper bound.
-                std::pair<std::int64_t, OTOffer*>(lPriceLimit, &theOffer));
+            ++m_nAskCount;
             LogTrace(OT_METHOD)(__FUNCTION__)(
                 "Offer added as an ask to the market.")
                 .Flush();
@@ -912,6 +908,17 @@ bool OTMarket::SaveMarket(const PasswordPrompt& reason)
     return true;
 }
 
+bool OTMarket::SaveFill(const PasswordPrompt& reason)
+{
+    OT_ASSERT(nullptr != GetCron());
+
+    // The offers are stored in the market, and the trades in cron
+    const auto market = SaveMarket(reason);
+    const auto cron = GetCron()->SaveCron();
+
+    return market && cron;
+}
+
 // A Market's ID is based on the instrument definition, the currency type, and
 // the scale.
 //
@@ -940,9 +947,11 @@ std::int64_t OTMarket::GetHighestBidPrice()
 {
     std::int64_t lPrice = 0;
 
-    mapOfOffers::reverse_iterator rr = m_mapBids.rbegin();
+    // Market orders have a 0 price, so they are on the last level. If they
+    // are all that's here then the result is 0 anyway.
+    auto it = m_mapBids.begin();
 
-    if (rr != m_mapBids.rend()) { lPrice = rr->first; }
+    if (it != m_mapBids.end()) { lPrice = it->first; }
 
     return lPrice;
 }
@@ -955,27 +964,36 @@ std::int64_t OTMarket::GetLowestAskPrice()
 
     auto it = m_mapAsks.begin();
 
-    if (it != m_mapAsks.end()) {
-        lPrice = it->first;
+    // Market orders have a 0 price, so we need to skip them if they are here.
+    // They are all on the same level, which is the first one.
+    //
+    // Note that we don't have to do this with the highest bid price (above
+    // function) but in the case of asks, a "0 price" will undercut the other
+    // actual prices.
+    if ((it != m_mapAsks.end()) && (0 == it->first)) { ++it; }
 
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
+    if (it != m_mapAsks.end()) { lPrice = it->first; }
+
+    return lPrice;
+}
 
-            if (it == m_mapAsks.end()) break;
+template <typename Levels>
+bool OTMarket::remove_offer(Levels& levels, const OTOffer& theOffer)
+{
+    auto level = levels.find(theOffer.GetPriceLimit());
 
-            lPrice = it->first;
-        }
-    }
+    if (levels.end() == level) { return false; }
 
-    return lPrice;
+    auto& queue = level->second;
+    auto it = std::find(queue.begin(), queue.end(), &theOffer);
+
+    if (queue.end() == it) { return false; }
+
+    queue.erase(it);
+
+    if (queue.empty()) { levels.erase(level); }
+
+    return true;
 }
 
 // This utility function is used directly below (only).
@@ -1935,15 +1953,14 @@ void OTMarket::ProcessTrade(
                 }
 
                 // Account balances have changed based on these trades
-                // that we just processed. Make sure to save the Market
-                // since it contains those offers that have just
-                // updated.
-                SaveMarket(reason);
-
-                // The Trade has changed, and it is stored as a
-                // CronItem. So I save Cron as well, for the same reason
-                // I saved the Market.
-                pCron->SaveCron();
+                // that we just processed. The offers and trades have to
+                // be on disk before any of the accounts are, or a
+                // restart could fill the same volume again.
+                if (false == SaveFill(reason)) {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Failed to save the market or cron.")
+                        .Flush();
+                }
             }
 
             //
@@ -2355,6 +2372,42 @@ void OTMarket::ProcessTrade(
 
 // Return True if Trade should stay on the Cron list for more
 // processing. Return False if it should be removed and deleted.
+void OTMarket::VisitMatches(
+    OTOffer& theOffer,
+    const std::function<bool(OTOffer&)>& visitor)
+{
+    const bool bSelling = theOffer.IsAsk();
+    const std::int64_t& lPriceLimit = theOffer.GetPriceLimit();
+
+    // Both books are ordered best price first, and the front of each level is
+    // first in line, so the first offer out of my price range ends the search.
+    const auto visit = [&](auto& levels) {
+        for (auto& [lLevelPrice, queue] : levels) {
+            // Every offer at the 0 price level is a market order. They only
+            // process on their own turn, so they are never matched here.
+            if (0 == lLevelPrice) { continue; }
+
+            if (theOffer.IsLimitOrder() &&
+                (bSelling ? (lLevelPrice < lPriceLimit)
+                          : (lLevelPrice > lPriceLimit))) {
+                return;
+            }
+
+            for (OTOffer* pOffer : queue) {
+                OT_ASSERT(nullptr != pOffer);
+
+                if (false == visitor(*pOffer)) { return; }
+            }
+        }
+    };
+
+    if (bSelling) {
+        visit(m_mapBids);
+    } else {
+        visit(m_mapAsks);
+    }
+}
+
 bool OTMarket::ProcessTrade(
     const api::Wallet& wallet,
     OTTrade& theTrade,
@@ -2421,197 +2474,46 @@ bool OTMarket::ProcessTrade(
     // THIS TRADE'S PRICE LIMITS. So we're going to go up the list of
     // what's available, and trade.
 
-    if (theOffer.IsAsk())  // If I'm selling,
-    {
-        // rbegin puts us on the upper bound of the highest bidder (any
-        // new bidders at the same price would be added at the lower
-        // bound, where they are last in line.) The upper bound, on the
-        // other hand, is first in line.  So we start there, and loop
-        // backwards until there are no other bids within my price
-        // range.
-        for (mapOfOffers::reverse_iterator rr = m_mapBids.rbegin();
-             rr != m_mapBids.rend();
-             ++rr) {
-            // then I want to start at the highest bidder and loop DOWN
-            // until hitting my price limit.
-            OTOffer* pBid = rr->second;
-            OT_ASSERT(nullptr != pBid);
-
-            // NOTE: Market orders only process once, and they are
-            // processed in the order they were added to the market.
-            //
-            // If BOTH offers are market orders, we just skip this bid.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pBid! Imagine if pBid is a market order
-            // and theOffer isn't -- that would mean pBid hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
-            //
-            if (pBid->IsMarketOrder())
-                //          if (theOffer.IsMarketOrder() &&
-                // pBid->IsMarketOrder())
-                //              continue;
-                break;
-            // NOTE: Why break, instead of continue? Because since we
-            // are looping through the bids, from the HIGHEST down to
-            // the LOWEST, and since market orders have a ZERO price, we
-            // know for a fact that there are not any other non-zero
-            // bids. (So we might as well break.)
-
-            // I'm selling.
-            //
-            // If the bid is larger than, or equal to, my
-            // low-side-limit, and the amount available is at least my
-            // minimum increment, (and vice versa),
-            // ...then let's trade!
-            //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pBid->GetPriceLimit() >=
-                 theOffer.GetPriceLimit()))  // Or if this bid is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.)
-                //
-                // ...So all the other "if"s have to go INSIDE the block
-                // here:
-                //
-                if ((pBid->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pBid->GetMinimumIncrement()) &&
-                    (nullptr != pBid->GetTrade()) &&
-                    !pBid->GetTrade()->IsFlaggedForRemoval())
-
-                    ProcessTrade(
-                        wallet,
-                        theTrade,
-                        theOffer,
-                        *pBid,
-                        reason);  // <========
-            }
-
-            // Else, the bid is lower than I am willing to sell. (And
-            // all the remaining bids are even lower.)
-            //
-            else if (theOffer.IsLimitOrder()) {
-                pBid = nullptr;
-                return true;  // stay on cron for more processing (for
-                              // now.)
-            }
+    // NOTE: Market orders only process once, and they are processed in the
+    // order they were added to the market. So we ONLY process a market order
+    // as theOffer, never as the other offer: if the other offer is a market
+    // order, it hasn't been processed yet and needs to wait its turn.
+    // (VisitMatches skips them for us.)
+    bool bStayOnMarket = true;
+
+    VisitMatches(theOffer, [&](OTOffer& theOtherOffer) -> bool {
+        // The price is already within my range, so the other conditions
+        // are all that's left to check before we trade.
+        if ((theOtherOffer.GetAmountAvailable() >=
+             theOffer.GetMinimumIncrement()) &&
+            (theOffer.GetAmountAvailable() >=
+             theOtherOffer.GetMinimumIncrement()) &&
+            (nullptr != theOtherOffer.GetTrade()) &&
+            !theOtherOffer.GetTrade()->IsFlaggedForRemoval()) {
+            ProcessTrade(
+                wallet, theTrade, theOffer, theOtherOffer, reason);  // <======
+        }
 
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                LogVerbose(OT_METHOD)(__FUNCTION__)(
-                    ": Removing market order: ")(theTrade.GetOpeningNum())(
-                    ". IsFlaggedForRemoval: ")(theTrade.IsFlaggedForRemoval())(
-                    ". Minimum increment is larger than Amount ")(
-                    "available: ")(theOffer.GetMinimumIncrement())(
-                    theOffer.GetAmountAvailable())
-                    .Flush();
+        // The offer has no more trading to do--it's done.
+        if (theTrade.IsFlaggedForRemoval() ||  // during processing, the trade
+                                               // may have gotten flagged.
+            (theOffer.GetMinimumIncrement() > theOffer.GetAmountAvailable())) {
 
-                return false;  // remove this trade from cron
-            }
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": Removing market order: ")(
+                theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
+                theTrade.IsFlaggedForRemoval())(
+                ". Minimum increment is larger than Amount ")("available: ")(
+                theOffer.GetMinimumIncrement())(theOffer.GetAmountAvailable())
+                .Flush();
+            bStayOnMarket = false;
 
-            pBid = nullptr;
+            return false;
         }
-    }
-    // I'm buying
-    else {
-        // Begin puts us on the lower bound of the lowest seller (any
-        // new sellers at the same price would be added at the upper
-        // bound for that price, where they are last in line.) The lower
-        // bound, on the other hand, is first in line.  So we start
-        // there, and loop forwards until there are no other asks within
-        // my price range.
-        //
-        for (auto& it : m_mapAsks) {
-            // then I want to start at the lowest seller and loop UP
-            // until hitting my price limit.
-            OTOffer* pAsk = it.second;
-            OT_ASSERT(nullptr != pAsk);
-
-            // NOTE: Market orders only process once, and they are
-            // processed in the order they were added to the market.
-            //
-            // If BOTH offers are market orders, we just skip this ask.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pAsk! Imagine if pAsk is a market order
-            // and theOffer isn't -- that would mean pAsk hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
-            //
-            if (pAsk->IsMarketOrder())
-                //          if (theOffer.IsMarketOrder() &&
-                // pAsk->IsMarketOrder())
-                continue;
 
-            // I'm buying.
-            // If the ask price is less than, or equal to, my price
-            // limit, and the amount available for purchase is at least
-            // my minimum increment, (and vice versa),
-            // ...then let's trade!
-            //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pAsk->GetPriceLimit() <=
-                 theOffer.GetPriceLimit()))  // Or if this ask is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.) So all
-                // the other "if"s have to go INSIDE the block here:
-                //
-                if ((pAsk->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pAsk->GetMinimumIncrement()) &&
-                    (nullptr != pAsk->GetTrade()) &&
-                    !pAsk->GetTrade()->IsFlaggedForRemoval())
-
-                    ProcessTrade(
-                        wallet, theTrade, theOffer, *pAsk, reason);  // <======
-            }
-            // Else, the ask price is higher than I am willing to pay.
-            // (And all the remaining sellers are even HIGHER.)
-            else if (theOffer.IsLimitOrder()) {
-                pAsk = nullptr;
-                return true;  // stay on the market for now.
-            }
-
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                LogVerbose(OT_METHOD)(__FUNCTION__)(
-                    ": Removing market order: ")(theTrade.GetOpeningNum())(
-                    ". IsFlaggedForRemoval: ")(theTrade.IsFlaggedForRemoval())(
-                    ". Minimum increment is larger than Amount ")(
-                    "available: ")(theOffer.GetMinimumIncrement())(
-                    theOffer.GetAmountAvailable())
-                    .Flush();
-
-                return false;  // remove this trade from the market.
-            }
+        return true;
+    });
 
-            pAsk = nullptr;
-        }
-    }
+    if (false == bStayOnMarket) return false;  // remove this trade from cron
 
     // Market orders only process once.
     // (So tell the caller to remove it.)
@@ -2723,18 +2625,19 @@ void OTMarket::Release_Market()
 
     // If there were any dynamically allocated objects, clean them up
     // here.
-    while (!m_mapBids.empty()) {
-        OTOffer* pOffer = m_mapBids.begin()->second;
-        m_mapBids.erase(m_mapBids.begin());
-        delete pOffer;
-        pOffer = nullptr;
+    for (auto& [lPrice, queue] : m_mapBids) {
+        for (OTOffer* pOffer : queue) { delete pOffer; }
     }
-    while (!m_mapAsks.empty()) {
-        OTOffer* pOffer = m_mapAsks.begin()->second;
-        m_mapAsks.erase(m_mapAsks.begin());
-        delete pOffer;
-        pOffer = nullptr;
+
+    for (auto& [lPrice, queue] : m_mapAsks) {
+        for (OTOffer* pOffer : queue) { delete pOffer; }
     }
+
+    m_mapBids.clear();
+    m_mapAsks.clear();
+    m_mapOffers.clear();
+    m_nBidCount = 0;
+    m_nAskCount = 0;
 }
 
 void OTMarket::Release()
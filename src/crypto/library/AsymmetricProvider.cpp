@@ -10,6 +10,7 @@
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/crypto/key/Asymmetric.hpp"
 
 #include "util/Sodium.hpp"
 
@@ -17,12 +18,235 @@ extern "C" {
 #include <sodium.h>
 }
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include "AsymmetricProvider.hpp"
 
+// Bounded so that a flood of distinct signatures can not grow it without limit
+#define OT_VERIFICATION_CACHE_SIZE 32768
+// Batches are only spread over threads when each gets at least this many items
+#define OT_BATCH_ITEMS_PER_THREAD 8
+#define OT_BATCH_MAX_THREADS 4
+
 #define OT_METHOD "opentxs::crypto::AsymmetricProvider::"
 
 namespace opentxs::crypto
 {
+namespace
+{
+class VerificationCache
+{
+public:
+    std::atomic<std::uint64_t> hits_;
+    std::atomic<std::uint64_t> misses_;
+
+    bool Check(const std::string& id) noexcept
+    {
+        Lock lock(lock_);
+        auto it = index_.find(id);
+
+        if (index_.end() == it) {
+            ++misses_;
+
+            return false;
+        }
+
+        order_.splice(order_.begin(), order_, it->second);
+        ++hits_;
+
+        return true;
+    }
+
+    void Add(const std::string& id) noexcept
+    {
+        Lock lock(lock_);
+
+        if (0 < index_.count(id)) { return; }
+
+        order_.emplace_front(id);
+        index_.emplace(id, order_.begin());
+
+        if (OT_VERIFICATION_CACHE_SIZE < order_.size()) {
+            index_.erase(order_.back());
+            order_.pop_back();
+        }
+    }
+
+    VerificationCache() noexcept
+        : hits_(0)
+        , misses_(0)
+        , lock_()
+        , order_()
+        , index_()
+    {
+    }
+
+private:
+    using Order = std::list<std::string>;
+
+    std::mutex lock_;
+    Order order_;
+    std::unordered_map<std::string, Order::iterator> index_;
+
+    VerificationCache(const VerificationCache&) = delete;
+    VerificationCache(VerificationCache&&) = delete;
+    VerificationCache& operator=(const VerificationCache&) = delete;
+    VerificationCache& operator=(VerificationCache&&) = delete;
+};
+
+VerificationCache& verification_cache() noexcept
+{
+    static VerificationCache cache{};
+
+    return cache;
+}
+
+// Threads shared by every batch, so that a batch does not pay for starting
+// and joining its own. The calling thread always works on its batch too, so
+// a batch still finishes if every pool thread is busy with another one.
+class BatchPool
+{
+public:
+    using Job = std::function<void(const std::size_t)>;
+
+    void Run(
+        const std::size_t count,
+        const std::size_t helpers,
+        const Job& job) noexcept
+    {
+        auto batch = std::make_shared<Batch>(count, job);
+
+        {
+            Lock lock(lock_);
+
+            for (std::size_t i{0}; i < helpers; ++i) {
+                queue_.emplace_back(batch);
+            }
+        }
+
+        queue_cv_.notify_all();
+        batch->run();
+        Lock lock(lock_);
+        // Any pool thread which has not picked the batch up by now would
+        // find nothing left to do
+        queue_.erase(
+            std::remove(queue_.begin(), queue_.end(), batch), queue_.end());
+        done_cv_.wait(lock, [&] { return 0 == batch->active_; });
+    }
+
+    BatchPool(const std::size_t threads) noexcept
+        : lock_()
+        , queue_cv_()
+        , done_cv_()
+        , queue_()
+        , threads_()
+        , stop_(false)
+    {
+        for (std::size_t i{0}; i < threads; ++i) {
+            try {
+                threads_.emplace_back(&BatchPool::worker, this);
+            } catch (...) {
+                // The caller does the work of any thread which is missing
+                break;
+            }
+        }
+    }
+
+    ~BatchPool()
+    {
+        {
+            Lock lock(lock_);
+            stop_ = true;
+        }
+
+        queue_cv_.notify_all();
+
+        for (auto& thread : threads_) {
+            if (thread.joinable()) { thread.join(); }
+        }
+    }
+
+private:
+    struct Batch {
+        const std::size_t count_;
+        const Job& job_;
+        std::atomic<std::size_t> next_;
+        // Pool threads working on this batch. Guarded by BatchPool::lock_
+        std::size_t active_;
+
+        void run() noexcept
+        {
+            for (auto i = next_++; i < count_; i = next_++) { job_(i); }
+        }
+
+        Batch(const std::size_t count, const Job& job) noexcept
+            : count_(count)
+            , job_(job)
+            , next_(0)
+            , active_(0)
+        {
+        }
+    };
+
+    std::mutex lock_;
+    std::condition_variable queue_cv_;
+    std::condition_variable done_cv_;
+    std::deque<std::shared_ptr<Batch>> queue_;
+    std::vector<std::thread> threads_;
+    bool stop_;
+
+    void worker() noexcept
+    {
+        Lock lock(lock_);
+
+        while (true) {
+            queue_cv_.wait(lock, [&] { return stop_ || (!queue_.empty()); });
+
+            if (stop_) { return; }
+
+            auto batch = queue_.front();
+            queue_.pop_front();
+            ++batch->active_;
+            lock.unlock();
+            batch->run();
+            lock.lock();
+            --batch->active_;
+            done_cv_.notify_all();
+        }
+    }
+
+    BatchPool() = delete;
+    BatchPool(const BatchPool&) = delete;
+    BatchPool(BatchPool&&) = delete;
+    BatchPool& operator=(const BatchPool&) = delete;
+    BatchPool& operator=(BatchPool&&) = delete;
+};
+
+BatchPool& batch_pool() noexcept
+{
+    static BatchPool pool{
+        std::min<std::size_t>(
+            OT_BATCH_MAX_THREADS,
+            std::max(std::thread::hardware_concurrency(), 1u)) -
+        1};
+
+    return pool;
+}
+}  // namespace
+
 proto::AsymmetricKeyType AsymmetricProvider::CurveToKeyType(
     const EcdsaCurve& curve)
 {
@@ -68,6 +292,16 @@ EcdsaCurve AsymmetricProvider::KeyTypeToCurve(
 
     return output;
 }
+
+std::uint64_t AsymmetricProvider::VerificationCacheHits() noexcept
+{
+    return verification_cache().hits_.load();
+}
+
+std::uint64_t AsymmetricProvider::VerificationCacheMisses() noexcept
+{
+    return verification_cache().misses_.load();
+}
 }  // namespace opentxs::crypto
 
 namespace opentxs::crypto::implementation
@@ -77,6 +311,43 @@ AsymmetricProvider::AsymmetricProvider() noexcept
     if (0 > ::sodium_init()) { OT_FAIL; }
 }
 
+auto AsymmetricProvider::failures(const Results& results) noexcept
+    -> std::vector<std::size_t>
+{
+    auto output = std::vector<std::size_t>{};
+
+    for (std::size_t i{0}; i < results.size(); ++i) {
+        if (0 == results.at(i)) { output.emplace_back(i); }
+    }
+
+    return output;
+}
+
+auto AsymmetricProvider::parallel(
+    const std::size_t count,
+    const std::function<void(const std::size_t)>& job) -> void
+{
+    const auto threads = std::min<std::size_t>(
+        {OT_BATCH_MAX_THREADS,
+         std::max(std::thread::hardware_concurrency(), 1u),
+         count / OT_BATCH_ITEMS_PER_THREAD});
+
+    if (2 > threads) {
+        for (std::size_t i{0}; i < count; ++i) { job(i); }
+
+        return;
+    }
+
+    batch_pool().Run(count, threads - 1, job);
+}
+
+auto AsymmetricProvider::set_verified(const std::string& id) noexcept -> void
+{
+    if (id.empty()) { return; }
+
+    verification_cache().Add(id);
+}
+
 auto AsymmetricProvider::SeedToCurveKey(
     const ReadView seed,
     const AllocateOutput privateKey,
@@ -143,4 +414,68 @@ auto AsymmetricProvider::VerifyContractSignature(
 
     return Verify(plaintext, theKey, signature, hashType);
 }
+
+auto AsymmetricProvider::VerifyBatch(
+    const std::vector<VerifyItem>& items) const -> std::vector<std::size_t>
+{
+    auto results = Results(items.size(), 0);
+    parallel(items.size(), [&](const std::size_t i) {
+        const auto& [plaintext, key, signature, hash] = items.at(i);
+        results[i] = Verify(plaintext, key, signature, hash);
+    });
+
+    return failures(results);
+}
+
+auto AsymmetricProvider::verification_id(
+    const Data& plaintext,
+    const key::Asymmetric& key,
+    const Data& signature,
+    const proto::HashType type) noexcept -> std::string
+{
+    const auto pub = key.PublicKey();
+
+    if (nullptr == pub.data() || 0 == pub.size() || 0 == signature.size()) {
+        return {};
+    }
+
+    const auto keyType = static_cast<std::uint32_t>(key.keyType());
+    const auto hashType = static_cast<std::uint32_t>(type);
+    const auto pubSize = static_cast<std::uint64_t>(pub.size());
+    const auto sigSize = static_cast<std::uint64_t>(signature.size());
+    auto output = std::string(crypto_generichash_BYTES, '\0');
+    auto state = ::crypto_generichash_state{};
+    const auto update = [&state](const void* data, const std::size_t size) {
+        ::crypto_generichash_update(
+            &state, static_cast<const unsigned char*>(data), size);
+    };
+
+    if (0 != ::crypto_generichash_init(&state, nullptr, 0, output.size())) {
+        return {};
+    }
+
+    update(&keyType, sizeof(keyType));
+    update(&hashType, sizeof(hashType));
+    update(&pubSize, sizeof(pubSize));
+    update(pub.data(), pub.size());
+    update(&sigSize, sizeof(sigSize));
+    update(signature.data(), signature.size());
+    update(plaintext.data(), plaintext.size());
+
+    if (0 != ::crypto_generichash_final(
+                 &state,
+                 reinterpret_cast<unsigned char*>(&output[0]),
+                 output.size())) {
+        return {};
+    }
+
+    return output;
+}
+
+auto AsymmetricProvider::verified(const std::string& id) noexcept -> bool
+{
+    if (id.empty()) { return false; }
+
+    return verification_cache().Check(id);
+}
 }  // namespace opentxs::crypto::implementation
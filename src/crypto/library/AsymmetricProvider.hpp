@@ -9,6 +9,12 @@
 
 #include "opentxs/crypto/library/AsymmetricProvider.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
 namespace opentxs::crypto::implementation
 {
 class AsymmetricProvider : virtual public crypto::AsymmetricProvider
@@ -25,6 +31,8 @@ public:
         Signature& theSignature,  // output
         const proto::HashType hashType,
         const PasswordPrompt& reason) const override;
+    std::vector<std::size_t> VerifyBatch(
+        const std::vector<VerifyItem>& items) const override;
     bool VerifyContractSignature(
         const String& strContractToVerify,
         const key::Asymmetric& theKey,
@@ -34,6 +42,26 @@ public:
     ~AsymmetricProvider() override = default;
 
 protected:
+    using Results = std::vector<std::uint8_t>;
+
+    static std::vector<std::size_t> failures(const Results& results) noexcept;
+    /** Calls job for every index below count, using a few threads from a
+     * shared pool if count is large enough to be worth it. job must not
+     * throw. */
+    static void parallel(
+        const std::size_t count,
+        const std::function<void(const std::size_t)>& job);
+    /** Successful verifications are remembered, keyed by this digest of the
+     * key, hash type, signature and signed bytes. Returns an empty id if the
+     * verification can not be cached. */
+    static std::string verification_id(
+        const Data& plaintext,
+        const key::Asymmetric& key,
+        const Data& signature,
+        const proto::HashType type) noexcept;
+    static bool verified(const std::string& id) noexcept;
+    static void set_verified(const std::string& id) noexcept;
+
     AsymmetricProvider() noexcept;
 
 private:
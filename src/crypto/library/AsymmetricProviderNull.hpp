@@ -9,6 +9,9 @@
 
 #include "opentxs/crypto/library/AsymmetricProvider.hpp"
 
+#include <cstddef>
+#include <vector>
+
 namespace opentxs::crypto::implementation
 {
 class AsymmetricProviderNull final : virtual public crypto::AsymmetricProvider
@@ -67,6 +70,17 @@ public:
     {
         return false;
     }
+    std::vector<std::size_t> VerifyBatch(
+        const std::vector<VerifyItem>& items) const final
+    {
+        auto output = std::vector<std::size_t>{};
+
+        for (std::size_t i{0}; i < items.size(); ++i) {
+            output.emplace_back(i);
+        }
+
+        return output;
+    }
     bool VerifyContractSignature(
         const String&,
         const key::Asymmetric&,
@@ -881,6 +881,10 @@ auto OpenSSL::Verify(
         }
     }
 
+    const auto id = verification_id(in, key, sig, type);
+
+    if (verified(id)) { return true; }
+
     auto md = MD{};
 
     if (false == md.init_verify(type, key)) { return false; }
@@ -909,6 +913,8 @@ auto OpenSSL::Verify(
         return false;
     }
 
+    set_verified(id);
+
     return true;
 }
 
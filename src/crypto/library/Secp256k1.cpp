@@ -31,8 +31,13 @@ extern "C" {
 }
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <map>
 #include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "Secp256k1.hpp"
 
@@ -335,16 +340,17 @@ bool Secp256k1::Verify(
         return false;
     }
 
+    const auto id = verification_id(plaintext, key, signature, type);
+
+    if (verified(id)) { return true; }
+
     try {
-        const auto digest = hash(type, plaintext);
-        const auto parsed = parsed_public_key(key.PublicKey());
-        const auto sig = parsed_signature(signature.Bytes());
-
-        return 1 == ::secp256k1_ecdsa_verify(
-                        context_,
-                        &sig,
-                        reinterpret_cast<const unsigned char*>(digest->data()),
-                        &parsed);
+        const auto success = verify(
+            plaintext, parsed_public_key(key.PublicKey()), signature, type);
+
+        if (success) { set_verified(id); }
+
+        return success;
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -352,6 +358,70 @@ bool Secp256k1::Verify(
     }
 }
 
+auto Secp256k1::verify(
+    const Data& plaintext,
+    const ::secp256k1_pubkey& key,
+    const Data& signature,
+    const proto::HashType type) const noexcept(false) -> bool
+{
+    const auto digest = hash(type, plaintext);
+    const auto sig = parsed_signature(signature.Bytes());
+
+    return 1 == ::secp256k1_ecdsa_verify(
+                    context_,
+                    &sig,
+                    reinterpret_cast<const unsigned char*>(digest->data()),
+                    &key);
+}
+
+auto Secp256k1::VerifyBatch(const std::vector<VerifyItem>& items) const
+    -> std::vector<std::size_t>
+{
+    // Parse every distinct public key once, before the work is spread out
+    auto keys = std::map<std::string, ::secp256k1_pubkey>{};
+
+    for (const auto& item : items) {
+        if (proto::AKEYTYPE_SECP256K1 != item.key_.keyType()) { continue; }
+
+        const auto pub = item.key_.PublicKey();
+        auto id = std::string{pub};
+
+        if (0 < keys.count(id)) { continue; }
+
+        try {
+            keys.emplace(std::move(id), parsed_public_key(pub));
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+        }
+    }
+
+    auto results = Results(items.size(), 0);
+    parallel(items.size(), [&](const std::size_t i) {
+        const auto& [plaintext, key, signature, type] = items.at(i);
+        const auto parsed = keys.find(std::string{key.PublicKey()});
+
+        if (keys.end() == parsed) { return; }
+
+        const auto id = verification_id(plaintext, key, signature, type);
+
+        if (verified(id)) {
+            results[i] = 1;
+
+            return;
+        }
+
+        try {
+            if (verify(plaintext, parsed->second, signature, type)) {
+                set_verified(id);
+                results[i] = 1;
+            }
+        } catch (...) {
+        }
+    });
+
+    return failures(results);
+}
+
 auto Secp256k1::hash(const proto::HashType type, const Data& data) const
     noexcept(false) -> OTData
 {
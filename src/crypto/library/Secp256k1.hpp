@@ -43,6 +43,8 @@ public:
         const key::Asymmetric& theKey,
         const Data& signature,
         const proto::HashType hashType) const final;
+    std::vector<std::size_t> VerifyBatch(
+        const std::vector<VerifyItem>& items) const final;
 
     void Init() final;
 
@@ -64,6 +66,11 @@ private:
         -> ::secp256k1_pubkey;
     auto parsed_signature(const ReadView bytes) const noexcept(false)
         -> ::secp256k1_ecdsa_signature;
+    auto verify(
+        const Data& plaintext,
+        const ::secp256k1_pubkey& key,
+        const Data& signature,
+        const proto::HashType type) const noexcept(false) -> bool;
 
     Secp256k1(const api::Crypto& crypto, const api::crypto::Util& ssl);
     Secp256k1() = delete;
@@ -659,6 +659,10 @@ bool Sodium::Verify(
         return false;
     }
 
+    const auto id = verification_id(plaintext, key, signature, type);
+
+    if (verified(id)) { return true; }
+
     const auto success =
         0 == ::crypto_sign_verify_detached(
                  static_cast<const unsigned char*>(signature.data()),
@@ -666,7 +670,9 @@ bool Sodium::Verify(
                  plaintext.size(),
                  reinterpret_cast<const unsigned char*>(pub.data()));
 
-    if (false == success) {
+    if (success) {
+        set_verified(id);
+    } else {
         LogVerbose(OT_METHOD)(__FUNCTION__)(": Failed to verify signature")
             .Flush();
     }
@@ -18,6 +18,7 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/crypto/key/Asymmetric.hpp"
 #include "opentxs/crypto/key/Keypair.hpp"
+#include "opentxs/crypto/library/AsymmetricProvider.hpp"
 #include "opentxs/identity/Source.hpp"
 #include "opentxs/Proto.tpp"
 
@@ -33,6 +34,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "Authority.hpp"
 
@@ -1256,7 +1258,10 @@ bool Authority::VerifyInternally() const
         return false;
     }
 
-    bool output{true};
+    // The batch result decides whether the signatures are valid. The
+    // per-credential validation checks everything else, and repeats only the
+    // signature checks which failed or could not be batched.
+    bool output = verify_signatures();
     const auto validate = [&](const auto& item) -> void {
         output &= validate_credential(item);
     };
@@ -1268,6 +1273,105 @@ bool Authority::VerifyInternally() const
     return output;
 }
 
+// Checks the master signature of every child credential, and the self
+// signature of every key credential, with one batch call per crypto provider.
+// Returns false if any of them failed. Successful verifications are cached by
+// the provider, so the per-credential validation which follows does not
+// repeat them.
+bool Authority::verify_signatures() const
+{
+    struct Check {
+        const credential::Base& credential_;
+        OTData plaintext_;
+        OTData signature_;
+        const crypto::key::Asymmetric& key_;
+        proto::HashType hash_;
+    };
+
+    auto checks = std::vector<Check>{};
+    const auto add = [&](const credential::Base& credential,
+                         const proto::Signature& sig,
+                         const crypto::key::Asymmetric& key) -> void {
+        auto serialized = credential.Serialized(AS_PUBLIC, WITHOUT_SIGNATURES);
+
+        if (false == bool(serialized)) { return; }
+
+        auto& signature = *serialized->add_signature();
+        signature.CopyFrom(sig);
+        signature.clear_signature();
+        checks.emplace_back(Check{
+            credential,
+            api_.Factory().Data(*serialized),
+            Data::Factory(sig.signature().data(), sig.signature().size()),
+            key,
+            sig.hashtype()});
+    };
+
+    // Anything which can not be checked here is reported by the
+    // per-credential validation instead
+    const crypto::key::Asymmetric* masterKey{nullptr};
+
+    try {
+        masterKey = &master_->GetKeypair(proto::KEYROLE_SIGN).GetPublicKey();
+    } catch (...) {
+
+        return true;
+    }
+
+    const auto master = [&](const auto& item) -> void {
+        const auto& credential = *item.second;
+        const auto sig = credential.MasterSignature();
+
+        if (sig) { add(credential, *sig, *masterKey); }
+    };
+    const auto self = [&](const auto& item) -> void {
+        const auto& credential = *item.second;
+        const auto sig = credential.SelfSignature(PUBLIC_VERSION);
+
+        if (false == bool(sig)) { return; }
+
+        try {
+            add(credential,
+                *sig,
+                credential.GetKeypair(proto::KEYROLE_SIGN).GetPublicKey());
+        } catch (...) {
+        }
+    };
+
+    for_each(key_credentials_, master);
+    for_each(key_credentials_, self);
+    for_each(contact_credentials_, master);
+    for_each(verification_credentials_, master);
+
+    struct Batch {
+        std::vector<const Check*> checks_{};
+        std::vector<crypto::AsymmetricProvider::VerifyItem> items_{};
+    };
+
+    auto batches = std::map<const crypto::AsymmetricProvider*, Batch>{};
+
+    for (const auto& check : checks) {
+        auto& batch = batches[&check.key_.engine()];
+        batch.checks_.emplace_back(&check);
+        batch.items_.emplace_back(crypto::AsymmetricProvider::VerifyItem{
+            check.plaintext_, check.key_, check.signature_, check.hash_});
+    }
+
+    bool output{true};
+
+    for (const auto& [engine, batch] : batches) {
+        for (const auto& index : engine->VerifyBatch(batch.items_)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Invalid signature on credential ")(
+                batch.checks_.at(index)->credential_.ID())
+                .Flush();
+            output = false;
+        }
+    }
+
+    return output;
+}
+
 bool Authority::WriteCredentials() const
 {
     if (!master_->Save()) {
@@ -215,6 +215,7 @@ private:
 
     template <typename Item>
     bool validate_credential(const Item& item) const;
+    bool verify_signatures() const;
 
     bool LoadChildKeyCredential(const String& strSubID);
     bool LoadChildKeyCredential(const proto::Credential& serializedCred);
@@ -64,6 +64,8 @@ using FilterHash = opentxs::blockchain::client::internal::FilterDatabase::Hash;
 using FilterHeader =
     opentxs::blockchain::client::internal::FilterDatabase::Header;
 using FilterType = opentxs::blockchain::filter::Type;
+using FilterVisitor =
+    opentxs::blockchain::client::internal::FilterDatabase::FilterVisitor;
 using Position = opentxs::blockchain::block::Position;
 using Protocol = opentxs::blockchain::p2p::Protocol;
 using Service = opentxs::blockchain::p2p::Service;
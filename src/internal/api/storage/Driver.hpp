@@ -0,0 +1,46 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "opentxs/Forward.hpp"
+
+#include "opentxs/api/storage/Driver.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace opentxs::api::storage
+{
+// Operations needed by the mark and sweep garbage collector. Kept out of the
+// exported Driver interface so that adding them does not change its ABI.
+class DriverInternal : virtual public Driver
+{
+public:
+    /// Lists every key stored in the bucket. Returns false if the driver can
+    /// not enumerate its keys.
+    virtual bool BucketKeys(const bool bucket, std::vector<std::string>& keys)
+        const = 0;
+    /// Removes individual objects from the bucket. Returns false if the
+    /// driver can not delete individual objects.
+    virtual bool DeleteFromBucket(
+        const std::vector<std::string>& keys,
+        const bool bucket) const = 0;
+    /// Number of asynchronous writes waiting for a writer thread
+    virtual std::size_t QueueDepth() const noexcept = 0;
+
+    ~DriverInternal() override = default;
+
+protected:
+    DriverInternal() = default;
+
+private:
+    DriverInternal(const DriverInternal&) = delete;
+    DriverInternal(DriverInternal&&) = delete;
+    DriverInternal& operator=(const DriverInternal&) = delete;
+    DriverInternal& operator=(DriverInternal&&) = delete;
+};
+}  // namespace opentxs::api::storage
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace be = boost::endian;
 
@@ -72,6 +73,78 @@ private:
     BitWriter() = delete;
 };
 
+// Decodes a Golomb-Rice coded set one 64 bit word at a time. Bits past the
+// end of the input are read as zero, which matches BitReader.
+class GolombDecoder
+{
+public:
+    OPENTXS_EXPORT std::uint64_t next() noexcept;
+
+    OPENTXS_EXPORT GolombDecoder(
+        const std::uint32_t bits,
+        const ReadView filter) noexcept;
+
+private:
+    enum { WORD_BITS = sizeof(std::uint64_t) * 8 };
+
+    const std::uint32_t bits_;
+    const std::uint8_t* data_;
+    const std::uint8_t* const end_;
+    std::uint64_t word_;
+    std::size_t available_;
+
+    void consume(const std::size_t nbits) noexcept;
+    void refill() noexcept;
+
+    GolombDecoder() = delete;
+    GolombDecoder(const GolombDecoder&) = delete;
+    GolombDecoder(GolombDecoder&&) = delete;
+    GolombDecoder& operator=(const GolombDecoder&) = delete;
+    GolombDecoder& operator=(GolombDecoder&&) = delete;
+};
+
+// SipHash-2-4 with the key expanded once, for hashing many filter elements
+// under the same key without allocating a secret or going through
+// api::crypto::Hash for each of them.
+class SipHasher
+{
+public:
+    OPENTXS_EXPORT std::uint64_t operator()(const ReadView item) const
+        noexcept;
+    // Hashes items into output, which must have room for items.size() values
+    OPENTXS_EXPORT void operator()(
+        const std::vector<OTData>& items,
+        std::uint64_t* output) const noexcept;
+
+    OPENTXS_EXPORT SipHasher(const ReadView key) noexcept;
+
+private:
+    enum { LANES = 4 };
+
+    struct State {
+        std::uint64_t v0_;
+        std::uint64_t v1_;
+        std::uint64_t v2_;
+        std::uint64_t v3_;
+    };
+
+    std::uint64_t k0_;
+    std::uint64_t k1_;
+
+    static void compress(State& state, const std::uint64_t block) noexcept;
+    static std::uint64_t finish(
+        State& state,
+        const ReadView item,
+        std::size_t offset) noexcept;
+    static void round(State& state) noexcept;
+
+    void hash_lanes(const ReadView* items, std::uint64_t* output) const
+        noexcept;
+    State init() const noexcept;
+
+    SipHasher() = delete;
+};
+
 struct GCS {
     virtual OTData Encode() const noexcept = 0;
     virtual OTData Hash() const noexcept = 0;
@@ -82,6 +155,42 @@ struct GCS {
     virtual ~GCS() = default;
 };
 
+// Read-only view of a serialized proto::GCS which refers to the serialized
+// bytes instead of copying them. The view is only valid as long as the memory
+// it was constructed from, which for filters loaded via
+// LMDB::Load(..., parent) is the lifetime of the parent transaction.
+class GCSView
+{
+public:
+    operator bool() const noexcept { return valid_; }
+
+    std::uint32_t Bits() const noexcept { return bits_; }
+    std::uint32_t Count() const noexcept { return count_; }
+    // Golomb-Rice coded bitstream without the element count prefix
+    ReadView Filter() const noexcept { return filter_; }
+    std::uint32_t FPRate() const noexcept { return fp_rate_; }
+    ReadView Key() const noexcept { return key_; }
+    bool Test(const std::vector<OTData>& targets) const noexcept;
+
+    GCSView(const ReadView serialized) noexcept;
+    GCSView(const GCSView&) noexcept = default;
+
+private:
+    bool valid_;
+    std::uint32_t bits_;
+    std::uint32_t fp_rate_;
+    std::uint32_t count_;
+    ReadView key_;
+    ReadView filter_;
+
+    bool parse(const ReadView serialized) noexcept;
+
+    GCSView() = delete;
+    GCSView(GCSView&&) = delete;
+    GCSView& operator=(const GCSView&) = delete;
+    GCSView& operator=(GCSView&&) = delete;
+};
+
 struct SerializedBloomFilter {
     be::little_uint32_buf_t function_count_;
     be::little_uint32_buf_t tweak_;
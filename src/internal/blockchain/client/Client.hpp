@@ -22,6 +22,8 @@
 #include <boost/asio.hpp>
 #include <boost/thread/thread.hpp>
 
+#include <atomic>
+#include <functional>
 #include <future>
 #include <map>
 #include <memory>
@@ -72,6 +74,10 @@ struct FilterDatabase {
     using Header = std::tuple<block::pHash, block::pHash, ReadView>;
     using Filter =
         std::pair<ReadView, std::unique_ptr<const blockchain::internal::GCS>>;
+    /// index of the block hash in the request, filter or an invalid view if
+    /// the filter is not stored. Return false to stop reading.
+    using FilterVisitor = std::function<
+        bool(const std::size_t, const blockchain::internal::GCSView&)>;
 
     virtual block::Position FilterHeaderTip(const filter::Type type) const
         noexcept = 0;
@@ -86,12 +92,26 @@ struct FilterDatabase {
         const noexcept = 0;
     virtual Hash LoadFilterHeader(const filter::Type type, const ReadView block)
         const noexcept = 0;
+    /// Reads every filter in a single read transaction without copying
+    ///
+    /// The views passed to cb are only valid until cb returns
+    virtual bool ReadFilters(
+        const filter::Type type,
+        const std::vector<ReadView>& blocks,
+        const FilterVisitor& cb) const noexcept = 0;
+    virtual block::Position RescanTip(
+        const filter::Type type,
+        const Identifier& key) const noexcept = 0;
     virtual bool SetFilterHeaderTip(
         const filter::Type type,
         const block::Position position) const noexcept = 0;
     virtual bool SetFilterTip(
         const filter::Type type,
         const block::Position position) const noexcept = 0;
+    virtual bool SetRescanTip(
+        const filter::Type type,
+        const Identifier& key,
+        const block::Position position) const noexcept = 0;
     virtual bool StoreFilters(
         const filter::Type type,
         std::vector<Filter> filters) const noexcept = 0;
@@ -104,6 +124,10 @@ struct FilterDatabase {
 };
 
 struct FilterOracle {
+    /// matching blocks in ascending height order
+    using Matches = std::vector<block::Position>;
+    using RescanCallback = std::function<void(const Matches&)>;
+
     virtual void AddFilter(
         const filter::Type type,
         const block::Hash& block,
@@ -114,6 +138,16 @@ struct FilterOracle {
         const ReadView previousHeader,
         const std::vector<ReadView> hashes) const noexcept = 0;
     virtual void CheckBlocks() const noexcept = 0;
+    /** Scan stored filters for blocks which match the keys of a subaccount
+     *
+     *  The scan runs in the background and resumes from the last block
+     *  scanned for that subaccount. It is repeated whenever new filters are
+     *  stored. cb is called with the matches of each completed range before
+     *  the resume position is saved.
+     */
+    virtual void Rescan(
+        const api::client::blockchain::HD& account,
+        const RescanCallback cb) const noexcept = 0;
 
     virtual void Start() noexcept = 0;
     virtual std::shared_future<void> Shutdown() noexcept = 0;
@@ -153,17 +187,42 @@ struct HeaderDatabase {
 
 struct IO {
     using tcp = boost::asio::ip::tcp;
+    using BodySize = std::function<std::size_t(const zmq::Frame& header)>;
 
-    operator boost::asio::io_context&() const noexcept { return context_; }
+    struct ThreadLoad {
+        std::size_t peers_;
+        std::size_t messages_;
+        std::size_t bytes_;
+    };
 
+    // For objects which are not peers, such as resolvers
+    operator boost::asio::io_context&() const noexcept
+    {
+        return engines_.front()->context_;
+    }
+
+    /** Selects the I/O thread with the fewest peers
+     *
+     *  All operations on a socket constructed from the returned context run
+     *  on that thread. Every call must be balanced by a call to Detach().
+     */
+    auto Attach() const noexcept -> boost::asio::io_context&;
     auto Connect(
         const Space& id,
         const tcp::endpoint& endpoint,
         tcp::socket& socket) const noexcept -> void;
+    auto Detach(tcp::socket& socket) const noexcept -> void;
+    auto Load() const noexcept -> std::vector<ThreadLoad>;
+    /** Reads one framed message (header, then body) from the socket
+     *
+     *  Both parts are read directly into the frames of the message which is
+     *  delivered to the connection, so no intermediate buffers are used.
+     */
     auto Receive(
         const Space& id,
         const OTZMQWorkType type,
-        const std::size_t bytes,
+        const std::size_t headerBytes,
+        const BodySize bodySize,
         tcp::socket& socket) const noexcept -> void;
 
     auto AddNetwork() noexcept -> void;
@@ -173,21 +232,28 @@ struct IO {
     ~IO();
 
 private:
+    struct Engine {
+        boost::asio::io_context context_;
+        std::unique_ptr<boost::asio::io_context::work> work_;
+        std::atomic<std::size_t> peers_;
+        std::atomic<std::size_t> messages_;
+        std::atomic<std::size_t> bytes_;
+
+        Engine() noexcept;
+    };
+
     const api::Core& api_;
-    mutable std::mutex lock_;
     OTZMQListenCallback cb_;
     OTZMQRouterSocket socket_;
-    mutable int next_buffer_;
-    mutable std::map<int, Space> buffers_;
-    mutable boost::asio::io_context context_;
-    std::unique_ptr<boost::asio::io_context::work> work_;
+    const std::vector<std::unique_ptr<Engine>> engines_;
     boost::thread_group thread_pool_;
 
-    auto clear_buffer(const int id) const noexcept -> void;
-    auto get_buffer(const std::size_t bytes) const noexcept
-        -> std::pair<int, WritableView>;
+    static auto make_engines(const api::Core& api) noexcept
+        -> std::vector<std::unique_ptr<Engine>>;
 
     auto callback(zmq::Message& in) noexcept -> void;
+    auto disconnect(const Space& id) const noexcept -> void;
+    auto engine(tcp::socket& socket) const noexcept -> Engine*;
 
     IO() = delete;
     IO(const IO&) = delete;
@@ -206,6 +272,7 @@ struct Network : virtual public opentxs::blockchain::Network {
     };
 
     virtual Type Chain() const noexcept = 0;
+    virtual const internal::FilterOracle& FilterOracle() const noexcept = 0;
     virtual const client::HeaderOracle& HeaderOracle() const noexcept = 0;
     virtual bool IsSynchronized() const noexcept = 0;
     virtual void RequestFilterHeaders(
@@ -251,8 +318,6 @@ struct PeerManager {
         Getcfheaders = 1,
         Getcfilters = 2,
         Heartbeat = 3,
-        Body = 126,
-        Header = 127,
         Connect = OT_ZMQ_CONNECT_SIGNAL,
         Disconnect = OT_ZMQ_DISCONNECT_SIGNAL,
         ReceiveMessage = OT_ZMQ_RECEIVE_SIGNAL,
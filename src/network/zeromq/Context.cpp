@@ -26,6 +26,7 @@
 #include "opentxs/network/zeromq/Proxy.hpp"
 
 #include "PairEventListener.hpp"
+#include "Reactor.hpp"
 
 #include <zmq.h>
 
@@ -39,6 +40,11 @@ template class opentxs::Pimpl<opentxs::network::zeromq::Context>;
 #define PATH_SEPERATOR "/"
 #define OT_METHOD "opentxs::Context::"
 
+// Receiver callback threads kept alive while idle, and the most which may run
+// at once
+#define OT_ZMQ_REACTOR_CORE_WORKERS 4
+#define OT_ZMQ_REACTOR_MAX_WORKERS 64
+
 namespace opentxs
 {
 network::zeromq::Context* Factory::ZMQContext()
@@ -126,6 +132,11 @@ Context::Context() noexcept
     auto init = ::zmq_ctx_set(context_, ZMQ_MAX_SOCKETS, 16384);
 
     OT_ASSERT(0 == init);
+
+    reactor_ = std::make_unique<Reactor>(
+        context_, OT_ZMQ_REACTOR_CORE_WORKERS, OT_ZMQ_REACTOR_MAX_WORKERS);
+
+    OT_ASSERT(reactor_);
 }
 
 Context::operator void*() const noexcept
@@ -291,6 +302,8 @@ OTZMQSubscribeSocket Context::SubscribeSocket(
 
 Context::~Context()
 {
+    reactor_.reset();
+
     if (nullptr != context_) { zmq_ctx_shutdown(context_); }
 }
 }  // namespace opentxs::network::zeromq::implementation
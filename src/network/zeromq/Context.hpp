@@ -7,8 +7,12 @@
 
 #include "Internal.hpp"
 
+#include <memory>
+
 namespace opentxs::network::zeromq::implementation
 {
+class Reactor;
+
 class Context final : virtual public zeromq::Context
 {
 public:
@@ -74,12 +78,16 @@ public:
     OTZMQSubscribeSocket SubscribeSocket(const ListenCallback& callback) const
         noexcept final;
 
+    // Shared by every receiver socket created from this context
+    Reactor& Receivers() const noexcept { return *reactor_; }
+
     ~Context();
 
 private:
     friend opentxs::Factory;
 
     void* context_{nullptr};
+    std::unique_ptr<Reactor> reactor_{nullptr};
 
     Context* clone() const noexcept final { return new Context; }
 
@@ -9,6 +9,8 @@
 
 #include "opentxs/core/Log.hpp"
 
+#define OT_ZMQ_FRAME_POOL_SIZE 1024
+
 template class opentxs::Pimpl<opentxs::network::zeromq::Frame>;
 
 namespace opentxs
@@ -20,6 +22,13 @@ network::zeromq::Frame* Factory::ZMQFrame()
     return new ReturnType();
 }
 
+network::zeromq::Frame* Factory::ZMQFrame(const std::size_t size)
+{
+    using ReturnType = network::zeromq::implementation::Frame;
+
+    return new ReturnType(size);
+}
+
 network::zeromq::Frame* Factory::ZMQFrame(
     const void* data,
     const std::size_t size)
@@ -35,8 +44,65 @@ network::zeromq::Frame* Factory::ZMQFrame(const ProtobufType& data)
 
     return new ReturnType(data);
 }
+
+network::zeromq::Frame* Factory::ZMQFrame(
+    void* data,
+    const std::size_t size,
+    network::zeromq::Frame::Release release)
+{
+    using ReturnType = network::zeromq::implementation::Frame;
+
+    return new ReturnType(data, size, std::move(release));
+}
 }  // namespace opentxs
 
+namespace
+{
+// Released frame allocations, linked through their first bytes. These are
+// trivially destructible so frames destroyed late in thread or process exit
+// can still reach them.
+thread_local void* frame_pool_{nullptr};
+thread_local std::size_t frame_pool_size_{0};
+thread_local bool frame_pool_closed_{false};
+
+struct FramePoolCleanup {
+    bool registered_{true};
+
+    ~FramePoolCleanup()
+    {
+        frame_pool_closed_ = true;
+
+        while (nullptr != frame_pool_) {
+            auto* next = *static_cast<void**>(frame_pool_);
+            ::operator delete(frame_pool_);
+            frame_pool_ = next;
+        }
+
+        frame_pool_size_ = 0;
+    }
+};
+
+thread_local FramePoolCleanup frame_pool_cleanup_{};
+
+// Reading the cleanup constructs it for the calling thread, which registers
+// its destructor. Storage must never be pooled on a thread where that has not
+// happened, since nothing would free it when the thread exits.
+bool frame_pool_available() noexcept
+{
+    if (frame_pool_closed_) { return false; }
+
+    return frame_pool_cleanup_.registered_;
+}
+
+void release_frame(void*, void* hint) noexcept
+{
+    using Release = opentxs::network::zeromq::Frame::Release;
+    auto* release = static_cast<Release*>(hint);
+    (*release)();
+    delete release;
+}
+}  // namespace
+
 namespace opentxs::network::zeromq::implementation
 {
 Frame::Frame() noexcept
@@ -68,6 +134,25 @@ Frame::Frame(const void* data, const std::size_t bytes) noexcept
     std::memcpy(zmq_msg_data(&message_), data, zmq_msg_size(&message_));
 }
 
+Frame::Frame(void* data, const std::size_t bytes, Release&& release) noexcept
+    : zeromq::Frame()
+    , message_()
+{
+    auto* hint = release ? new Release(std::move(release)) : nullptr;
+    const auto init = zmq_msg_init_data(
+        &message_, data, bytes, hint ? release_frame : nullptr, hint);
+
+    OT_ASSERT(0 == init);
+}
+
+Frame::Frame(const Frame& rhs) noexcept
+    : Frame()
+{
+    const auto copied = zmq_msg_copy(&message_, &rhs.message_);
+
+    OT_ASSERT(0 == copied);
+}
+
 Frame::operator std::string() const noexcept
 {
     return std::string{Bytes()};
@@ -82,7 +167,40 @@ auto Frame::Bytes() const noexcept -> ReadView
 
 auto Frame::clone() const noexcept -> Frame*
 {
-    return new Frame(zmq_msg_data(&message_), zmq_msg_size(&message_));
+    return new Frame(*this);
+}
+
+void* Frame::operator new(std::size_t size)
+{
+    OT_ASSERT(sizeof(Frame) == size);
+
+    if ((false == frame_pool_available()) || (nullptr == frame_pool_)) {
+        return ::operator new(size);
+    }
+
+    auto* output = frame_pool_;
+    frame_pool_ = *static_cast<void**>(output);
+    --frame_pool_size_;
+
+    return output;
+}
+
+void Frame::operator delete(void* frame) noexcept
+{
+    if (nullptr == frame) { return; }
+
+    const auto pool = frame_pool_available() &&
+                      (OT_ZMQ_FRAME_POOL_SIZE > frame_pool_size_);
+
+    if (false == pool) {
+        ::operator delete(frame);
+
+        return;
+    }
+
+    *static_cast<void**>(frame) = frame_pool_;
+    frame_pool_ = frame;
+    ++frame_pool_size_;
 }
 
 Frame::~Frame() { zmq_msg_close(&message_); }
@@ -24,6 +24,10 @@ public:
 
     operator zmq_msg_t*() noexcept final { return &message_; }
 
+    // Frames are recycled through a per-thread free list
+    static void* operator new(std::size_t size);
+    static void operator delete(void* frame) noexcept;
+
     ~Frame() final;
 
 private:
@@ -38,7 +42,9 @@ private:
     explicit Frame(const ProtobufType& input) noexcept;
     explicit Frame(const std::size_t bytes) noexcept;
     Frame(const void* data, const std::size_t bytes) noexcept;
-    Frame(const Frame&) = delete;
+    Frame(void* data, const std::size_t bytes, Release&& release) noexcept;
+    // Shares the reference counted content of rhs
+    Frame(const Frame& rhs) noexcept;
     Frame(Frame&&) = delete;
     Frame& operator=(Frame&&) = delete;
     Frame& operator=(const Frame&) = delete;
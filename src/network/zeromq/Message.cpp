@@ -86,6 +86,16 @@ Frame& Message::AddFrame(const void* input, const std::size_t size)
     return messages_.back().get();
 }
 
+Frame& Message::AddFrame(
+    void* input,
+    const std::size_t size,
+    Frame::Release release)
+{
+    messages_.emplace_back(Factory::ZMQFrame(input, size, std::move(release)));
+
+    return messages_.back().get();
+}
+
 Frame& Message::AddFrame(const ProtobufType& input)
 {
     messages_.emplace_back(Factory::ZMQFrame(input));
@@ -93,6 +103,15 @@ Frame& Message::AddFrame(const ProtobufType& input)
     return messages_.back().get();
 }
 
+AllocateOutput Message::AppendBytes() noexcept
+{
+    return [this](const auto size) -> WritableView {
+        messages_.emplace_back(Factory::ZMQFrame(size));
+
+        return {zmq_msg_data(messages_.back().get()), size};
+    };
+}
+
 const Frame& Message::at(const std::size_t index) const
 {
     OT_ASSERT(messages_.size() > index);
@@ -7,6 +7,8 @@
 
 #include "Internal.hpp"
 
+#include <boost/container/small_vector.hpp>
+
 namespace opentxs::network::zeromq::implementation
 {
 class Message : virtual public zeromq::Message
@@ -28,6 +30,11 @@ public:
     Frame& AddFrame() final;
     Frame& AddFrame(const ProtobufType& input) final;
     Frame& AddFrame(const void* input, const std::size_t size) final;
+    Frame& AddFrame(
+        void* input,
+        const std::size_t size,
+        Frame::Release release) final;
+    AllocateOutput AppendBytes() noexcept final;
     Frame& at(const std::size_t index) final;
 
     void EnsureDelimiter() final;
@@ -36,7 +43,10 @@ public:
     ~Message() override = default;
 
 protected:
-    std::vector<OTZMQFrame> messages_{};
+    // Typical messages fit without a separate allocation for the frame list
+    using Frames = boost::container::small_vector<OTZMQFrame, 8>;
+
+    Frames messages_{};
 
     std::size_t body_position() const;
 
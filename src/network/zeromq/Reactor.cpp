@@ -0,0 +1,353 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include "network/zeromq/socket/Socket.hpp"
+
+#include <zmq.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "Reactor.hpp"
+
+#define OT_ZMQ_REACTOR_IDLE_SECONDS 30
+
+#define OT_METHOD "opentxs::network::zeromq::implementation::Reactor::"
+
+namespace opentxs::network::zeromq::implementation
+{
+Reactor::Reactor(
+    void* context,
+    const std::size_t coreWorkers,
+    const std::size_t maxWorkers) noexcept
+    : core_workers_(coreWorkers)
+    , max_workers_(std::max(maxWorkers, std::size_t{1}))
+    , endpoint_(socket::implementation::Socket::random_inproc_endpoint())
+    , wake_send_(zmq_socket(context, ZMQ_PUSH))
+    , wake_receive_(zmq_socket(context, ZMQ_PULL))
+    , wake_lock_()
+    , lock_()
+    , work_()
+    , done_()
+    , listeners_()
+    , queue_()
+    , generation_(0)
+    , polled_(0)
+    , workers_(0)
+    , idle_(0)
+    , threads_()
+    , finished_()
+    , running_(true)
+    , poller_()
+{
+    OT_ASSERT(nullptr != wake_send_);
+    OT_ASSERT(nullptr != wake_receive_);
+
+    const auto linger = int{0};
+    zmq_setsockopt(wake_send_, ZMQ_LINGER, &linger, sizeof(linger));
+    zmq_setsockopt(wake_receive_, ZMQ_LINGER, &linger, sizeof(linger));
+    const auto bound = zmq_bind(wake_receive_, endpoint_.c_str());
+
+    OT_ASSERT(0 == bound);
+
+    const auto connected = zmq_connect(wake_send_, endpoint_.c_str());
+
+    OT_ASSERT(0 == connected);
+
+    poller_ = std::thread(&Reactor::poll, this);
+}
+
+bool Reactor::Add(
+    Listener& listener,
+    const std::vector<void*>& sockets) noexcept
+{
+    auto registration = Registration{};
+
+    for (auto* socket : sockets) {
+        auto fd = Descriptor{};
+        auto size = sizeof(fd);
+
+        if (0 != zmq_getsockopt(socket, ZMQ_FD, &fd, &size)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to obtain socket descriptor: ")(
+                zmq_strerror(zmq_errno()))
+                .Flush();
+
+            return false;
+        }
+
+        registration.descriptors_.emplace_back(fd);
+    }
+
+    Lock lock(lock_);
+
+    if (false == running_) { return false; }
+
+    const auto [it, added] =
+        listeners_.emplace(&listener, std::move(registration));
+
+    if (false == added) { return false; }
+
+    // Messages may have arrived before the descriptor is polled
+    enqueue(lock, listener);
+
+    return true;
+}
+
+void Reactor::enqueue(const Lock& lock, Listener& listener) noexcept
+{
+    auto& registration = listeners_.at(&listener);
+
+    if (registration.running_) {
+        registration.again_ = true;
+
+        return;
+    }
+
+    if (registration.queued_) { return; }
+
+    registration.queued_ = true;
+    queue_.emplace_back(&listener);
+
+    if (0 < idle_) {
+        work_.notify_one();
+
+        return;
+    }
+
+    for (auto& thread : finished_) { thread.join(); }
+
+    finished_.clear();
+
+    // At the limit the listener stays queued until a worker is free
+    if (workers_ < max_workers_) {
+        ++workers_;
+        auto thread = std::thread(&Reactor::work, this);
+        const auto id = thread.get_id();
+        threads_.emplace(id, std::move(thread));
+    }
+}
+
+void Reactor::poll() noexcept
+{
+    auto items = std::vector<zmq_pollitem_t>{};
+    auto owners = std::vector<Listener*>{};
+
+    while (true) {
+        items.clear();
+        owners.clear();
+        auto& wake = items.emplace_back();
+        wake.socket = wake_receive_;
+        wake.events = ZMQ_POLLIN;
+
+        {
+            Lock lock(lock_);
+
+            if (false == running_) { break; }
+
+            for (auto& [listener, registration] : listeners_) {
+                if (registration.queued_ || registration.running_) {
+                    continue;
+                }
+
+                for (const auto& fd : registration.descriptors_) {
+                    auto& item = items.emplace_back();
+                    item.socket = nullptr;
+                    item.fd = fd;
+                    item.events = ZMQ_POLLIN;
+                    owners.emplace_back(listener);
+                }
+            }
+
+            polled_ = generation_;
+            done_.notify_all();
+        }
+
+        const auto events =
+            zmq_poll(items.data(), static_cast<int>(items.size()), -1);
+
+        if (-1 == events) {
+            const auto error = zmq_errno();
+
+            if (ETERM == error) { break; }
+            if (EINTR == error) { continue; }
+
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Poll error: ")(
+                zmq_strerror(error))
+                .Flush();
+
+            continue;
+        }
+
+        if (0 != (items.front().revents & ZMQ_POLLIN)) {
+            auto message = zmq_msg_t{};
+            zmq_msg_init(&message);
+
+            while (-1 != zmq_msg_recv(&message, wake_receive_, ZMQ_DONTWAIT)) {
+            }
+
+            zmq_msg_close(&message);
+        }
+
+        Lock lock(lock_);
+
+        for (std::size_t i{1}; i < items.size(); ++i) {
+            if (0 == (items.at(i).revents & ZMQ_POLLIN)) { continue; }
+
+            auto* listener = owners.at(i - 1);
+            auto it = listeners_.find(listener);
+
+            if ((listeners_.end() == it) || it->second.removed_) { continue; }
+
+            enqueue(lock, *listener);
+        }
+    }
+
+    Lock lock(lock_);
+    polled_ = std::numeric_limits<std::uint64_t>::max();
+    done_.notify_all();
+}
+
+void Reactor::Remove(Listener& listener) noexcept
+{
+    Lock lock(lock_);
+    auto it = listeners_.find(&listener);
+
+    if ((listeners_.end() == it) || it->second.removed_) { return; }
+
+    auto& registration = it->second;
+    registration.removed_ = true;
+    queue_.erase(
+        std::remove(queue_.begin(), queue_.end(), &listener), queue_.end());
+
+    if (registration.running_ &&
+        (std::this_thread::get_id() == registration.worker_)) {
+        // Removed from inside its own callback, so the worker cleans up
+        registration.detached_ = true;
+    } else {
+        done_.wait(lock, [&] { return false == registration.running_; });
+        listeners_.erase(it);
+    }
+
+    if (false == running_) { return; }
+
+    // The caller may close the socket once the poller has dropped it
+    const auto target = ++generation_;
+    lock.unlock();
+    wake();
+    lock.lock();
+    done_.wait(lock, [&] { return (target <= polled_) || !running_; });
+}
+
+void Reactor::Trigger(Listener& listener) noexcept
+{
+    Lock lock(lock_);
+    auto it = listeners_.find(&listener);
+
+    if ((listeners_.end() == it) || it->second.removed_) { return; }
+
+    enqueue(lock, listener);
+}
+
+void Reactor::wake() noexcept
+{
+    Lock lock(wake_lock_);
+    zmq_send(wake_send_, nullptr, 0, ZMQ_DONTWAIT);
+}
+
+void Reactor::work() noexcept
+{
+    Lock lock(lock_);
+
+    while (true) {
+        if (queue_.empty()) {
+            if (false == running_) { break; }
+
+            ++idle_;
+            const auto status = work_.wait_for(
+                lock, std::chrono::seconds(OT_ZMQ_REACTOR_IDLE_SECONDS));
+            --idle_;
+            const auto expired = (std::cv_status::timeout == status) &&
+                                 queue_.empty() &&
+                                 (core_workers_ < workers_);
+
+            if (expired) { break; }
+
+            continue;
+        }
+
+        auto* listener = queue_.front();
+        queue_.pop_front();
+        auto& registration = listeners_.at(listener);
+        registration.queued_ = false;
+        registration.running_ = true;
+        registration.again_ = false;
+        registration.worker_ = std::this_thread::get_id();
+        lock.unlock();
+        const auto again = listener->react();
+        lock.lock();
+        registration.running_ = false;
+
+        if (registration.removed_) {
+            if (registration.detached_) { listeners_.erase(listener); }
+
+            done_.notify_all();
+
+            continue;
+        }
+
+        if (again || registration.again_) {
+            enqueue(lock, *listener);
+        } else {
+            lock.unlock();
+            wake();
+            lock.lock();
+        }
+    }
+
+    // The thread is joined by the next enqueue or by the destructor
+    auto it = threads_.find(std::this_thread::get_id());
+
+    OT_ASSERT(threads_.end() != it);
+
+    finished_.emplace_back(std::move(it->second));
+    threads_.erase(it);
+    --workers_;
+    done_.notify_all();
+}
+
+Reactor::~Reactor()
+{
+    {
+        Lock lock(lock_);
+        running_ = false;
+        work_.notify_all();
+        done_.notify_all();
+    }
+
+    wake();
+
+    if (poller_.joinable()) { poller_.join(); }
+
+    Lock lock(lock_);
+    done_.wait(lock, [&] { return 0 == workers_; });
+    auto finished = std::move(finished_);
+    lock.unlock();
+
+    // Workers release the mutex after they decrement the count, so they must
+    // be joined before it is destroyed
+    for (auto& thread : finished) { thread.join(); }
+
+    zmq_disconnect(wake_send_, endpoint_.c_str());
+    zmq_unbind(wake_receive_, endpoint_.c_str());
+    zmq_close(wake_send_);
+    zmq_close(wake_receive_);
+}
+}  // namespace opentxs::network::zeromq::implementation
@@ -0,0 +1,106 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <zmq.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace opentxs::network::zeromq::implementation
+{
+/** Multiplexes the incoming side of every receiver socket
+ *
+ *  A single poller thread watches the notification descriptors of all
+ *  registered sockets and hands ready listeners to a worker pool. A listener
+ *  is never run by more than one worker at a time. The pool grows when every
+ *  worker is busy, so a callback which blocks can not starve the others, up
+ *  to the maximum worker count. Beyond that ready listeners wait for the next
+ *  free worker. Threads above the core count exit after being idle.
+ */
+class Reactor
+{
+public:
+    class Listener
+    {
+    public:
+        /** Processes pending messages
+         *
+         *  Must drain the sockets until ZMQ_EVENTS no longer reports
+         *  ZMQ_POLLIN, or return true to be run again.
+         */
+        virtual bool react() noexcept = 0;
+
+        virtual ~Listener() = default;
+    };
+
+    bool Add(Listener& listener, const std::vector<void*>& sockets) noexcept;
+    // Blocks until the listener is neither running nor being polled
+    void Remove(Listener& listener) noexcept;
+    // Runs the listener even if none of its descriptors became readable
+    void Trigger(Listener& listener) noexcept;
+
+    Reactor(
+        void* context,
+        const std::size_t coreWorkers,
+        const std::size_t maxWorkers) noexcept;
+    ~Reactor();
+
+private:
+    using Descriptor = decltype(zmq_pollitem_t::fd);
+
+    struct Registration {
+        std::vector<Descriptor> descriptors_{};
+        bool queued_{false};
+        bool running_{false};
+        bool again_{false};
+        bool removed_{false};
+        bool detached_{false};
+        std::thread::id worker_{};
+    };
+
+    const std::size_t core_workers_;
+    const std::size_t max_workers_;
+    const std::string endpoint_;
+    void* wake_send_;
+    void* wake_receive_;
+    std::mutex wake_lock_;
+    mutable std::mutex lock_;
+    std::condition_variable work_;
+    std::condition_variable done_;
+    std::map<Listener*, Registration> listeners_;
+    std::deque<Listener*> queue_;
+    std::uint64_t generation_;
+    std::uint64_t polled_;
+    std::size_t workers_;
+    std::size_t idle_;
+    std::map<std::thread::id, std::thread> threads_;
+    // Workers which exited and have not been joined yet
+    std::vector<std::thread> finished_;
+    bool running_;
+    std::thread poller_;
+
+    void enqueue(const Lock& lock, Listener& listener) noexcept;
+    void poll() noexcept;
+    void wake() noexcept;
+    void work() noexcept;
+
+    Reactor() = delete;
+    Reactor(const Reactor&) = delete;
+    Reactor(Reactor&&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+    Reactor& operator=(Reactor&&) = delete;
+};
+}  // namespace opentxs::network::zeromq::implementation
@@ -42,11 +42,12 @@ private:
         std::mutex& socket_mutex,
         const std::string& endpoint) const noexcept;
 
+    std::vector<void*> poll_sockets() const noexcept final;
+    bool process(const Lock& lock) noexcept final;
     bool process_pull_socket(const Lock& lock) noexcept;
     bool process_receiver_socket(const Lock& lock) noexcept;
     bool send(zeromq::Message& message) const noexcept final;
     bool send(const Lock& lock, zeromq::Message& message) noexcept;
-    void thread() noexcept final;
 
     Bidirectional() = delete;
     Bidirectional(const Bidirectional&) = delete;
@@ -26,9 +26,6 @@
 
 #include "Bidirectional.hpp"
 
-#define CALLBACK_WAIT_MILLISECONDS 50
-#define POLL_MILLISECONDS 100
-
 #define OT_METHOD_BIDIRECTIONAL                                                \
     "opentxs::network::zeromq::socket::implementation::Bidirectional::"
 
@@ -142,10 +139,40 @@ void Bidirectional<InterfaceType, MessageType>::init() noexcept
 
     Socket::init();
 
-    if (bidirectional_start_thread_) {
-        this->receiver_thread_ = std::thread(
-            &Bidirectional<InterfaceType, MessageType>::thread, this);
+    if (bidirectional_start_thread_ && this->have_callback()) {
+        this->reactor_.Add(*this, poll_sockets());
+    }
+}
+
+template <typename InterfaceType, typename MessageType>
+std::vector<void*> Bidirectional<InterfaceType, MessageType>::poll_sockets()
+    const noexcept
+{
+    return {this->socket_, pull_socket_};
+}
+
+template <typename InterfaceType, typename MessageType>
+bool Bidirectional<InterfaceType, MessageType>::process(
+    const Lock& lock) noexcept
+{
+    for (std::size_t i{0}; i < RECEIVER_BATCH_SIZE; ++i) {
+        if (false == this->running_.get()) { return false; }
+
+        const auto incoming = this->readable(this->socket_);
+        const auto outgoing = this->readable(pull_socket_);
+
+        if ((false == incoming) && (false == outgoing)) { return false; }
+
+        auto processed{true};
+
+        if (incoming) { processed = process_receiver_socket(lock); }
+
+        if (processed && outgoing) { processed = process_pull_socket(lock); }
+
+        if (false == processed) { return false; }
     }
+
+    return true;
 }
 
 template <typename InterfaceType, typename MessageType>
@@ -212,64 +239,4 @@ void Bidirectional<InterfaceType, MessageType>::shutdown(
     send.unlock();
     Receiver<InterfaceType, MessageType>::shutdown(lock);
 }
-
-template <typename InterfaceType, typename MessageType>
-void Bidirectional<InterfaceType, MessageType>::thread() noexcept
-{
-    LogVerbose(OT_METHOD_BIDIRECTIONAL)(__FUNCTION__)(": Starting listener")
-        .Flush();
-
-    while (this->running_.get()) {
-        if (this->have_callback()) { break; }
-
-        Sleep(std::chrono::milliseconds(CALLBACK_WAIT_MILLISECONDS));
-    }
-
-    LogVerbose(OT_METHOD_BIDIRECTIONAL)(__FUNCTION__)(": Callback ready")
-        .Flush();
-
-    while (this->running_.get()) {
-        std::this_thread::yield();
-        Lock lock(this->lock_, std::try_to_lock);
-        zmq_pollitem_t poll[2]{};
-        poll[0].socket = this->socket_;
-        poll[0].events = ZMQ_POLLIN;
-        poll[1].socket = pull_socket_;
-        poll[1].events = ZMQ_POLLIN;
-
-        if (false == lock.owns_lock()) { continue; }
-
-        this->run_tasks(lock);
-        const auto events = zmq_poll(poll, 2, POLL_MILLISECONDS);
-
-        if (0 == events) {
-            LogVerbose(OT_METHOD_BIDIRECTIONAL)(__FUNCTION__)(": No messages.")
-                .Flush();
-
-            continue;
-        }
-
-        if (-1 == events) {
-            const auto error = zmq_errno();
-            LogOutput(OT_METHOD_BIDIRECTIONAL)(__FUNCTION__)(": Poll error: ")(
-                zmq_strerror(error))(".")
-                .Flush();
-
-            continue;
-        }
-
-        bool processed = true;
-
-        if (ZMQ_POLLIN == poll[0].revents) {
-            processed = process_receiver_socket(lock);
-        }
-
-        if (processed && ZMQ_POLLIN == poll[1].revents) {
-            processed = process_pull_socket(lock);
-        }
-    }
-
-    LogVerbose(OT_METHOD_BIDIRECTIONAL)(__FUNCTION__)(": Shutting down")
-        .Flush();
-}
 }  // namespace opentxs::network::zeromq::socket::implementation
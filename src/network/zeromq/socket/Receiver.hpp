@@ -5,32 +5,39 @@
 
 #pragma once
 
-#define CALLBACK_WAIT_MILLISECONDS 50
-#define RECEIVER_POLL_MILLISECONDS 100
+#define RECEIVER_BATCH_SIZE 64
 
 #define RECEIVER_METHOD "opentxs::network::zeromq::implementation::Receiver::"
 
 namespace opentxs::network::zeromq::socket::implementation
 {
 template <typename InterfaceType, typename MessageType = zeromq::Message>
-class Receiver : virtual public InterfaceType, public Socket
+class Receiver : virtual public InterfaceType,
+                 public Socket,
+                 public zeromq::implementation::Reactor::Listener
 {
 public:
     bool apply_socket(SocketCallback&& cb) const noexcept override;
     bool Close() const noexcept final;
 
 protected:
-    mutable std::thread receiver_thread_{};
+    zeromq::implementation::Reactor& reactor_;
+
+    static bool readable(void* socket) noexcept;
 
     virtual bool have_callback() const noexcept { return false; }
-    void run_tasks(const Lock& lock) const noexcept;
 
     void init() noexcept override;
+    // Sockets whose incoming messages are dispatched by the reactor
+    virtual std::vector<void*> poll_sockets() const noexcept
+    {
+        return {socket_};
+    }
+    // Returns true if messages may remain after a full batch
+    virtual bool process(const Lock& lock) noexcept;
     virtual void process_incoming(
         const Lock& lock,
         MessageType& message) noexcept = 0;
-    void shutdown(const Lock& lock) noexcept override;
-    virtual void thread() noexcept;
 
     Receiver(
         const zeromq::Context& context,
@@ -42,14 +49,11 @@ protected:
 
 private:
     const bool start_thread_;
-    mutable int next_task_;
-    mutable std::mutex task_lock_;
-    mutable std::map<int, SocketCallback> socket_tasks_;
-    mutable std::map<int, bool> task_result_;
-
-    int add_task(SocketCallback&& cb) const noexcept;
-    bool task_result(const int id) const noexcept;
-    bool task_running(const int id) const noexcept;
+
+    static zeromq::implementation::Reactor& get_reactor(
+        const zeromq::Context& context) noexcept;
+
+    bool react() noexcept final;
 
     Receiver() = delete;
     Receiver(const Receiver&) = delete;
@@ -14,13 +14,16 @@
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/Types.hpp"
 
+#include "network/zeromq/Context.hpp"
+#include "network/zeromq/Reactor.hpp"
 #include "Socket.hpp"
 
 #include <zmq.h>
 
+#include <iostream>
 #include <memory>
 #include <mutex>
-#include <thread>
+#include <vector>
 
 #include "Receiver.hpp"
 
@@ -33,158 +36,118 @@ Receiver<InterfaceType, MessageType>::Receiver(
     const Socket::Direction direction,
     const bool startThread) noexcept
     : Socket(context, type, direction)
-    , receiver_thread_()
+    , reactor_(get_reactor(context))
     , start_thread_(startThread)
-    , next_task_(0)
-    , task_lock_()
-    , socket_tasks_()
-    , task_result_()
 {
 }
 
-template <typename InterfaceType, typename MessageType>
-int Receiver<InterfaceType, MessageType>::add_task(SocketCallback&& cb) const
-    noexcept
-{
-    Lock lock(task_lock_);
-    auto [it, success] = socket_tasks_.emplace(++next_task_, std::move(cb));
-
-    OT_ASSERT(success);
-
-    return it->first;
-}
-
 template <typename InterfaceType, typename MessageType>
 bool Receiver<InterfaceType, MessageType>::apply_socket(
     SocketCallback&& cb) const noexcept
 {
-    const auto id = add_task(std::move(cb));
-
-    while (task_running(id)) {
-        Sleep(std::chrono::milliseconds(RECEIVER_POLL_MILLISECONDS));
+    Lock lock(lock_);
+    const auto output = cb(lock);
+    auto pending{false};
+
+    // Any call on the socket may consume the notification for messages
+    // which arrived in the meantime
+    for (auto* socket : poll_sockets()) {
+        if (readable(socket)) {
+            pending = true;
+            break;
+        }
     }
 
-    return task_result(id);
+    lock.unlock();
+
+    if (pending) { reactor_.Trigger(const_cast<Receiver&>(*this)); }
+
+    return output;
 }
 
 template <typename InterfaceType, typename MessageType>
 bool Receiver<InterfaceType, MessageType>::Close() const noexcept
 {
     running_->Off();
-
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
+    reactor_.Remove(const_cast<Receiver&>(*this));
 
     return Socket::Close();
 }
 
 template <typename InterfaceType, typename MessageType>
-void Receiver<InterfaceType, MessageType>::init() noexcept
+zeromq::implementation::Reactor& Receiver<InterfaceType, MessageType>::
+    get_reactor(const zeromq::Context& context) noexcept
 {
-    Socket::init();
+    auto* internal =
+        dynamic_cast<const zeromq::implementation::Context*>(&context);
 
-    if (start_thread_) {
-        receiver_thread_ = std::thread(&Receiver::thread, this);
-    }
+    OT_ASSERT(nullptr != internal);
+
+    return internal->Receivers();
 }
 
 template <typename InterfaceType, typename MessageType>
-void Receiver<InterfaceType, MessageType>::run_tasks(const Lock& lock) const
-    noexcept
+void Receiver<InterfaceType, MessageType>::init() noexcept
 {
-    Lock task_lock(task_lock_);
-    auto i = socket_tasks_.begin();
+    Socket::init();
 
-    while (i != socket_tasks_.end()) {
-        const auto& [id, cb] = *i;
-        task_result_.emplace(id, cb(lock));
-        i = socket_tasks_.erase(i);
+    if (start_thread_ && have_callback()) {
+        reactor_.Add(*this, poll_sockets());
     }
 }
 
 template <typename InterfaceType, typename MessageType>
-void Receiver<InterfaceType, MessageType>::shutdown(const Lock& lock) noexcept
+bool Receiver<InterfaceType, MessageType>::process(const Lock& lock) noexcept
 {
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
+    for (std::size_t i{0}; i < RECEIVER_BATCH_SIZE; ++i) {
+        if (false == running_.get()) { return false; }
 
-    Socket::shutdown(lock);
-}
+        if (false == readable(socket_)) { return false; }
 
-template <typename InterfaceType, typename MessageType>
-bool Receiver<InterfaceType, MessageType>::task_result(const int id) const
-    noexcept
-{
-    Lock lock(task_lock_);
-    const auto it = task_result_.find(id);
+        auto reply = MessageType::Factory();
+        const auto received = Socket::receive_message(lock, socket_, reply);
 
-    OT_ASSERT(task_result_.end() != it);
+        if (false == received) {
+            std::cerr << RECEIVER_METHOD << __FUNCTION__
+                      << ": Failed to receive incoming message." << std::endl;
 
-    auto output = it->second;
-    task_result_.erase(it);
+            return false;
+        }
 
-    return output;
+        process_incoming(lock, reply);
+    }
+
+    return true;
 }
 
 template <typename InterfaceType, typename MessageType>
-bool Receiver<InterfaceType, MessageType>::task_running(const int id) const
-    noexcept
+bool Receiver<InterfaceType, MessageType>::react() noexcept
 {
-    Lock lock(task_lock_);
+    // Close removes the socket from the reactor before it takes the lock, so
+    // waiting here can not delay shutdown
+    Lock lock(lock_);
 
-    return (1 == socket_tasks_.count(id));
+    if (false == running_.get()) { return false; }
+
+    return process(lock);
 }
 
 template <typename InterfaceType, typename MessageType>
-void Receiver<InterfaceType, MessageType>::thread() noexcept
+bool Receiver<InterfaceType, MessageType>::readable(void* socket) noexcept
 {
-    while (running_.get()) {
-        if (have_callback()) { break; }
+    auto events = int{0};
+    auto size = sizeof(events);
 
-        Sleep(std::chrono::milliseconds(CALLBACK_WAIT_MILLISECONDS));
+    if (0 != zmq_getsockopt(socket, ZMQ_EVENTS, &events, &size)) {
+        return false;
     }
 
-    zmq_pollitem_t poll[1];
-    poll[0].socket = socket_;
-    poll[0].events = ZMQ_POLLIN;
-
-    while (running_.get()) {
-        Lock lock(lock_, std::try_to_lock);
-
-        if (false == lock.owns_lock()) { continue; }
-
-        run_tasks(lock);
-        const auto events = zmq_poll(poll, 1, RECEIVER_POLL_MILLISECONDS);
-
-        if (0 == events) { continue; }
-
-        if (-1 == events) {
-            const auto error = zmq_errno();
-            std::cerr << RECEIVER_METHOD << __FUNCTION__
-                      << ": Poll error: " << zmq_strerror(error) << std::endl;
-
-            continue;
-        }
-
-        if (false == running_.get()) { return; }
-
-        auto reply = MessageType::Factory();
-        const auto received = Socket::receive_message(lock, socket_, reply);
-
-        if (false == received) {
-            std::cerr << RECEIVER_METHOD << __FUNCTION__
-                      << ": Failed to receive incoming message." << std::endl;
-
-            continue;
-        }
-
-        process_incoming(lock, reply);
-        lock.unlock();
-        std::this_thread::yield();
-    }
+    return ZMQ_POLLIN == (events & ZMQ_POLLIN);
 }
 
 template <typename InterfaceType, typename MessageType>
 Receiver<InterfaceType, MessageType>::~Receiver()
 {
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
+    reactor_.Remove(*this);
 }
 }  // namespace opentxs::network::zeromq::socket::implementation
@@ -18,11 +18,10 @@
 
 #define CURVE_KEY_BYTES 32
 #define CURVE_KEY_Z85_BYTES 40
+// Receivers must leave the reactor before the socket lock is taken
 #define SHUTDOWN                                                               \
     {                                                                          \
-        running_->Off();                                                       \
-        Lock lock(lock_);                                                      \
-        shutdown(lock);                                                        \
+        Close();                                                               \
     }
 
 namespace opentxs::network::zeromq::socket::implementation
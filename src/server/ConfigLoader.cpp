@@ -9,6 +9,7 @@
 
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Settings.hpp"
+#include "opentxs/core/Armored.hpp"
 #include "opentxs/core/cron/OTCron.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
@@ -109,6 +110,24 @@ bool ConfigLoader::load(
         OTCron::SetCronMsBetweenProcess(std::chrono::milliseconds(lValue));
     }
 
+    {
+        const char* szComment = "; ms_per_slice is the maximum number of "
+                                "milliseconds Cron spends processing\n"
+                                "; items before letting client requests "
+                                "proceed.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            String::Factory("cron"),
+            String::Factory("ms_per_slice"),
+            100,
+            lValue,
+            bIsNewKey,
+            String::Factory(szComment));
+        OTCron::SetCronMsPerSlice(std::chrono::milliseconds(lValue));
+    }
+
     {
         const char* szComment = "; max_items_per_nym is the number of cron "
                                 "items (such as market offers or payment\n"
@@ -174,6 +193,25 @@ bool ConfigLoader::load(
             static_cast<std::int32_t>(lValue));
     }
 
+    {
+        const char* szComment = "; notary_threads is the number of threads "
+                                "which process client requests.\n"
+                                "; Requests which touch different nyms and "
+                                "accounts run concurrently.\n"
+                                "; Zero uses one thread per core.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            String::Factory("heartbeat"),
+            String::Factory("notary_threads"),
+            0,
+            lValue,
+            bIsNewKey,
+            String::Factory(szComment));
+        ServerSettings::SetNotaryThreads(static_cast<std::int32_t>(lValue));
+    }
+
     // PERMISSIONS
 
     {
@@ -236,6 +274,25 @@ bool ConfigLoader::load(
         ServerSettings::SetMinMarketScale(lValue);
     }
 
+    {
+        const char* szComment =
+            "; compression_level is the zlib level (0-9) used when armoring "
+            "messages and receipts.\n"
+            "; 0 stores the data uncompressed, which is cheapest and still "
+            "readable by every peer. -1 is the zlib default.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            String::Factory("armor"),
+            String::Factory("compression_level"),
+            Armored::CompressionLevel(),
+            lValue,
+            bIsNewKey,
+            String::Factory(szComment));
+        Armored::SetCompressionLevel(static_cast<std::int32_t>(lValue));
+    }
+
     // SECURITY (beginnings of..)
 
     // Master Key Timeout
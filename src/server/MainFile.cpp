@@ -306,6 +306,12 @@ bool MainFile::LoadMainFile(bool bReadOnly)
                             xml->getAttributeValue("transactionNum"));
                         server_.GetTransactor().transactionNumber(
                             strTransactionNumber->ToLong());
+
+                        if (false ==
+                            server_.GetTransactor().loadReservedNumbers()) {
+                            bFailure = true;
+                        }
+
                         LogNormal("Loading Open Transactions server").Flush();
                         LogNormal("* File version: ")(version_).Flush();
                         LogNormal("* Last Issued Transaction Number: ")(
@@ -14,13 +14,14 @@
 #include "opentxs/api/Wallet.hpp"
 #include "opentxs/core/Armored.hpp"
 #include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Item.hpp"
+#include "opentxs/core/Ledger.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Message.hpp"
+#include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/identity/Nym.hpp"
-#include "opentxs/network/zeromq/socket/Dealer.hpp"
 #include "opentxs/network/zeromq/socket/Pull.hpp"
-#include "opentxs/network/zeromq/socket/Reply.hpp"
 #include "opentxs/network/zeromq/socket/Router.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/FrameIterator.hpp"
@@ -28,13 +29,13 @@
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/ListenCallback.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
-#include "opentxs/network/zeromq/ReplyCallback.hpp"
 #include "opentxs/otx/Reply.hpp"
 #include "opentxs/otx/Request.hpp"
 #include "opentxs/Proto.tpp"
 
 #include "internal/api/Api.hpp"
 #include "Server.hpp"
+#include "ServerSettings.hpp"
 #include "UserCommandProcessor.hpp"
 
 #include <cstddef>
@@ -64,20 +65,6 @@ MessageProcessor::MessageProcessor(
     , frontend_socket_(server.API().ZeroMQ().RouterSocket(
           frontend_callback_,
           zmq::socket::Socket::Direction::Bind))
-    , backend_callback_(zmq::ReplyCallback::Factory(
-          [=](const zmq::Message& incoming) -> OTZMQMessage {
-              return this->process_backend(incoming);
-          }))
-    , backend_socket_(server.API().ZeroMQ().ReplySocket(
-          backend_callback_,
-          zmq::socket::Socket::Direction::Bind))
-    , internal_callback_(zmq::ListenCallback::Factory(
-          [=](const zmq::Message& incoming) -> void {
-              this->process_internal(incoming);
-          }))
-    , internal_socket_(server.API().ZeroMQ().DealerSocket(
-          internal_callback_,
-          zmq::socket::Socket::Direction::Connect))
     , notification_callback_(zmq::ListenCallback::Factory(
           [=](const zmq::Message& incoming) -> void {
               this->process_notification(incoming);
@@ -86,17 +73,15 @@ MessageProcessor::MessageProcessor(
           notification_callback_,
           zmq::socket::Socket::Direction::Bind))
     , thread_()
-    , internal_endpoint_(
-          std::string("inproc://opentxs/notary/") + Identifier::Random()->str())
+    , cron_lock_()
+    , scheduler_()
     , counter_lock_()
     , drop_incoming_(0)
     , drop_outgoing_(0)
     , active_connections_()
     , connection_map_lock_()
 {
-    auto bound = backend_socket_->Start(internal_endpoint_);
-    bound &= internal_socket_->Start(internal_endpoint_);
-    bound &= notification_socket_->Start(
+    const auto bound = notification_socket_->Start(
         server_.API().Endpoints().InternalPushNotification());
 
     OT_ASSERT(bound);
@@ -121,10 +106,11 @@ void MessageProcessor::associate_connection(
 
 void MessageProcessor::cleanup()
 {
+    // Stopping the scheduler drains every queued job, and those jobs still
+    // need the frontend socket to deliver their replies
+    scheduler_.Stop();
     frontend_socket_->Close();
     notification_socket_->Close();
-    internal_socket_->Close();
-    backend_socket_->Close();
 
     if (thread_.joinable()) { thread_.join(); }
 }
@@ -196,6 +182,36 @@ void MessageProcessor::init(
     LogNormal("Bound to endpoint: ")(endpoint.str()).Flush();
 }
 
+std::shared_ptr<const Message> MessageProcessor::parse_message(
+    const std::string& messageString) const
+{
+    if (messageString.size() < 1) { return {}; }
+
+    auto armored = Armored::Factory();
+    armored->MemSet(messageString.data(), messageString.size());
+    auto serialized = String::Factory();
+    armored->GetString(serialized);
+    std::shared_ptr<Message> request{server_.API().Factory().Message()};
+
+    OT_ASSERT(request);
+
+    if (false == serialized->Exists()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Empty serialized request.")
+            .Flush();
+
+        return {};
+    }
+
+    if (false == request->LoadContractFromString(serialized)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to deserialized request.")
+            .Flush();
+
+        return {};
+    }
+
+    return request;
+}
+
 void MessageProcessor::run()
 {
     while (running_) {
@@ -203,8 +219,8 @@ void MessageProcessor::run()
         const auto timeout = server_.ComputeTimeout();
 
         if (timeout.count() <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            Lock lock(lock_);
+            // ProcessCron and requests must not run simultaneously
+            eLock lock(cron_lock_);
             server_.ProcessCron();
         }
 
@@ -212,27 +228,6 @@ void MessageProcessor::run()
     }
 }
 
-OTZMQMessage MessageProcessor::process_backend(const zmq::Message& incoming)
-{
-    // ProcessCron and process_backend must not run simultaneously
-    Lock lock(lock_);
-    std::string reply{};
-
-    std::string messageString{};
-    if (0 < incoming.Body().size()) {
-        messageString = *incoming.Body().begin();
-    }
-
-    bool error = process_message(messageString, reply);
-
-    if (error) { reply = ""; }
-
-    auto output = server_.API().ZeroMQ().ReplyMessage(incoming);
-    output->AddFrame(reply);
-
-    return output;
-}
-
 bool MessageProcessor::process_command(
     const proto::ServerRequest& serialized,
     identifier::Nym& nymID)
@@ -284,82 +279,64 @@ void MessageProcessor::process_frontend(const zmq::Message& incoming)
     }
 }
 
-void MessageProcessor::process_internal(const zmq::Message& incoming)
-{
-    Lock lock(counter_lock_);
-
-    if (0 < drop_outgoing_) {
-        LogNormal(OT_METHOD)(__FUNCTION__)(
-            ": Dropping outgoing message for testing.")
-            .Flush();
-        --drop_outgoing_;
-    } else {
-        lock.unlock();
-        OTZMQMessage reply{incoming};
-        const auto sent = frontend_socket_->Send(reply);
-
-        if (sent) {
-            LogTrace(OT_METHOD)(__FUNCTION__)(": Reply message delivered.")
-                .Flush();
-        } else {
-            LogOutput(OT_METHOD)(__FUNCTION__)(
-                ": Failed to send reply message.")
-                .Flush();
-        }
-    }
-}
-
 void MessageProcessor::process_legacy(
     const Data& id,
     const network::zeromq::Message& incoming)
 {
     LogTrace(OT_METHOD)(__FUNCTION__)(": Processing request via ")(id.asHex())
         .Flush();
-    OTZMQMessage request{incoming};
-    internal_socket_->Send(request);
+    std::string messageString{};
+
+    if (0 < incoming.Body().size()) {
+        messageString = *incoming.Body().begin();
+    }
+
+    // Deserializing the request and finding its write set happen on a
+    // scheduler thread so the receiver thread only copies the frame
+    scheduler_.Submit([this,
+                       messageString,
+                       reply = OTZMQMessage{
+                           server_.API().ZeroMQ().ReplyMessage(incoming)}](
+                          Scheduler::Keys& keys,
+                          Scheduler::Job& job) mutable -> bool {
+        const auto request = parse_message(messageString);
+        const auto concurrent = bool(request) && write_set(*request, keys);
+        job = [this, request, reply = std::move(reply)]() mutable {
+            sLock lock(cron_lock_);
+            std::string output{};
+            const auto error =
+                (false == bool(request)) || process_message(*request, output);
+
+            if (error) { output = ""; }
+
+            lock.unlock();
+            reply->AddFrame(output);
+            send_reply(reply.get());
+        };
+
+        return concurrent;
+    });
 }
 
 bool MessageProcessor::process_message(
-    const std::string& messageString,
+    const Message& request,
     std::string& reply)
 {
-    if (messageString.size() < 1) { return true; }
-
-    auto armored = Armored::Factory();
-    armored->MemSet(messageString.data(), messageString.size());
-    auto serialized = String::Factory();
-    armored->GetString(serialized);
-    auto request{server_.API().Factory().Message()};
-
-    if (false == serialized->Exists()) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Empty serialized request.")
-            .Flush();
-
-        return true;
-    }
-
-    if (false == request->LoadContractFromString(serialized)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to deserialized request.")
-            .Flush();
-
-        return true;
-    }
-
     auto replymsg{server_.API().Factory().Message()};
 
     OT_ASSERT(false != bool(replymsg));
 
     const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+        server_.CommandProcessor().ProcessUserCommand(request, *replymsg);
 
     if (false == processed) {
         LogDetail(OT_METHOD)(__FUNCTION__)(": Failed to process user command ")(
-            request->m_strCommand)
+            request.m_strCommand)
             .Flush();
-        LogVerbose(OT_METHOD)(__FUNCTION__)(String::Factory(*request)).Flush();
+        LogVerbose(OT_METHOD)(__FUNCTION__)(String::Factory(request)).Flush();
     } else {
         LogDetail(OT_METHOD)(__FUNCTION__)(
-            ": Successfully processed user command ")(request->m_strCommand)
+            ": Successfully processed user command ")(request.m_strCommand)
             .Flush();
     }
 
@@ -480,10 +457,140 @@ OTData MessageProcessor::query_connection(const identifier::Nym& nymID)
     return it->second;
 }
 
+void MessageProcessor::send_reply(zmq::Message& reply)
+{
+    Lock lock(counter_lock_);
+
+    if (0 < drop_outgoing_) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Dropping outgoing message for testing.")
+            .Flush();
+        --drop_outgoing_;
+    } else {
+        lock.unlock();
+        const auto sent = frontend_socket_->Send(reply);
+
+        if (sent) {
+            LogTrace(OT_METHOD)(__FUNCTION__)(": Reply message delivered.")
+                .Flush();
+        } else {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to send reply message.")
+                .Flush();
+        }
+    }
+}
+
 void MessageProcessor::Start()
 {
+    const auto configured = ServerSettings::GetNotaryThreads();
+    const auto threads = (0 < configured)
+                             ? static_cast<std::size_t>(configured)
+                             : std::size_t{std::thread::hardware_concurrency()};
+    scheduler_.Start(threads);
     thread_ = std::thread(&MessageProcessor::run, this);
 }
 
+// Works out which objects a request may write so requests for unrelated
+// nyms and accounts can be processed concurrently. Returns false for
+// requests whose effects are not known up front, which are processed
+// exclusively.
+bool MessageProcessor::write_set(
+    const Message& request,
+    Scheduler::Keys& keys) const
+{
+    const auto nym = [&](const String& id) {
+        if (id.Exists()) { keys.emplace(std::string("nym:") + id.Get()); }
+    };
+    const auto account = [&](const String& id) {
+        if (id.Exists()) { keys.emplace(std::string("account:") + id.Get()); }
+    };
+
+    // Every request may update the context and nymbox of its sender
+    nym(request.m_strNymID);
+
+    switch (Message::Type(request.m_strCommand->Get())) {
+        case MessageType::pingNotary:
+        case MessageType::registerNym:
+        case MessageType::getRequestNumber:
+        case MessageType::getTransactionNumbers:
+        case MessageType::checkNym:
+        case MessageType::getNymbox:
+        case MessageType::processNymbox:
+        case MessageType::queryInstrumentDefinitions:
+        case MessageType::getInstrumentDefinition:
+        case MessageType::getMint:
+        case MessageType::getMarketList:
+        case MessageType::getMarketOffers:
+        case MessageType::getMarketRecentTrades:
+        case MessageType::getNymMarketOffers:
+        case MessageType::registerContract: {
+
+            return true;
+        }
+        case MessageType::sendNymMessage:
+        case MessageType::usageCredits: {
+            nym(request.m_strNymID2);
+
+            return true;
+        }
+        case MessageType::registerAccount:
+        case MessageType::unregisterAccount:
+        case MessageType::getBoxReceipt:
+        case MessageType::getAccountData: {
+            account(request.m_strAcctID);
+
+            return true;
+        }
+        case MessageType::notarizeTransaction: {
+            account(request.m_strAcctID);
+        } break;
+        default: {
+
+            return false;
+        }
+    }
+
+    // Only transfers are scheduled concurrently. Every other transaction
+    // type may write accounts which can not be identified without loading
+    // the instruments it refers to.
+    const auto& api = server_.API();
+    auto ledger{api.Factory().Ledger(
+        api.Factory().NymID(request.m_strNymID),
+        Identifier::Factory(request.m_strAcctID),
+        api.Factory().ServerID(request.m_strNotaryID))};
+
+    OT_ASSERT(ledger);
+
+    if (false ==
+        ledger->LoadLedgerFromString(String::Factory(request.m_ascPayload))) {
+
+        return false;
+    }
+
+    for (const auto& [number, transaction] : ledger->GetTransactionMap()) {
+        if (false == bool(transaction)) { return false; }
+
+        for (const auto& item : transaction->GetItemList()) {
+            if (false == bool(item)) { return false; }
+
+            switch (item->GetType()) {
+                case itemType::transfer: {
+                    account(String::Factory(item->GetDestinationAcctID()));
+                } break;
+                case itemType::balanceStatement:
+                case itemType::transactionStatement: {
+                } break;
+                default: {
+
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 MessageProcessor::~MessageProcessor() { cleanup(); }
 }  // namespace opentxs::server
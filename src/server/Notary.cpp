@@ -334,7 +334,8 @@ void Notary::deposit_cheque(
                 return;
             }
 
-            if (false == senderInbox->VerifyAccount(server_.GetServerNym())) {
+            if (false ==
+                senderInbox->VerifyAbbreviated(server_.GetServerNym())) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
                     ": Failed to verify sender inbox.")
                     .Flush();
@@ -364,7 +365,8 @@ void Notary::deposit_cheque(
                 return;
             }
 
-            if (false == senderOutbox->VerifyAccount(server_.GetServerNym())) {
+            if (false ==
+                senderOutbox->VerifyAbbreviated(server_.GetServerNym())) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
                     ": Failed to verify sender outbox.")
                     .Flush();
@@ -891,7 +893,8 @@ void Notary::NotarizeTransfer(
 
                 if (bSuccessLoadingInbox) {
                     bSuccessLoadingInbox &=
-                        recipientOutbox->VerifyAccount(server_.GetServerNym());
+                        recipientOutbox->VerifyAbbreviated(
+                            server_.GetServerNym());
                 }
             }
 
@@ -922,7 +925,8 @@ void Notary::NotarizeTransfer(
 
             if (true == bSuccessLoadingInbox) {
                 bSuccessLoadingInbox =
-                    recipientInbox->VerifyAccount(server_.GetServerNym());
+                    recipientInbox->VerifyAbbreviated(
+                        server_.GetServerNym());
             } else {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
                     ": Error loading 'to' inbox.")
@@ -8207,13 +8211,15 @@ void Notary::process_cash_deposit(
                 } else {
                     responseBalanceItem.SetStatus(Item::acknowledgement);
                     bool bSuccess{false};
+                    std::map<std::uint64_t, std::vector<std::string>> spent{};
                     auto pToken = purse.Pop();
 
                     while (pToken) {
                         bSuccess = process_token_deposit(
                             pMintCashReserveAcct,
                             depositorAccount.get(),
-                            *pToken);
+                            *pToken,
+                            spent);
 
                         if (bSuccess) {
                             pToken = purse.Pop();
@@ -8222,6 +8228,24 @@ void Notary::process_cash_deposit(
                         }
                     }
 
+                    // Every token in the purse is recorded as spent in one
+                    // step so a failure part way through the purse can not
+                    // leave some of them spent while the deposit is aborted
+                    if (bSuccess) {
+                        try {
+                            bSuccess = manager_.Storage().MarkTokenSpent(
+                                NOTARY_ID, INSTRUMENT_DEFINITION_ID, spent);
+                        } catch (...) {
+                            bSuccess = false;
+                        }
+
+                        if (false == bSuccess) {
+                            LogOutput(OT_METHOD)(__FUNCTION__)(
+                                ": Failed recording tokens as spent")
+                                .Flush();
+                        }
+                    }
+
                     if (bSuccess) {
                         depositorAccount.get().GetIdentifier(accountHash);
                         depositorAccount.Release();
@@ -8548,7 +8572,8 @@ void Notary::send_push_notification(
 bool Notary::process_token_deposit(
     ExclusiveAccount& reserveAccount,
     Account& depositAccount,
-    blind::Token& token)
+    blind::Token& token,
+    std::map<std::uint64_t, std::vector<std::string>>& spent)
 {
     const auto amount = token.Value();
     auto pMint = manager_.GetPrivateMint(token.Unit(), token.Series());
@@ -8574,6 +8599,15 @@ bool Notary::process_token_deposit(
 
     if (false == verify_token(mint, token)) { return false; }
 
+    const auto id = token.ID(reason_);
+
+    if (id.empty()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to calculate token ID")
+            .Flush();
+
+        return false;
+    }
+
     if (false == reserveAccount.get().Debit(amount)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(
             ": Error debiting the mint cash reserve account.")
@@ -8598,31 +8632,9 @@ bool Notary::process_token_deposit(
         return false;
     }
 
-    // Spent token database. This is where the call is made to add the token to
-    // the spent token database.
-    const auto spent = token.MarkSpent(reason_);
-
-    if (false == spent) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(
-            ": Failed recording token as spent...")
-            .Flush();
-
-        if (false == reserveAccount.get().Credit(amount)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(
-                ": Failure crediting-back mint's cash reserve account while "
-                "depositing cash.")
-                .Flush();
-        }
-
-        if (false == depositAccount.Debit(amount)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(
-                ": Failure debiting-back user's asset account while depositing "
-                "cash.")
-                .Flush();
-        }
-
-        return false;
-    }
+    // The caller adds the token to the spent token database once every
+    // token in the purse has been processed
+    spent[token.Series()].emplace_back(id);
 
     LogDetail(OT_METHOD)(__FUNCTION__)(
         ": Success crediting account with cash token.")
@@ -228,7 +228,8 @@ private:
     bool process_token_deposit(
         ExclusiveAccount& reserveAccount,
         Account& depositAccount,
-        blind::Token& token);
+        blind::Token& token,
+        std::map<std::uint64_t, std::vector<std::string>>& spent);
     bool process_token_withdrawal(
         const identifier::UnitDefinition& unit,
         ClientContext& context,
@@ -0,0 +1,255 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "Scheduler.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <algorithm>
+
+#define OT_METHOD "opentxs::server::Scheduler::"
+
+namespace opentxs::server
+{
+Scheduler::Scheduler()
+    : lock_()
+    , ready_cv_()
+    , tasks_()
+    , last_()
+    , ready_()
+    , preparing_()
+    , sequence_()
+    , workers_()
+    , next_(0)
+    , next_sequence_(0)
+    , last_exclusive_(0)
+    , stop_(false)
+{
+}
+
+bool Scheduler::done(const Lock& lock) const
+{
+    OT_ASSERT(lock.owns_lock());
+
+    return stop_ && tasks_.empty() && sequence_.empty();
+}
+
+void Scheduler::finish(const Lock& lock, const JobID id)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    auto it = tasks_.find(id);
+
+    OT_ASSERT(tasks_.end() != it);
+
+    const auto& task = it->second;
+
+    for (const auto& dependent : task.dependents_) {
+        auto& next = tasks_.at(dependent);
+
+        OT_ASSERT(0 < next.waiting_);
+
+        if (0 == --next.waiting_) { ready_.emplace_back(dependent); }
+    }
+
+    for (const auto& key : task.keys_) {
+        auto last = last_.find(key);
+
+        if ((last_.end() != last) && (id == last->second)) {
+            last_.erase(last);
+        }
+    }
+
+    if (id == last_exclusive_) { last_exclusive_ = 0; }
+
+    tasks_.erase(it);
+}
+
+void Scheduler::Start(const std::size_t threads)
+{
+    Lock lock(lock_);
+
+    if (false == workers_.empty()) { return; }
+
+    stop_ = false;
+
+    for (std::size_t i{0}; i < std::max(std::size_t{1}, threads); ++i) {
+        workers_.emplace_back(&Scheduler::worker, this);
+    }
+
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Started ")(workers_.size())(
+        " worker threads")
+        .Flush();
+}
+
+void Scheduler::Stop()
+{
+    auto workers = std::vector<std::thread>{};
+
+    {
+        Lock lock(lock_);
+        stop_ = true;
+        workers.swap(workers_);
+    }
+
+    ready_cv_.notify_all();
+
+    for (auto& thread : workers) {
+        if (thread.joinable()) { thread.join(); }
+    }
+}
+
+void Scheduler::prepare(Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+    OT_ASSERT(false == preparing_.empty());
+
+    auto [sequence, function] = std::move(preparing_.front());
+    preparing_.pop_front();
+    lock.unlock();
+    auto prepared = Prepared{{}, true, {}};
+
+    try {
+        prepared.exclusive_ =
+            (false == function(prepared.keys_, prepared.job_));
+    } catch (...) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to prepare job").Flush();
+        prepared = Prepared{{}, true, {}};
+    }
+
+    lock.lock();
+    sequence_.at(sequence).emplace(std::move(prepared));
+    schedule(lock);
+}
+
+bool Scheduler::schedule(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    auto output{false};
+
+    // Submissions are scheduled strictly in the order they arrived, so a
+    // job which is still being prepared holds back every later one
+    while (false == sequence_.empty()) {
+        auto it = sequence_.begin();
+
+        if (false == it->second.has_value()) { break; }
+
+        output |= schedule(lock, std::move(it->second.value()));
+        sequence_.erase(it);
+    }
+
+    return output;
+}
+
+bool Scheduler::schedule(const Lock& lock, Prepared&& prepared)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    if (false == bool(prepared.job_)) { return false; }
+
+    const auto& keys = prepared.keys_;
+    const auto exclusive = prepared.exclusive_;
+    const auto id = ++next_;
+    auto dependencies = std::set<JobID>{};
+
+    if (exclusive) {
+        for (const auto& [earlier, task] : tasks_) {
+            dependencies.emplace(earlier);
+        }
+
+        last_exclusive_ = id;
+    } else {
+        if (0 != last_exclusive_) { dependencies.emplace(last_exclusive_); }
+
+        for (const auto& key : keys) {
+            auto& last = last_[key];
+
+            if (0 != last) { dependencies.emplace(last); }
+
+            last = id;
+        }
+    }
+
+    for (const auto& dependency : dependencies) {
+        tasks_.at(dependency).dependents_.emplace_back(id);
+    }
+
+    tasks_.emplace(
+        id, Task{keys, std::move(prepared.job_), dependencies.size(), {}});
+
+    if (dependencies.empty()) {
+        ready_.emplace_back(id);
+
+        return true;
+    }
+
+    return false;
+}
+
+void Scheduler::Submit(const Keys& keys, const bool exclusive, Job job)
+{
+    Lock lock(lock_);
+    sequence_.emplace(
+        ++next_sequence_, Prepared{keys, exclusive, std::move(job)});
+    const auto ready = schedule(lock);
+    lock.unlock();
+
+    if (ready) { ready_cv_.notify_all(); }
+}
+
+void Scheduler::Submit(Prepare prepare)
+{
+    Lock lock(lock_);
+    const auto sequence = ++next_sequence_;
+    sequence_.emplace(sequence, std::nullopt);
+    preparing_.emplace_back(sequence, std::move(prepare));
+    lock.unlock();
+    ready_cv_.notify_one();
+}
+
+void Scheduler::worker()
+{
+    Lock lock(lock_);
+
+    while (true) {
+        ready_cv_.wait(lock, [&] {
+            return (false == preparing_.empty()) ||
+                   (false == ready_.empty()) || done(lock);
+        });
+
+        if (false == preparing_.empty()) {
+            prepare(lock);
+            // A prepared job may complete the sequence for several others
+            ready_cv_.notify_all();
+
+            continue;
+        }
+
+        if (ready_.empty()) { return; }
+
+        const auto id = ready_.front();
+        ready_.pop_front();
+        auto job = std::move(tasks_.at(id).job_);
+        lock.unlock();
+
+        try {
+            job();
+        } catch (...) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Job failed").Flush();
+        }
+
+        lock.lock();
+        finish(lock, id);
+        // Finishing a job may release several others, and the last one
+        // allows stopped workers to exit
+        ready_cv_.notify_all();
+    }
+}
+
+Scheduler::~Scheduler() { Stop(); }
+}  // namespace opentxs::server
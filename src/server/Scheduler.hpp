@@ -0,0 +1,97 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace opentxs::server
+{
+/** Runs jobs on a pool of worker threads.
+ *
+ *  Each job names the objects it writes. Jobs which share an object run one
+ *  at a time in the order they were submitted, and jobs with disjoint write
+ *  sets run concurrently. An exclusive job waits for every job submitted
+ *  before it, and every job submitted after it waits for it.
+ *
+ *  A job may also be submitted together with the work needed to find its
+ *  write set. That work runs on a worker thread, and the job is scheduled
+ *  in the position it was submitted once every earlier submission is known.
+ */
+class Scheduler
+{
+public:
+    using Job = std::function<void()>;
+    using Keys = std::set<std::string>;
+    /// Sets the write set and job for a submission. Returns false if the job
+    /// must run exclusively.
+    using Prepare = std::function<bool(Keys& keys, Job& job)>;
+
+    void Start(const std::size_t threads);
+    /// Runs every job which has already been submitted, then joins the
+    /// worker threads
+    void Stop();
+    void Submit(const Keys& keys, const bool exclusive, Job job);
+    void Submit(Prepare prepare);
+
+    Scheduler();
+
+    ~Scheduler();
+
+private:
+    using JobID = std::uint64_t;
+
+    struct Prepared {
+        Keys keys_;
+        bool exclusive_;
+        Job job_;
+    };
+
+    struct Task {
+        Keys keys_;
+        Job job_;
+        std::size_t waiting_;
+        std::vector<JobID> dependents_;
+    };
+
+    mutable std::mutex lock_;
+    std::condition_variable ready_cv_;
+    std::map<JobID, Task> tasks_;
+    std::map<std::string, JobID> last_;
+    std::deque<JobID> ready_;
+    std::deque<std::pair<JobID, Prepare>> preparing_;
+    std::map<JobID, std::optional<Prepared>> sequence_;
+    std::vector<std::thread> workers_;
+    JobID next_;
+    JobID next_sequence_;
+    JobID last_exclusive_;
+    bool stop_;
+
+    bool done(const Lock& lock) const;
+    void finish(const Lock& lock, const JobID id);
+    void prepare(Lock& lock);
+    bool schedule(const Lock& lock);
+    bool schedule(const Lock& lock, Prepared&& prepared);
+    void worker();
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler(Scheduler&&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+    Scheduler& operator=(Scheduler&&) = delete;
+};
+}  // namespace opentxs::server
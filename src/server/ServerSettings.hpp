@@ -43,6 +43,13 @@ struct ServerSettings {
         __heartbeat_ms_between_beats = value;
     }
 
+    static std::int32_t GetNotaryThreads() { return __notary_threads; }
+
+    static void SetNotaryThreads(std::int32_t value)
+    {
+        __notary_threads = value;
+    }
+
     static const std::string& GetOverrideNymID() { return __override_nym_id; }
 
     static void SetOverrideNymID(const std::string& id)
@@ -55,6 +62,10 @@ struct ServerSettings {
     static std::int32_t __heartbeat_no_requests;
     static std::int32_t __heartbeat_ms_between_beats;
 
+    // Number of threads which process client requests. Zero uses one thread
+    // per core.
+    static std::int32_t __notary_threads;
+
     // The Nym who's allowed to do certain commands even if they are turned off.
     static std::string __override_nym_id;
     // Are usage credits REQUIRED in order to use this server?
@@ -13,6 +13,7 @@
 #include "opentxs/core/AccountList.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
+#include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/identity/Nym.hpp"
 
@@ -27,6 +28,9 @@
 #include <string>
 #include <utility>
 
+// Transaction numbers are reserved on disk this many at a time
+#define OT_TRANSACTION_NUMBER_BLOCK 1000
+
 #define OT_METHOD "opentxs::Transactor::"
 
 namespace opentxs::server
@@ -35,7 +39,9 @@ namespace opentxs::server
 Transactor::Transactor(Server& server, const PasswordPrompt& reason)
     : server_(server)
     , reason_(reason)
+    , number_lock_()
     , transactionNumber_(0)
+    , reserved_(0)
     , idToBasketMap_()
     , contractIdToBasketAccountId_()
     , voucherAccounts_(server.API())
@@ -50,26 +56,32 @@ Transactor::Transactor(Server& server, const PasswordPrompt& reason)
 ///
 /// Users must ask the server to send them transaction numbers so that they
 /// can be used in transaction requests.
+///
+/// Numbers are reserved in blocks by a small record saved next to the main
+/// file, so most numbers are issued from memory. After a restart the notary
+/// resumes past the end of the last reserved block, which means a crash can
+/// skip numbers but never issue one twice.
 bool Transactor::issueNextTransactionNumber(
     TransactionNumber& lTransactionNumber)
 {
+    Lock lock(number_lock_);
+
     // transactionNumber_ stores the last VALID AND ISSUED transaction number.
-    // So first, we increment that, since we don't want to issue the same number
-    // twice.
-    transactionNumber_++;
+    // So first, we make sure the next one has been reserved, since we don't
+    // want to issue the same number twice.
+    if (transactionNumber_ >= reserved_) {
+        if (false ==
+            reserve(lock, transactionNumber_ + OT_TRANSACTION_NUMBER_BLOCK)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Error reserving transaction numbers.")
+                .Flush();
 
-    // Next, we save it to file.
-    if (!server_.GetMainFile().SaveMainFile()) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Error saving main server file.")
-            .Flush();
-        transactionNumber_--;
-        return false;
+            return false;
+        }
     }
 
-    // SUCCESS?
-    // Now the server main file has saved the latest transaction number,
-    // NOW we set it onto the parameter and return true.
-    lTransactionNumber = transactionNumber_;
+    lTransactionNumber = ++transactionNumber_;
+
     return true;
 }
 
@@ -77,7 +89,9 @@ bool Transactor::issueNextTransactionNumberToNym(
     ClientContext& context,
     TransactionNumber& lTransactionNumber)
 {
-    if (!issueNextTransactionNumber(lTransactionNumber)) { return false; }
+    TransactionNumber number{0};
+
+    if (!issueNextTransactionNumber(number)) { return false; }
 
     // Each Nym stores the transaction numbers that have been issued to it.
     // (On client AND server side.)
@@ -86,26 +100,87 @@ bool Transactor::issueNextTransactionNumberToNym(
     // it is recorded in his Nym file before being sent to the client (where it
     // is also recorded in his Nym file.)  That way the server always knows
     // which numbers are valid for each Nym.
-    if (!context.IssueNumber(transactionNumber_)) {
+    if (!context.IssueNumber(number)) {
+        // The number is not handed back since another one may have been
+        // issued in the meantime. Skipping it is harmless.
         LogOutput(OT_METHOD)(__FUNCTION__)(
             ": Error adding transaction number to Nym file.")
             .Flush();
-        transactionNumber_--;
-        // Save it back how it was, since we're not issuing this number after
-        // all.
-        server_.GetMainFile().SaveMainFile();
 
         return false;
     }
 
-    // SUCCESS?
-    // Now the server main file has saved the latest transaction number,
-    // NOW we set it onto the parameter and return true.
-    lTransactionNumber = transactionNumber_;
+    lTransactionNumber = number;
 
     return true;
 }
 
+bool Transactor::loadReservedNumbers()
+{
+    Lock lock(number_lock_);
+    const auto filename = reserved_filename();
+
+    if (false == OTDB::Exists(
+                     server_.API(),
+                     server_.API().DataFolder(),
+                     ".",
+                     filename,
+                     "",
+                     "")) {
+
+        return true;
+    }
+
+    const auto record = OTDB::QueryPlainString(
+        server_.API(), server_.API().DataFolder(), ".", filename, "", "");
+    TransactionNumber reserved{0};
+
+    try {
+        reserved = std::stoll(record);
+    } catch (...) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid reservation record: ")(
+            filename)
+            .Flush();
+
+        return false;
+    }
+
+    if (reserved > transactionNumber_) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(
+            ": Resuming after reserved transaction number ")(reserved)
+            .Flush();
+        transactionNumber_ = reserved;
+    }
+
+    reserved_ = transactionNumber_;
+
+    return true;
+}
+
+bool Transactor::reserve(const Lock& lock, const TransactionNumber value)
+{
+    OT_ASSERT(lock.mutex() == &number_lock_);
+    OT_ASSERT(lock.owns_lock());
+
+    const auto saved = OTDB::StorePlainString(
+        server_.API(),
+        std::to_string(value),
+        server_.API().DataFolder(),
+        ".",
+        reserved_filename(),
+        "",
+        "");
+
+    if (saved) { reserved_ = value; }
+
+    return saved;
+}
+
+std::string Transactor::reserved_filename() const
+{
+    return std::string(server_.WalletFilename().Get()) + ".reserved";
+}
+
 // Server stores a map of BASKET_ID to BASKET_ACCOUNT_ID.
 bool Transactor::addBasketAccountID(
     const Identifier& BASKET_ID,
@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace opentxs
@@ -32,13 +33,25 @@ public:
         ClientContext& context,
         TransactionNumber& txNumber);
 
-    TransactionNumber transactionNumber() const { return transactionNumber_; }
+    TransactionNumber transactionNumber() const
+    {
+        Lock lock(number_lock_);
+
+        return transactionNumber_;
+    }
 
     void transactionNumber(TransactionNumber value)
     {
+        Lock lock(number_lock_);
         transactionNumber_ = value;
+        reserved_ = value;
     }
 
+    // Skips past any numbers which were reserved before the notary last
+    // stopped, since some of them may have been issued without the main file
+    // being saved.
+    bool loadReservedNumbers();
+
     bool addBasketAccountID(
         const Identifier& basketId,
         const Identifier& basketAccountId,
@@ -71,8 +84,12 @@ private:
 
     Server& server_;
     const PasswordPrompt& reason_;
+    mutable std::mutex number_lock_;
     // This stores the last VALID AND ISSUED transaction number.
     TransactionNumber transactionNumber_;
+    // Every number up to and including this one has been durably reserved
+    // and may be issued without touching the disk.
+    TransactionNumber reserved_;
     // maps basketId with basketAccountId
     BasketsMap idToBasketMap_;
     // basket issuer account ID, which is *different* on each server, using the
@@ -82,6 +99,9 @@ private:
     // The list of voucher accounts (see GetVoucherAccount below for details)
     AccountList voucherAccounts_;
 
+    std::string reserved_filename() const;
+    bool reserve(const Lock& lock, const TransactionNumber value);
+
     Transactor() = delete;
 };
 }  // namespace server
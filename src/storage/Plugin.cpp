@@ -10,6 +10,10 @@
 #include "opentxs/api/storage/Storage.hpp"
 #include "opentxs/core/Log.hpp"
 
+#include "storage/StorageConfig.hpp"
+
+#include <algorithm>
+
 #define OT_METHOD "opentxs::Plugin"
 
 namespace opentxs
@@ -26,7 +30,28 @@ Plugin::Plugin(
     , storage_(storage)
     , digest_(hash)
     , current_bucket_(bucket)
+    , writer_threads_(static_cast<std::size_t>(
+          std::max<std::int64_t>(1, config.storage_writer_threads_)))
+    , write_queue_limit_(static_cast<std::size_t>(
+          std::max<std::int64_t>(1, config.storage_write_queue_limit_)))
+    , write_lock_()
+    , write_ready_()
+    , write_space_()
+    , writes_()
+    , writers_()
+    , stop_(false)
+{
+}
+
+bool Plugin::BucketKeys(const bool, std::vector<std::string>&) const
+{
+    return false;
+}
+
+bool Plugin::DeleteFromBucket(const std::vector<std::string>&, const bool)
+    const
 {
+    return false;
 }
 
 bool Plugin::Load(
@@ -128,9 +153,59 @@ void Plugin::Store(
     const bool bucket,
     std::promise<bool>& promise) const
 {
-    std::thread thread(
-        &Plugin::store, this, isTransaction, key, value, bucket, &promise);
-    thread.detach();
+    Lock lock(write_lock_);
+
+    if (stop_) {
+        lock.unlock();
+        store(isTransaction, key, value, bucket, &promise);
+
+        return;
+    }
+
+    if (writers_.empty()) {
+        for (std::size_t i{0}; i < writer_threads_; ++i) {
+            writers_.emplace_back(&Plugin::write_worker, this);
+        }
+    }
+
+    if (writes_.size() >= write_queue_limit_) {
+        LogDebug(OT_METHOD)(__FUNCTION__)(": Write queue full (")(
+            writes_.size())(" items), waiting")
+            .Flush();
+    }
+
+    // Block the caller instead of growing the queue without limit
+    write_space_.wait(lock, [this] {
+        return stop_ || (writes_.size() < write_queue_limit_);
+    });
+    writes_.emplace_back(Write{isTransaction, key, value, bucket, &promise});
+    lock.unlock();
+    write_ready_.notify_one();
+}
+
+std::size_t Plugin::QueueDepth() const noexcept
+{
+    Lock lock(write_lock_);
+
+    return writes_.size();
+}
+
+void Plugin::stop_writers() noexcept
+{
+    auto writers = std::vector<std::thread>{};
+
+    {
+        Lock lock(write_lock_);
+        stop_ = true;
+        writers.swap(writers_);
+    }
+
+    write_ready_.notify_all();
+    write_space_.notify_all();
+
+    for (auto& thread : writers) {
+        if (thread.joinable()) { thread.join(); }
+    }
 }
 
 bool Plugin::Store(
@@ -148,4 +223,29 @@ bool Plugin::Store(
 
     return false;
 }
+
+void Plugin::write_worker() const noexcept
+{
+    Lock lock(write_lock_);
+
+    while (true) {
+        write_ready_.wait(
+            lock, [this] { return stop_ || (false == writes_.empty()); });
+
+        // Queued writes are finished even when stopping
+        if (writes_.empty()) { return; }
+
+        auto write = std::move(writes_.front());
+        writes_.pop_front();
+        lock.unlock();
+        write_space_.notify_one();
+        store(
+            write.transaction_,
+            write.key_,
+            write.value_,
+            write.bucket_,
+            write.promise_);
+        lock.lock();
+    }
+}
 }  // namespace opentxs
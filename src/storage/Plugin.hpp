@@ -13,15 +13,28 @@
 #include "opentxs/Proto.tpp"
 #include "opentxs/Types.hpp"
 
+#include "internal/api/storage/Driver.hpp"
+
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace opentxs
 {
 class StorageConfig;
-class Plugin : virtual public opentxs::api::storage::Plugin
+class Plugin : virtual public opentxs::api::storage::Plugin,
+               virtual public opentxs::api::storage::DriverInternal
 {
 public:
+    bool BucketKeys(const bool bucket, std::vector<std::string>& keys)
+        const override;
+    bool DeleteFromBucket(
+        const std::vector<std::string>& keys,
+        const bool bucket) const override;
     bool EmptyBucket(const bool bucket) const override = 0;
 
     bool Load(const std::string& key, const bool checking, std::string& value)
@@ -49,6 +62,7 @@ public:
     bool Migrate(
         const std::string& key,
         const opentxs::api::storage::Driver& to) const override;
+    std::size_t QueueDepth() const noexcept override;
 
     std::string LoadRoot() const override = 0;
     bool StoreRoot(const bool commit, const std::string& hash) const override =
@@ -77,10 +91,32 @@ protected:
         const bool bucket,
         std::promise<bool>* promise) const = 0;
 
+    // Finishes every queued write and joins the writer threads. Drivers must
+    // call this before destroying anything store() depends on.
+    void stop_writers() noexcept;
+
 private:
+    struct Write {
+        bool transaction_;
+        std::string key_;
+        std::string value_;
+        bool bucket_;
+        std::promise<bool>* promise_;
+    };
+
     const api::storage::Storage& storage_;
     const Digest& digest_;
     const Flag& current_bucket_;
+    const std::size_t writer_threads_;
+    const std::size_t write_queue_limit_;
+    mutable std::mutex write_lock_;
+    mutable std::condition_variable write_ready_;
+    mutable std::condition_variable write_space_;
+    mutable std::deque<Write> writes_;
+    mutable std::vector<std::thread> writers_;
+    mutable bool stop_;
+
+    void write_worker() const noexcept;
 
     Plugin(const Plugin&) = delete;
     Plugin(Plugin&&) = delete;
@@ -37,6 +37,10 @@ public:
         C::duration_cast<C::seconds>(C::hours(1)).count();
     std::string path_{};
     InsertCB dht_callback_{};
+    // asynchronous writes are performed by this many threads per driver
+    std::int64_t storage_writer_threads_ = 2;
+    // writers block once this many asynchronous writes are queued
+    std::int64_t storage_write_queue_limit_ = 1024;
 
 #if OT_STORAGE_LMDB
     std::string primary_plugin_ = OT_STORAGE_PRIMARY_PLUGIN_LMDB;
@@ -69,6 +73,10 @@ public:
     std::string lmdb_secondary_bucket_ = "b";
     std::string lmdb_control_table_ = "control";
     std::string lmdb_root_key_ = "root";
+    // microseconds to collect concurrent writes before committing them
+    // together, 0 commits every write separately
+    std::int64_t lmdb_group_commit_window_ = 2000;
+    std::int64_t lmdb_group_commit_bytes_ = 4 * 1024 * 1024;
 #endif
 };
 }  // namespace opentxs
@@ -218,6 +218,36 @@ public:
      */
     bool EmptyBucket(const bool bucket) override;
 
+    /** List every key stored in the specified bucket
+     *
+     *  \param[in] bucket list either the primary (true) or secondary (false)
+     *                    bucket
+     *  \param[out] keys the keys of every object in the bucket
+     *  \returns true if the keys were enumerated
+     *
+     *  \par Implementation
+     *  Optional. Drivers which implement this method and \ref
+     *  DeleteFromBucket allow garbage collection to delete unreachable
+     *  objects in place instead of copying every reachable object into the
+     *  other bucket. The default implementation returns false.
+     */
+    bool BucketKeys(const bool bucket, std::vector<std::string>& keys)
+        const override;
+
+    /** Erase individual objects from the specified bucket
+     *
+     *  \param[in] keys the keys of the objects to be erased
+     *  \param[in] bucket erase from either the primary (true) or
+     *                    secondary (false) bucket
+     *  \returns true unless the backend failed. Keys which do not exist are
+     *           not an error.
+     *
+     *  \warning This method is required to be thread safe
+     */
+    bool DeleteFromBucket(
+        const std::vector<std::string>& keys,
+        const bool bucket) const override;
+
     /** Polymorphic cleanup method.
      */
     void Cleanup() override { Cleanup_StorageExample(); }
@@ -131,10 +131,7 @@ void StorageFSArchive::Cleanup()
     ot_super::Cleanup();
 }
 
-void StorageFSArchive::Cleanup_StorageFSArchive()
-{
-    // future cleanup actions go here
-}
+void StorageFSArchive::Cleanup_StorageFSArchive() { stop_writers(); }
 
 bool StorageFSArchive::EmptyBucket(const bool) const { return true; }
 
@@ -45,6 +45,28 @@ StorageFSGC::StorageFSGC(
     Init_StorageFSGC();
 }
 
+bool StorageFSGC::BucketKeys(
+    const bool bucket,
+    std::vector<std::string>& keys) const
+{
+    std::string directory{};
+    calculate_path("", bucket, directory);
+    boost::system::error_code ec{};
+    auto it = boost::filesystem::directory_iterator(directory, ec);
+
+    if (ec) { return false; }
+
+    for (; it != boost::filesystem::directory_iterator(); it.increment(ec)) {
+        if (ec) { return false; }
+
+        if (boost::filesystem::is_regular_file(it->status())) {
+            keys.emplace_back(it->path().filename().string());
+        }
+    }
+
+    return true;
+}
+
 std::string StorageFSGC::bucket_name(const bool bucket) const
 {
     return bucket ? config_.fs_secondary_bucket_ : config_.fs_primary_bucket_;
@@ -66,9 +88,22 @@ void StorageFSGC::Cleanup()
     ot_super::Cleanup();
 }
 
-void StorageFSGC::Cleanup_StorageFSGC()
+void StorageFSGC::Cleanup_StorageFSGC() { stop_writers(); }
+
+bool StorageFSGC::DeleteFromBucket(
+    const std::vector<std::string>& keys,
+    const bool bucket) const
 {
-    // future cleanup actions go here
+    std::string directory{};
+    auto output{true};
+
+    for (const auto& key : keys) {
+        boost::system::error_code ec{};
+        boost::filesystem::remove(calculate_path(key, bucket, directory), ec);
+        output &= (false == bool(ec));
+    }
+
+    return output;
 }
 
 bool StorageFSGC::EmptyBucket(const bool bucket) const
@@ -16,6 +16,11 @@ private:
     typedef StorageFS ot_super;
 
 public:
+    bool BucketKeys(const bool bucket, std::vector<std::string>& keys)
+        const final;
+    bool DeleteFromBucket(
+        const std::vector<std::string>& keys,
+        const bool bucket) const final;
     bool EmptyBucket(const bool bucket) const final;
 
     void Cleanup() final;
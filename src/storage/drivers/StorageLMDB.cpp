@@ -18,7 +18,11 @@ extern "C" {
 #include <sys/stat.h>
 }
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "StorageLMDB.hpp"
 
@@ -59,7 +63,12 @@ StorageLMDB::StorageLMDB(
               {Table::Control, 0},
               {Table::A, 0},
               {Table::B, 0},
-          })
+          },
+          0,
+          {std::chrono::microseconds{
+               std::max<std::int64_t>(0, config.lmdb_group_commit_window_)},
+           static_cast<std::size_t>(
+               std::max<std::int64_t>(0, config.lmdb_group_commit_bytes_))})
 {
     LogVerbose(OT_METHOD)(__FUNCTION__)(": Using ")(config_.path_).Flush();
     Init_StorageLMDB();
@@ -67,7 +76,40 @@ StorageLMDB::StorageLMDB(
 
 void StorageLMDB::Cleanup() { Cleanup_StorageLMDB(); }
 
-void StorageLMDB::Cleanup_StorageLMDB() {}
+void StorageLMDB::Cleanup_StorageLMDB() { stop_writers(); }
+
+bool StorageLMDB::BucketKeys(
+    const bool bucket,
+    std::vector<std::string>& keys) const
+{
+    return lmdb_.Read(
+        get_table(bucket),
+        [&](const auto key, const auto) -> bool {
+            keys.emplace_back(key);
+
+            return true;
+        },
+        lmdb::LMDB::Dir::Forward);
+}
+
+bool StorageLMDB::DeleteFromBucket(
+    const std::vector<std::string>& keys,
+    const bool bucket) const
+{
+    try {
+        const auto table = get_table(bucket);
+        auto tx = lmdb_.TransactionRW();
+
+        // Keys which are already absent fail individually without aborting
+        // the enclosing transaction
+        for (const auto& key : keys) { lmdb_.Delete(table, key, tx); }
+
+        return tx.Finalize(true);
+    } catch (...) {
+
+        return false;
+    }
+}
 
 bool StorageLMDB::EmptyBucket(const bool bucket) const
 {
@@ -118,8 +160,9 @@ void StorageLMDB::store(
         lmdb_.Queue(get_table(bucket), key, value);
         promise->set_value(true);
     } else {
-        const auto output = lmdb_.Store(get_table(bucket), key, value);
-        promise->set_value(output.first);
+        // The promise is handed to the group committer so this writer thread
+        // is free to queue further writes into the same commit
+        lmdb_.Submit(get_table(bucket), key, value, std::move(*promise));
     }
 }
 
@@ -14,6 +14,7 @@
 #include "storage/StorageConfig.hpp"
 
 #include <string>
+#include <vector>
 
 #include "StorageMemDB.hpp"
 
@@ -48,6 +49,31 @@ StorageMemDB::StorageMemDB(
 {
 }
 
+bool StorageMemDB::BucketKeys(
+    const bool bucket,
+    std::vector<std::string>& keys) const
+{
+    sLock lock(shared_lock_);
+    const auto& map = bucket ? a_ : b_;
+    keys.reserve(keys.size() + map.size());
+
+    for (const auto& [key, value] : map) { keys.emplace_back(key); }
+
+    return true;
+}
+
+bool StorageMemDB::DeleteFromBucket(
+    const std::vector<std::string>& keys,
+    const bool bucket) const
+{
+    eLock lock(shared_lock_);
+    auto& map = bucket ? a_ : b_;
+
+    for (const auto& key : keys) { map.erase(key); }
+
+    return true;
+}
+
 bool StorageMemDB::EmptyBucket(const bool bucket) const
 {
     eLock lock(shared_lock_);
@@ -98,6 +124,8 @@ void StorageMemDB::store(
 {
     OT_ASSERT(nullptr != promise);
 
+    eLock lock(shared_lock_);
+
     if (bucket) {
         a_[key] = value;
     } else {
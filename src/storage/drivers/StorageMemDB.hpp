@@ -13,6 +13,11 @@ class StorageMemDB final : public Plugin,
                            Lockable
 {
 public:
+    bool BucketKeys(const bool bucket, std::vector<std::string>& keys)
+        const final;
+    bool DeleteFromBucket(
+        const std::vector<std::string>& keys,
+        const bool bucket) const final;
     bool EmptyBucket(const bool bucket) const final;
     bool LoadFromBucket(
         const std::string& key,
@@ -21,9 +26,9 @@ public:
     std::string LoadRoot() const final;
     bool StoreRoot(const bool commit, const std::string& hash) const final;
 
-    void Cleanup() final {}
+    void Cleanup() final { stop_writers(); }
 
-    ~StorageMemDB() final = default;
+    ~StorageMemDB() final { stop_writers(); }
 
 private:
     using ot_super = Plugin;
@@ -16,6 +16,7 @@
 #include "opentxs/crypto/key/Symmetric.hpp"
 #include "opentxs/Types.hpp"
 
+#include "internal/api/storage/Driver.hpp"
 #include "storage/tree/Root.hpp"
 #include "storage/tree/Tree.hpp"
 #include "storage/StorageConfig.hpp"
@@ -134,6 +135,40 @@ void StorageMultiplex::Cleanup() { Cleanup_StorageMultiplex(); }
 
 void StorageMultiplex::Cleanup_StorageMultiplex() {}
 
+bool StorageMultiplex::BucketKeys(
+    const bool bucket,
+    std::vector<std::string>& keys) const
+{
+    OT_ASSERT(primary_plugin_);
+
+    const auto* plugin = internal(*primary_plugin_);
+
+    if (nullptr == plugin) { return false; }
+
+    return plugin->BucketKeys(bucket, keys);
+}
+
+bool StorageMultiplex::DeleteFromBucket(
+    const std::vector<std::string>& keys,
+    const bool bucket) const
+{
+    OT_ASSERT(primary_plugin_);
+
+    const auto* primary = internal(*primary_plugin_);
+
+    if (nullptr == primary) { return false; }
+
+    for (const auto& plugin : backup_plugins_) {
+        OT_ASSERT(plugin);
+
+        const auto* backup = internal(*plugin);
+
+        if (nullptr != backup) { backup->DeleteFromBucket(keys, bucket); }
+    }
+
+    return primary->DeleteFromBucket(keys, bucket);
+}
+
 bool StorageMultiplex::EmptyBucket(const bool bucket) const
 {
     OT_ASSERT(primary_plugin_);
@@ -271,6 +306,14 @@ void StorageMultiplex::InitEncryptedBackup([
 #endif
 }
 
+// Every plugin built by this class derives from opentxs::Plugin, but the
+// exported plugin interface does not offer the garbage collection operations
+const opentxs::api::storage::DriverInternal* StorageMultiplex::internal(
+    const opentxs::api::storage::Plugin& plugin) noexcept
+{
+    return dynamic_cast<const opentxs::api::storage::DriverInternal*>(&plugin);
+}
+
 bool StorageMultiplex::Load(
     const std::string& key,
     const bool checking,
@@ -415,6 +458,27 @@ void StorageMultiplex::migrate_primary(
     old.reset(newPlugin.release());
 }
 
+// Every plugin receives each write, so the depth covers all of them
+std::size_t StorageMultiplex::QueueDepth() const noexcept
+{
+    OT_ASSERT(primary_plugin_);
+
+    auto output = std::size_t{0};
+    const auto* primary = internal(*primary_plugin_);
+
+    if (nullptr != primary) { output += primary->QueueDepth(); }
+
+    for (const auto& plugin : backup_plugins_) {
+        OT_ASSERT(plugin);
+
+        const auto* backup = internal(*plugin);
+
+        if (nullptr != backup) { output += backup->QueueDepth(); }
+    }
+
+    return output;
+}
+
 opentxs::api::storage::Driver& StorageMultiplex::Primary()
 {
     OT_ASSERT(primary_plugin_);
@@ -432,6 +496,10 @@ bool StorageMultiplex::Store(
 
     std::vector<std::promise<bool>> promises{};
     std::vector<std::future<bool>> futures{};
+    // The writers hold pointers to these promises so the vectors must never
+    // reallocate
+    promises.reserve(1 + backup_plugins_.size());
+    futures.reserve(1 + backup_plugins_.size());
     promises.push_back(std::promise<bool>());
     auto& primaryPromise = promises.back();
     futures.push_back(primaryPromise.get_future());
@@ -9,9 +9,16 @@
 
 namespace opentxs::storage::implementation
 {
-class StorageMultiplex final : virtual public opentxs::api::storage::Multiplex
+class StorageMultiplex final
+    : virtual public opentxs::api::storage::Multiplex,
+      virtual public opentxs::api::storage::DriverInternal
 {
 public:
+    bool BucketKeys(const bool bucket, std::vector<std::string>& keys)
+        const final;
+    bool DeleteFromBucket(
+        const std::vector<std::string>& keys,
+        const bool bucket) const final;
     bool EmptyBucket(const bool bucket) const final;
     bool LoadFromBucket(
         const std::string& key,
@@ -23,6 +30,7 @@ public:
     bool Migrate(
         const std::string& key,
         const opentxs::api::storage::Driver& to) const final;
+    std::size_t QueueDepth() const noexcept final;
     bool Store(
         const bool isTransaction,
         const std::string& key,
@@ -78,6 +86,9 @@ private:
     StorageMultiplex& operator=(const StorageMultiplex&) = delete;
     StorageMultiplex& operator=(StorageMultiplex&&) = delete;
 
+    static const opentxs::api::storage::DriverInternal* internal(
+        const opentxs::api::storage::Plugin& plugin) noexcept;
+
     void Cleanup();
     void Cleanup_StorageMultiplex();
     void init(
@@ -77,7 +77,11 @@ std::string StorageSqlite3::bind_key(
 
 void StorageSqlite3::Cleanup() { Cleanup_StorageSqlite3(); }
 
-void StorageSqlite3::Cleanup_StorageSqlite3() { sqlite3_close(db_); }
+void StorageSqlite3::Cleanup_StorageSqlite3()
+{
+    stop_writers();
+    sqlite3_close(db_);
+}
 
 void StorageSqlite3::commit(std::stringstream& sql) const
 {
@@ -100,6 +104,37 @@ bool StorageSqlite3::commit_transaction(const std::string& rootHash) const
         sqlite3_exec(db_, sql.str().c_str(), nullptr, nullptr, nullptr));
 }
 
+bool StorageSqlite3::BucketKeys(
+    const bool bucket,
+    std::vector<std::string>& keys) const
+{
+    sqlite3_stmt* statement{nullptr};
+    const std::string query = "SELECT k FROM `" + GetTableName(bucket) + "`;";
+
+    if (SQLITE_OK !=
+        sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, nullptr)) {
+
+        return false;
+    }
+
+    auto result = sqlite3_step(statement);
+
+    while (SQLITE_ROW == result) {
+        const auto size = sqlite3_column_bytes(statement, 0);
+        const auto key = sqlite3_column_text(statement, 0);
+
+        if (nullptr != key) {
+            keys.emplace_back(reinterpret_cast<const char*>(key), size);
+        }
+
+        result = sqlite3_step(statement);
+    }
+
+    sqlite3_finalize(statement);
+
+    return SQLITE_DONE == result;
+}
+
 bool StorageSqlite3::Create(const std::string& tablename) const
 {
     const std::string createTable = "create table if not exists ";
@@ -110,6 +145,39 @@ bool StorageSqlite3::Create(const std::string& tablename) const
         SQLITE_OK == sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr));
 }
 
+bool StorageSqlite3::DeleteFromBucket(
+    const std::vector<std::string>& keys,
+    const bool bucket) const
+{
+    sqlite3_stmt* statement{nullptr};
+    const std::string query =
+        "DELETE FROM `" + GetTableName(bucket) + "` WHERE k = ?1;";
+
+    if (SQLITE_OK !=
+        sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, nullptr)) {
+
+        return false;
+    }
+
+    auto output{true};
+    Lock lock(transaction_lock_);
+    sqlite3_exec(db_, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr);
+
+    for (const auto& key : keys) {
+        sqlite3_bind_text(
+            statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
+        output &= (SQLITE_DONE == sqlite3_step(statement));
+        sqlite3_reset(statement);
+    }
+
+    sqlite3_finalize(statement);
+    output &=
+        (SQLITE_OK ==
+         sqlite3_exec(db_, "COMMIT TRANSACTION;", nullptr, nullptr, nullptr));
+
+    return output;
+}
+
 bool StorageSqlite3::EmptyBucket(const bool bucket) const
 {
     return Purge(GetTableName(bucket));
@@ -13,6 +13,11 @@ class StorageSqlite3 final : public virtual Plugin,
                              public virtual opentxs::api::storage::Driver
 {
 public:
+    bool BucketKeys(const bool bucket, std::vector<std::string>& keys)
+        const final;
+    bool DeleteFromBucket(
+        const std::vector<std::string>& keys,
+        const bool bucket) const final;
     bool EmptyBucket(const bool bucket) const final;
     bool LoadFromBucket(
         const std::string& key,
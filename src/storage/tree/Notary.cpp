@@ -8,20 +8,32 @@
 #include "Notary.hpp"
 
 #include "opentxs/core/identifier/UnitDefinition.hpp"
+#include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 
 #include "storage/Plugin.hpp"
 
+#include <utility>
+
 #define STORAGE_NOTARY_VERSION 1
 #if OT_CASH
 #define STORAGE_MINT_SERIES_VERSION 1
 #define STORAGE_MINT_SERIES_HASH_VERSION 2
 #define STORAGE_MINT_SPENT_LIST_VERSION 1
+#define STORAGE_MINT_SPENT_PAGE_SIZE 1024
 #endif
 #define OT_METHOD "opentxs::storage::Notary::"
 
 namespace opentxs::storage
 {
+Notary::Series::Series()
+    : pages_()
+    , loaded_(false)
+    , keys_()
+    , tail_()
+{
+}
+
 Notary::Notary(
     const opentxs::api::storage::Driver& storage,
     const std::string& hash,
@@ -40,78 +52,116 @@ Notary::Notary(
 }
 
 #if OT_CASH
-bool Notary::CheckSpent(
-    const identifier::UnitDefinition& unit,
+bool Notary::append(
+    const std::string& unitID,
     const MintSeries series,
-    const std::string& key) const
+    const std::vector<std::string>& keys,
+    std::vector<std::string>& pages,
+    proto::SpentTokenList& tail) const
 {
-    if (key.empty()) { throw std::runtime_error("Invalid token key"); }
+    if (pages.empty()) { pages.emplace_back(); }
 
-    Lock lock(write_lock_);
-    const auto list = get_or_create_list(lock, unit.str(), series);
+    bool dirty{false};
 
-    for (const auto& spent : list.spent()) {
-        if (spent == key) {
-            LogTrace(OT_METHOD)(__FUNCTION__)("Token ")(key)(
-                " is already spent.")
-                .Flush();
+    for (const auto& key : keys) {
+        if (STORAGE_MINT_SPENT_PAGE_SIZE <= tail.spent_size()) {
+            if (dirty && (false == driver_.StoreProto(tail, pages.back()))) {
+
+                return false;
+            }
 
-            return true;
+            blank_page(unitID, series, tail);
+            pages.emplace_back();
         }
+
+        tail.add_spent(key);
+        dirty = true;
     }
 
-    LogTrace(OT_METHOD)(__FUNCTION__)("Token ")(key)(" has never been spent.")
-        .Flush();
+    OT_ASSERT(proto::Validate(tail, VERBOSE));
 
-    return false;
+    return driver_.StoreProto(tail, pages.back());
 }
 
-std::string Notary::create_list(
+void Notary::blank_page(
     const std::string& unitID,
     const MintSeries series,
-    std::shared_ptr<proto::SpentTokenList>& output) const
+    proto::SpentTokenList& output) const
 {
-    std::string hash{};
-    output.reset(new proto::SpentTokenList);
+    output.Clear();
+    output.set_version(STORAGE_MINT_SPENT_LIST_VERSION);
+    output.set_notary(id_);
+    output.set_unit(unitID);
+    output.set_series(series);
+}
 
-    OT_ASSERT(output);
+bool Notary::CheckSpent(
+    const identifier::UnitDefinition& unit,
+    const MintSeries series,
+    const std::string& key) const
+{
+    return CheckSpent(unit, SpentKeys{{series, {key}}});
+}
 
-    auto& list = *output;
-    list.set_version(STORAGE_MINT_SPENT_LIST_VERSION);
-    list.set_notary(id_);
-    list.set_unit(unitID);
-    list.set_series(series);
+bool Notary::CheckSpent(
+    const identifier::UnitDefinition& unit,
+    const SpentKeys& keys) const
+{
+    const auto unitID = unit.str();
+    Lock lock(write_lock_);
 
-    const auto saved = driver_.StoreProto(list, hash);
+    for (const auto& [series, list] : keys) {
+        const auto& index = load(lock, unitID, series).keys_;
 
-    if (false == saved) {
-        throw std::runtime_error("Failed to create spent token list");
+        for (const auto& key : list) {
+            if (key.empty()) { throw std::runtime_error("Invalid token key"); }
+
+            if (0 < index.count(key)) {
+                LogTrace(OT_METHOD)(__FUNCTION__)(": Token ")(key)(
+                    " is already spent.")
+                    .Flush();
+
+                return true;
+            }
+        }
     }
 
-    return hash;
+    LogTrace(OT_METHOD)(__FUNCTION__)(": No token has ever been spent.")
+        .Flush();
+
+    return false;
 }
 
-proto::SpentTokenList Notary::get_or_create_list(
+Notary::Series& Notary::load(
     const Lock& lock,
     const std::string& unitID,
     const MintSeries series) const
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    std::shared_ptr<proto::SpentTokenList> output{};
-    auto& hash = mint_map_[unitID][series];
+    auto& output = mint_map_[unitID][series];
 
-    if (hash.empty()) {
-        hash = create_list(unitID, series, output);
-    } else {
-        driver_.LoadProto(hash, output);
-    }
+    if (output.loaded_) { return output; }
 
-    if (false == bool(output)) {
-        throw std::runtime_error("Failed to load spent token list");
+    for (const auto& hash : output.pages_) {
+        std::shared_ptr<proto::SpentTokenList> page{};
+
+        if (false == driver_.LoadProto(hash, page)) {
+            throw std::runtime_error("Failed to load spent token list");
+        }
+
+        OT_ASSERT(page);
+
+        for (const auto& key : page->spent()) { output.keys_.emplace(key); }
+
+        output.tail_ = *page;
     }
 
-    return *output;
+    if (output.pages_.empty()) { blank_page(unitID, series, output.tail_); }
+
+    output.loaded_ = true;
+
+    return output;
 }
 #endif
 
@@ -131,12 +181,14 @@ void Notary::init(const std::string& hash)
     id_ = serialized->id();
 
 #if OT_CASH
+    // A series written before spent lists were paged has a single entry,
+    // which becomes the first page
     for (const auto& it : serialized->series()) {
         auto& unitMap = mint_map_[it.unit()];
 
         for (const auto& storageHash : it.series()) {
             const auto series = std::stoul(storageHash.alias());
-            unitMap[series] = storageHash.hash();
+            unitMap[series].pages_.emplace_back(storageHash.hash());
         }
     }
 #endif
@@ -148,26 +200,116 @@ bool Notary::MarkSpent(
     const MintSeries series,
     const std::string& key)
 {
-    if (key.empty()) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid key ").Flush();
+    return MarkSpent(unit, SpentKeys{{series, {key}}});
+}
 
-        return false;
-    }
+bool Notary::MarkSpent(
+    const identifier::UnitDefinition& unit,
+    const SpentKeys& keys)
+{
+    using Pages = std::pair<std::vector<std::string>, proto::SpentTokenList>;
 
+    const auto unitID = unit.str();
     Lock lock(write_lock_);
-    auto list = get_or_create_list(lock, unit.str(), series);
-    list.add_spent(key);
 
-    OT_ASSERT(proto::Validate(list, VERBOSE));
+    for (const auto& [series, list] : keys) {
+        const auto& index = load(lock, unitID, series).keys_;
+        std::unordered_set<std::string> batch{};
 
-    auto& hash = mint_map_[unit.str()][series];
-    LogTrace(OT_METHOD)(__FUNCTION__)(": Token ")(key)(" marked as spent.")
-        .Flush();
+        for (const auto& key : list) {
+            if (key.empty()) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid key ").Flush();
+
+                return false;
+            }
+
+            if (0 < index.count(key)) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Token ")(key)(
+                    " is already spent.")
+                    .Flush();
+
+                return false;
+            }
+
+            if (false == batch.emplace(key).second) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Token ")(key)(
+                    " appears more than once.")
+                    .Flush();
+
+                return false;
+            }
+        }
+    }
 
-    return driver_.StoreProto(list, hash);
+    // Nothing is visible in memory until every page has been written
+    std::map<MintSeries, Pages> updated{};
+
+    for (const auto& [series, list] : keys) {
+        const auto& data = load(lock, unitID, series);
+        auto& [pages, tail] = updated[series];
+        pages = data.pages_;
+        tail = data.tail_;
+
+        if (false == append(unitID, series, list, pages, tail)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to save spent token list")
+                .Flush();
+
+            return false;
+        }
+    }
+
+    auto& unitMap = mint_map_[unitID];
+
+    for (auto& [series, update] : updated) {
+        auto& data = unitMap[series];
+        std::swap(data.pages_, update.first);
+        std::swap(data.tail_, update.second);
+    }
+
+    if (false == save(lock)) {
+        for (auto& [series, update] : updated) {
+            auto& data = unitMap[series];
+            std::swap(data.pages_, update.first);
+            std::swap(data.tail_, update.second);
+        }
+
+        return false;
+    }
+
+    for (const auto& [series, list] : keys) {
+        auto& index = unitMap[series].keys_;
+
+        for (const auto& key : list) {
+            index.emplace(key);
+            LogTrace(OT_METHOD)(__FUNCTION__)(": Token ")(key)(
+                " marked as spent.")
+                .Flush();
+        }
+    }
+
+    return true;
 }
 #endif
 
+bool Notary::Migrate(const opentxs::api::storage::Driver& to) const
+{
+    Lock lock(write_lock_);
+    auto output = Node::migrate(root_, to);
+
+#if OT_CASH
+    for (const auto& [unitID, seriesMap] : mint_map_) {
+        for (const auto& [series, data] : seriesMap) {
+            for (const auto& hash : data.pages_) {
+                output &= Node::migrate(hash, to);
+            }
+        }
+    }
+#endif
+
+    return output;
+}
+
 bool Notary::save(const Lock& lock) const
 {
     if (false == verify_write_lock(lock)) {
@@ -191,19 +333,31 @@ proto::StorageNotary Notary::serialize() const
 
 #if OT_CASH
     for (const auto& [unitID, seriesMap] : mint_map_) {
-        auto& series = *serialized.add_series();
-        series.set_version(STORAGE_MINT_SERIES_VERSION);
-        series.set_notary(id_);
-        series.set_unit(unitID);
+        proto::StorageMintSeries* series{nullptr};
 
-        for (const auto& [seriesNumber, hash] : seriesMap) {
-            auto& storageHash = *series.add_series();
+        for (const auto& [seriesNumber, data] : seriesMap) {
             const auto seriesString = std::to_string(seriesNumber);
-            storageHash.set_version(STORAGE_MINT_SERIES_HASH_VERSION);
-            storageHash.set_itemid(Identifier::Factory(seriesString)->str());
-            storageHash.set_hash(hash);
-            storageHash.set_alias(seriesString);
-            storageHash.set_type(proto::STORAGEHASH_PROTO);
+
+            for (std::size_t i{0}; i < data.pages_.size(); ++i) {
+                if (nullptr == series) {
+                    series = serialized.add_series();
+                    series->set_version(STORAGE_MINT_SERIES_VERSION);
+                    series->set_notary(id_);
+                    series->set_unit(unitID);
+                }
+
+                // Every page of a series shares the series number as its
+                // alias, so the item id is derived from the page position
+                auto itemID = Identifier::Factory();
+                itemID->CalculateDigest(
+                    unitID + seriesString + std::to_string(i));
+                auto& storageHash = *series->add_series();
+                storageHash.set_version(STORAGE_MINT_SERIES_HASH_VERSION);
+                storageHash.set_itemid(itemID->str());
+                storageHash.set_hash(data.pages_.at(i));
+                storageHash.set_alias(seriesString);
+                storageHash.set_type(proto::STORAGEHASH_PROTO);
+            }
         }
     }
 #endif
@@ -9,10 +9,13 @@
 
 #include "opentxs/api/storage/Storage.hpp"
 #include "opentxs/api/Editor.hpp"
+#include "opentxs/Proto.hpp"
 
 #include "Node.hpp"
 
 #include <map>
+#include <unordered_set>
+#include <vector>
 
 namespace opentxs::storage
 {
@@ -20,24 +23,52 @@ class Notary final : public Node
 {
 public:
     using MintSeries = std::uint64_t;
+    using SpentKeys = std::map<MintSeries, std::vector<std::string>>;
 
 #if OT_CASH
     bool CheckSpent(
         const identifier::UnitDefinition& unit,
         const MintSeries series,
         const std::string& key) const;
+    /** Returns true if any of the keys has already been spent */
+    bool CheckSpent(
+        const identifier::UnitDefinition& unit,
+        const SpentKeys& keys) const;
 
     bool MarkSpent(
         const identifier::UnitDefinition& unit,
         const MintSeries series,
         const std::string& key);
+    /** Records every key or none of them
+     *
+     *  Fails without recording anything if any key is already spent or
+     *  appears more than once in the batch.
+     */
+    bool MarkSpent(
+        const identifier::UnitDefinition& unit,
+        const SpentKeys& keys);
 #endif
+    bool Migrate(const opentxs::api::storage::Driver& to) const final;
 
     ~Notary() final = default;
 
 private:
     friend class Tree;
-    using SeriesMap = std::map<MintSeries, std::string>;
+
+    /** Spent keys for one mint series are stored as a chain of bounded
+     *  pages so recording a token only rewrites the last page. The index
+     *  of every key is built the first time the series is accessed.
+     */
+    struct Series {
+        std::vector<std::string> pages_;
+        bool loaded_;
+        std::unordered_set<std::string> keys_;
+        proto::SpentTokenList tail_;
+
+        Series();
+    };
+
+    using SeriesMap = std::map<MintSeries, Series>;
     using UnitMap = std::map<std::string, SeriesMap>;
 
     std::string id_;
@@ -45,11 +76,17 @@ private:
 #if OT_CASH
     mutable UnitMap mint_map_;
 
-    std::string create_list(
+    bool append(
+        const std::string& unitID,
+        const MintSeries series,
+        const std::vector<std::string>& keys,
+        std::vector<std::string>& pages,
+        proto::SpentTokenList& tail) const;
+    void blank_page(
         const std::string& unitID,
         const MintSeries series,
-        std::shared_ptr<proto::SpentTokenList>& output) const;
-    proto::SpentTokenList get_or_create_list(
+        proto::SpentTokenList& output) const;
+    Series& load(
         const Lock& lock,
         const std::string& unitID,
         const MintSeries series) const;
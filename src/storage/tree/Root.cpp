@@ -11,6 +11,7 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/Proto.hpp"
 
+#include "internal/api/storage/Driver.hpp"
 #include "storage/Plugin.hpp"
 #include "BlockchainTransactions.hpp"
 #include "Contacts.hpp"
@@ -23,7 +24,16 @@
 #include "Tree.hpp"
 #include "Units.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_set>
+
 #define CURRENT_VERSION 2
+#define GC_DELETE_BATCH 64
+#define GC_SLICE_MILLISECONDS 10
 
 #define OT_METHOD "opentxs::storage::Root::"
 
@@ -31,6 +41,99 @@ namespace opentxs
 {
 namespace storage
 {
+namespace
+{
+// Stands in for the real driver while tracing the tree. Every hash which the
+// tree would migrate is recorded as live instead of being copied, so only
+// interior nodes are read.
+//
+// Nodes abort the process when they fail to load, so a failed load throws
+// instead. That stops the trace before a partial live set can be swept.
+class Mark final : virtual public opentxs::api::storage::Driver
+{
+public:
+    bool EmptyBucket(const bool) const final { return false; }
+    bool IsLive(const std::string& key) const { return 0 < live_.count(key); }
+    bool Load(const std::string& key, const bool checking, std::string& value)
+        const final
+    {
+        const auto output = driver_.Load(key, checking, value);
+
+        if ((false == output) && (false == checking)) {
+            throw std::runtime_error("Failed to load " + key);
+        }
+
+        return output;
+    }
+    bool LoadFromBucket(
+        const std::string& key,
+        std::string& value,
+        const bool bucket) const final
+    {
+        return driver_.LoadFromBucket(key, value, bucket);
+    }
+    std::string LoadRoot() const final { return driver_.LoadRoot(); }
+    bool Migrate(const std::string& key, const Driver&) const final
+    {
+        live_.emplace(key);
+
+        return true;
+    }
+    bool Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket) const final
+    {
+        live_.emplace(key);
+
+        return driver_.Store(isTransaction, key, value, bucket);
+    }
+    void Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>& promise) const final
+    {
+        live_.emplace(key);
+        driver_.Store(isTransaction, key, value, bucket, promise);
+    }
+    bool Store(
+        const bool isTransaction,
+        const std::string& value,
+        std::string& key) const final
+    {
+        const auto output = driver_.Store(isTransaction, value, key);
+        live_.emplace(key);
+
+        return output;
+    }
+    bool StoreRoot(const bool commit, const std::string& hash) const final
+    {
+        return driver_.StoreRoot(commit, hash);
+    }
+
+    Mark(const opentxs::api::storage::Driver& driver)
+        : driver_(driver)
+        , live_()
+    {
+    }
+
+    ~Mark() final = default;
+
+private:
+    const opentxs::api::storage::Driver& driver_;
+    mutable std::unordered_set<std::string> live_;
+
+    Mark() = delete;
+    Mark(const Mark&) = delete;
+    Mark(Mark&&) = delete;
+    Mark& operator=(const Mark&) = delete;
+    Mark& operator=(Mark&&) = delete;
+};
+}  // namespace
+
 Root::Root(
     const opentxs::api::storage::Driver& storage,
     const std::string& hash,
@@ -99,13 +202,22 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
     bool success{false};
 
     if (Node::check_hash(gc_root_)) {
-        const class Tree tree(driver_, gc_root_);
-        success = tree.Migrate(*to);
+        auto garbage = std::vector<std::string>{};
+        auto supported{true};
+
+        if (find_garbage(oldLocation, garbage, supported)) {
+            success = sweep(oldLocation, garbage);
+        } else if (false == supported) {
+            // The driver can not delete individual objects so every
+            // reachable object is copied out of the old bucket instead
+            const class Tree tree(driver_, gc_root_);
+            success = tree.Migrate(*to);
+
+            if (success) { driver_.EmptyBucket(oldLocation); }
+        }
     }
 
-    if (success) {
-        driver_.EmptyBucket(oldLocation);
-    } else {
+    if (false == success) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Garbage collection failed. "
                                            "Will retry next cycle.")
             .Flush();
@@ -123,6 +235,60 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
     LogTrace(OT_METHOD)(__FUNCTION__)(": Finished garbage collection.").Flush();
 }
 
+// New objects are never written to the old bucket while it is being
+// collected, so everything there which is unreachable from gc_root_ is garbage.
+// Reachable objects stay where they are and are found by the fallback lookup
+// in the other bucket.
+//
+// Returns false with supported unset if the driver can not list or delete
+// individual objects, or false with supported set if the live set could not
+// be completed. Nothing may be swept in the latter case.
+bool Root::find_garbage(
+    const bool bucket,
+    std::vector<std::string>& garbage,
+    bool& supported) const
+{
+    supported = false;
+    const auto* driver =
+        dynamic_cast<const opentxs::api::storage::DriverInternal*>(&driver_);
+
+    if (nullptr == driver) { return false; }
+
+    auto keys = std::vector<std::string>{};
+
+    if (false == driver->BucketKeys(bucket, keys)) { return false; }
+
+    supported = true;
+    const Mark mark(driver_);
+
+    try {
+        const class Tree tree(mark, gc_root_);
+
+        if (false == tree.Migrate(mark)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to mark reachable objects.")
+                .Flush();
+
+            return false;
+        }
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+
+        return false;
+    }
+
+    std::copy_if(
+        keys.begin(),
+        keys.end(),
+        std::back_inserter(garbage),
+        [&](const auto& key) { return false == mark.IsLive(key); });
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Found ")(garbage.size())(
+        " unreachable objects out of ")(keys.size())(".")
+        .Flush();
+
+    return true;
+}
+
 void Root::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageRoot> serialized;
@@ -222,6 +388,40 @@ bool Root::Save(const opentxs::api::storage::Driver& to) const
     return save(lock, to);
 }
 
+// Each slice holds the write lock for a bounded time so that garbage is
+// reclaimed between writes instead of stalling them for the whole cycle
+bool Root::sweep(const bool bucket, const std::vector<std::string>& garbage)
+    const
+{
+    const auto* driver =
+        dynamic_cast<const opentxs::api::storage::DriverInternal*>(&driver_);
+
+    if (nullptr == driver) { return false; }
+
+    bool output{true};
+    auto next = garbage.begin();
+
+    while (garbage.end() != next) {
+        Lock lock(write_lock_);
+        const auto stop = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(GC_SLICE_MILLISECONDS);
+
+        while ((garbage.end() != next) &&
+               (std::chrono::steady_clock::now() < stop)) {
+            const auto count = std::min<std::ptrdiff_t>(
+                GC_DELETE_BATCH, std::distance(next, garbage.end()));
+            const auto batch = std::vector<std::string>(next, next + count);
+            output &= driver->DeleteFromBucket(batch, bucket);
+            next += count;
+        }
+
+        lock.unlock();
+        std::this_thread::yield();
+    }
+
+    return output;
+}
+
 std::uint64_t Root::Sequence() const { return sequence_.load(); }
 
 proto::StorageRoot Root::serialize() const
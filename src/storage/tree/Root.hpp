@@ -18,6 +18,7 @@
 #include <limits>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace opentxs
 {
@@ -49,10 +50,16 @@ private:
     void blank(const VersionNumber version) final;
     void cleanup() const;
     void collect_garbage(const opentxs::api::storage::Driver* to) const;
+    bool find_garbage(
+        const bool bucket,
+        std::vector<std::string>& garbage,
+        bool& supported) const;
     void init(const std::string& hash) final;
     bool save(const Lock& lock, const opentxs::api::storage::Driver& to) const;
     bool save(const Lock& lock) const final;
     void save(storage::Tree* tree, const Lock& lock);
+    bool sweep(const bool bucket, const std::vector<std::string>& garbage)
+        const;
 
     Root(
         const opentxs::api::storage::Driver& storage,
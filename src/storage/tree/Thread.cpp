@@ -14,12 +14,25 @@
 #include "storage/Plugin.hpp"
 #include "Mailbox.hpp"
 
+#include <algorithm>
+
+#define THREAD_INDEX_VERSION 2
+#define THREAD_SEGMENT_SIZE 64
+
 #define OT_METHOD "opentxs::storage::Thread::"
 
 namespace opentxs
 {
 namespace storage
 {
+Thread::Segment::Segment(const std::string& hash, const bool loaded)
+    : hash_(hash)
+    , loaded_(loaded)
+    , dirty_(false)
+    , items_()
+{
+}
+
 Thread::Thread(
     const opentxs::api::storage::Driver& storage,
     const std::string& id,
@@ -33,7 +46,8 @@ Thread::Thread(
     , index_(0)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
-    , items_()
+    , segments_()
+    , positions_()
     , participants_()
 {
     if (check_hash(hash)) {
@@ -55,7 +69,8 @@ Thread::Thread(
     , index_(0)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
-    , items_()
+    , segments_()
+    , positions_()
     , participants_(participants)
 {
     blank(1);
@@ -104,7 +119,15 @@ bool Thread::Add(
         return false;
     }
 
-    auto& item = items_[id];
+    // An existing item is updated in whichever segment holds it
+    auto* segment = find(lock, id);
+
+    if (nullptr == segment) {
+        segment = &tail(lock);
+        positions_[id] = segments_.size() - 1;
+    }
+
+    auto& item = segment->items_[id];
     item.set_version(version_);
     item.set_id(id);
 
@@ -122,11 +145,14 @@ bool Thread::Add(
     const auto valid = proto::Validate(item, VERBOSE);
 
     if (false == valid) {
-        items_.erase(id);
+        segment->items_.erase(id);
+        positions_.erase(id);
 
         return false;
     }
 
+    segment->dirty_ = true;
+
     return save(lock);
 }
 
@@ -137,7 +163,95 @@ std::string Thread::Alias() const
     return alias_;
 }
 
+bool Thread::Check(const std::string& id) const
+{
+    Lock lock(write_lock_);
+
+    return nullptr != find(lock, id);
+}
+
+Thread::Segment* Thread::find(const Lock& lock, const std::string& id) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    const auto it = positions_.find(id);
+
+    if (positions_.end() != it) { return &segments_.at(it->second); }
+
+    // Only segments which have not been read yet can hold an unknown item.
+    // Recent items are the most likely to be looked up, so search from the
+    // tail.
+    for (auto i = segments_.size(); i > 0; --i) {
+        const auto position = i - 1;
+        auto& segment = segments_.at(position);
+
+        if (segment.loaded_) { continue; }
+
+        load(lock, position);
+
+        if (0 < segment.items_.count(id)) { return &segment; }
+    }
+
+    return nullptr;
+}
+
+std::string Thread::ID() const { return id_; }
+
 void Thread::init(const std::string& hash)
+{
+    std::string raw{};
+
+    if (false == driver_.Load(hash, false, raw)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to load thread index file.")
+            .Flush();
+        OT_FAIL;
+    }
+
+    proto::StorageNymList index{};
+    const auto segmented =
+        index.ParseFromArray(raw.data(), static_cast<int>(raw.size())) &&
+        (0 < index.nym_size()) && proto::Validate(index, SILENT);
+
+    if (false == segmented) {
+        init_legacy(hash);
+        Lock lock(write_lock_);
+        upgrade(lock);
+
+        return;
+    }
+
+    for (const auto& segment : index.nym()) {
+        segments_.emplace_back(segment.hash(), false);
+    }
+
+    // The first segment provides the participants and the tail segment
+    // receives new items. Everything in between is loaded on demand.
+    std::shared_ptr<proto::StorageThread> first;
+    driver_.LoadProto(segments_.front().hash_, first);
+
+    if (false == bool(first)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to load thread segment file.")
+            .Flush();
+        OT_FAIL;
+    }
+
+    init_version(1, *first);
+
+    for (const auto& participant : first->participant()) {
+        participants_.emplace(participant);
+    }
+
+    Lock lock(write_lock_);
+    read(lock, 0, *first);
+    load(lock, segments_.size() - 1);
+    upgrade(lock);
+}
+
+// Threads written before segmentation are a single proto::StorageThread. The
+// items are split into segments in memory and written out by the next save.
+void Thread::init_legacy(const std::string& hash)
 {
     std::shared_ptr<proto::StorageThread> serialized;
     driver_.LoadProto(hash, serialized);
@@ -156,52 +270,120 @@ void Thread::init(const std::string& hash)
     }
 
     for (const auto& it : serialized->item()) {
+        if (segments_.empty() ||
+            (THREAD_SEGMENT_SIZE <= segments_.back().items_.size())) {
+            segments_.emplace_back(Node::BLANK_HASH, true);
+            segments_.back().dirty_ = true;
+        }
+
         const auto& index = it.index();
-        items_.emplace(it.id(), it);
+        segments_.back().items_.emplace(it.id(), it);
+        positions_[it.id()] = segments_.size() - 1;
 
         if (index >= index_) { index_ = index + 1; }
     }
+}
 
+proto::StorageThread Thread::Items() const
+{
     Lock lock(write_lock_);
-    upgrade(lock);
+
+    return serialize(lock, 0, segments_.size());
 }
 
-bool Thread::Check(const std::string& id) const
+proto::StorageThread Thread::Items(
+    const std::size_t first,
+    const std::size_t count) const
 {
     Lock lock(write_lock_);
 
-    return items_.end() != items_.find(id);
+    return serialize(lock, first, count);
 }
 
-std::string Thread::ID() const { return id_; }
+void Thread::load(const Lock& lock, const std::size_t position) const
+{
+    OT_ASSERT(verify_write_lock(lock));
 
-proto::StorageThread Thread::Items() const
+    auto& segment = segments_.at(position);
+
+    if (segment.loaded_) { return; }
+
+    std::shared_ptr<proto::StorageThread> serialized;
+    driver_.LoadProto(segment.hash_, serialized);
+
+    if (false == bool(serialized)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to load thread segment file.")
+            .Flush();
+        OT_FAIL;
+    }
+
+    read(lock, position, *serialized);
+}
+
+void Thread::load_all(const Lock& lock) const
+{
+    for (std::size_t i{0}; i < segments_.size(); ++i) { load(lock, i); }
+}
+
+bool Thread::Migrate(const opentxs::api::storage::Driver& to) const
 {
     Lock lock(write_lock_);
+    auto output = Node::migrate(root_, to);
+
+    for (const auto& segment : segments_) {
+        output &= Node::migrate(segment.hash_, to);
+    }
 
-    return serialize(lock);
+    return output;
 }
 
-bool Thread::Migrate(const opentxs::api::storage::Driver& to) const
+// Items removed from the end of the thread leave empty segments behind. The
+// first segment is kept since it carries the participants.
+void Thread::prune(const Lock& lock) const
 {
-    return Node::migrate(root_, to);
+    OT_ASSERT(verify_write_lock(lock));
+
+    while ((1 < segments_.size()) && segments_.back().loaded_ &&
+           segments_.back().items_.empty()) {
+        segments_.pop_back();
+    }
+}
+
+void Thread::read(
+    const Lock& lock,
+    const std::size_t position,
+    const proto::StorageThread& serialized) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto& segment = segments_.at(position);
+
+    for (const auto& it : serialized.item()) {
+        const auto& index = it.index();
+        segment.items_.emplace(it.id(), it);
+        positions_[it.id()] = position;
+
+        if (index >= index_) { index_ = index + 1; }
+    }
+
+    segment.loaded_ = true;
 }
 
 bool Thread::Read(const std::string& id, const bool unread)
 {
     Lock lock(write_lock_);
+    auto* segment = find(lock, id);
 
-    auto it = items_.find(id);
-
-    if (items_.end() == it) {
+    if (nullptr == segment) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Item does not exist.").Flush();
 
         return false;
     }
 
-    auto& item = it->second;
-
+    auto& item = segment->items_.at(id);
     item.set_unread(unread);
+    segment->dirty_ = true;
 
     return save(lock);
 }
@@ -209,14 +391,16 @@ bool Thread::Read(const std::string& id, const bool unread)
 bool Thread::Remove(const std::string& id)
 {
     Lock lock(write_lock_);
+    auto* segment = find(lock, id);
 
-    auto it = items_.find(id);
-
-    if (items_.end() == it) { return false; }
+    if (nullptr == segment) { return false; }
 
+    auto it = segment->items_.find(id);
     auto& item = it->second;
     StorageBox box = static_cast<StorageBox>(item.box());
-    items_.erase(it);
+    segment->items_.erase(it);
+    segment->dirty_ = true;
+    positions_.erase(id);
 
     switch (box) {
         case StorageBox::MAILINBOX: {
@@ -247,6 +431,11 @@ bool Thread::Rename(const std::string& newID)
         participants_.emplace(newID);
     }
 
+    // Every segment carries the id and participants
+    load_all(lock);
+
+    for (auto& segment : segments_) { segment.dirty_ = true; }
+
     return save(lock);
 }
 
@@ -254,14 +443,50 @@ bool Thread::save(const Lock& lock) const
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    auto serialized = serialize(lock);
+    prune(lock);
+
+    if (segments_.empty()) {
+        segments_.emplace_back(Node::BLANK_HASH, true);
+        segments_.back().dirty_ = true;
+    }
+
+    for (std::size_t i{0}; i < segments_.size(); ++i) {
+        auto& segment = segments_.at(i);
+
+        // A tail segment which never received an item has nothing stored yet
+        if ((false == segment.dirty_) && check_hash(segment.hash_)) {
+            continue;
+        }
+
+        auto serialized = serialize(lock, i, 1);
+
+        if (!proto::Validate(serialized, VERBOSE)) { return false; }
+
+        if (false == driver_.StoreProto(serialized, segment.hash_)) {
+            return false;
+        }
+
+        segment.dirty_ = false;
+    }
+
+    auto serialized = serialize_segments(lock);
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
     return driver_.StoreProto(serialized, root_);
 }
 
-proto::StorageThread Thread::serialize(const Lock& lock) const
+std::size_t Thread::Segments() const
+{
+    Lock lock(write_lock_);
+
+    return segments_.size();
+}
+
+proto::StorageThread Thread::serialize(
+    const Lock& lock,
+    const std::size_t first,
+    const std::size_t count) const
 {
     OT_ASSERT(verify_write_lock(lock));
 
@@ -273,7 +498,7 @@ proto::StorageThread Thread::serialize(const Lock& lock) const
         if (!nym.empty()) { *serialized.add_participant() = nym; }
     }
 
-    auto sorted = sort(lock);
+    auto sorted = sort(lock, first, count);
 
     for (const auto& it : sorted) {
         OT_ASSERT(nullptr != it.second);
@@ -285,6 +510,28 @@ proto::StorageThread Thread::serialize(const Lock& lock) const
     return serialized;
 }
 
+proto::StorageNymList Thread::serialize_segments(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    proto::StorageNymList serialized;
+    serialized.set_version(THREAD_INDEX_VERSION);
+
+    for (std::size_t i{0}; i < segments_.size(); ++i) {
+        const auto position = std::to_string(i);
+        // Entries need a well-formed item id, so one is derived from the
+        // thread id and the segment position
+        auto itemID = Identifier::Factory();
+        itemID->CalculateDigest(id_ + position);
+        auto& index = *serialized.add_nym();
+        set_hash(
+            THREAD_INDEX_VERSION, itemID->str(), segments_.at(i).hash_, index);
+        index.set_alias(position);
+    }
+
+    return serialized;
+}
+
 bool Thread::SetAlias(const std::string& alias)
 {
     Lock lock(write_lock_);
@@ -294,57 +541,87 @@ bool Thread::SetAlias(const std::string& alias)
     return true;
 }
 
-Thread::SortedItems Thread::sort(const Lock& lock) const
+Thread::SortedItems Thread::sort(
+    const Lock& lock,
+    const std::size_t first,
+    const std::size_t count) const
 {
     OT_ASSERT(verify_write_lock(lock));
 
     SortedItems output;
+    const auto last = std::min(segments_.size(), first + count);
+
+    for (auto i = first; i < last; ++i) {
+        load(lock, i);
 
-    for (const auto& it : items_) {
-        const auto& id = it.first;
-        const auto& item = it.second;
+        for (const auto& it : segments_.at(i).items_) {
+            const auto& id = it.first;
+            const auto& item = it.second;
 
-        if (!id.empty()) {
-            SortKey key{item.index(), item.time(), id};
-            output.emplace(key, &item);
+            if (!id.empty()) {
+                SortKey key{item.index(), item.time(), id};
+                output.emplace(key, &item);
+            }
         }
     }
 
     return output;
 }
 
+Thread::Segment& Thread::tail(const Lock& lock)
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    if (false == segments_.empty()) { load(lock, segments_.size() - 1); }
+
+    if (segments_.empty() ||
+        (THREAD_SEGMENT_SIZE <= segments_.back().items_.size())) {
+        segments_.emplace_back(Node::BLANK_HASH, true);
+    }
+
+    return segments_.back();
+}
+
 std::size_t Thread::UnreadCount() const
 {
     Lock lock(write_lock_);
     std::size_t output{0};
+    load_all(lock);
 
-    for (const auto& it : items_) {
-        const auto& item = it.second;
+    for (const auto& segment : segments_) {
+        for (const auto& it : segment.items_) {
+            const auto& item = it.second;
 
-        if (item.unread()) { ++output; }
+            if (item.unread()) { ++output; }
+        }
     }
 
     return output;
 }
 
+// Legacy threads are fully loaded at this point. Segmented threads were
+// already checked before they were converted.
 void Thread::upgrade(const Lock& lock)
 {
     OT_ASSERT(verify_write_lock(lock));
 
     bool changed{false};
 
-    for (auto& it : items_) {
-        auto& item = it.second;
-        const auto box = static_cast<StorageBox>(item.box());
-
-        switch (box) {
-            case StorageBox::MAILOUTBOX: {
-                if (item.unread()) {
-                    item.set_unread(false);
-                    changed = true;
+    for (auto& segment : segments_) {
+        for (auto& it : segment.items_) {
+            auto& item = it.second;
+            const auto box = static_cast<StorageBox>(item.box());
+
+            switch (box) {
+                case StorageBox::MAILOUTBOX: {
+                    if (item.unread()) {
+                        item.set_unread(false);
+                        segment.dirty_ = true;
+                        changed = true;
+                    }
+                } break;
+                default: {
                 }
-            } break;
-            default: {
             }
         }
     }
@@ -16,11 +16,21 @@
 #include <list>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace opentxs
 {
 namespace storage
 {
+/** Stores the items of an activity thread as a chain of fixed-size segments
+ *
+ *  Each segment is a proto::StorageThread holding the thread id, the
+ *  participants and a bounded number of items. The root object is a list of
+ *  segment hashes in append order, so appending an item rewrites only the
+ *  tail segment and the list. Segments are loaded on demand, and the segment
+ *  holding each loaded item is indexed so that a lookup reads each segment at
+ *  most once.
+ */
 class Thread final : public Node
 {
 private:
@@ -28,20 +38,48 @@ private:
     typedef std::tuple<std::size_t, std::int64_t, std::string> SortKey;
     typedef std::map<SortKey, const proto::StorageThreadItem*> SortedItems;
 
+    struct Segment {
+        std::string hash_;
+        bool loaded_;
+        bool dirty_;
+        std::map<std::string, proto::StorageThreadItem> items_;
+
+        Segment(const std::string& hash, const bool loaded);
+    };
+
     std::string id_;
     std::string alias_;
-    std::size_t index_;
+    mutable std::size_t index_;
     Mailbox& mail_inbox_;
     Mailbox& mail_outbox_;
-    std::map<std::string, proto::StorageThreadItem> items_;
+    mutable std::vector<Segment> segments_;
+    // Segment position of every item in a loaded segment
+    mutable std::map<std::string, std::size_t> positions_;
     // It's important to use a sorted container for this so the thread ID can be
     // calculated deterministically
     std::set<std::string> participants_;
 
+    Segment* find(const Lock& lock, const std::string& id) const;
     void init(const std::string& hash) final;
+    void init_legacy(const std::string& hash);
+    void load(const Lock& lock, const std::size_t segment) const;
+    void load_all(const Lock& lock) const;
+    void prune(const Lock& lock) const;
+    void read(
+        const Lock& lock,
+        const std::size_t position,
+        const proto::StorageThread& serialized) const;
     bool save(const Lock& lock) const final;
-    proto::StorageThread serialize(const Lock& lock) const;
-    SortedItems sort(const Lock& lock) const;
+    proto::StorageThread serialize(
+        const Lock& lock,
+        const std::size_t first,
+        const std::size_t count) const;
+    proto::StorageNymList serialize_segments(const Lock& lock) const;
+    SortedItems sort(
+        const Lock& lock,
+        const std::size_t first,
+        const std::size_t count) const;
+    Segment& tail(const Lock& lock);
     void upgrade(const Lock& lock);
 
     Thread(
@@ -68,7 +106,11 @@ public:
     bool Check(const std::string& id) const;
     std::string ID() const;
     proto::StorageThread Items() const;
+    /// Items from segments [first, first + count), loading only those segments
+    proto::StorageThread Items(const std::size_t first, const std::size_t count)
+        const;
     bool Migrate(const opentxs::api::storage::Driver& to) const final;
+    std::size_t Segments() const;
     std::size_t UnreadCount() const;
 
     bool Add(
@@ -196,7 +196,21 @@ const proto::StorageThreadItem& ActivitySummary::newest_item(
 void ActivitySummary::process_thread(const std::string& id) noexcept
 {
     const auto threadID = Identifier::Factory(id);
-    const auto thread = api_.Activity().Thread(primary_id_, threadID);
+    const auto& activity = api_.Activity();
+    auto segment = activity.ThreadSegments(primary_id_, threadID);
+    auto thread = std::shared_ptr<proto::StorageThread>{};
+
+    // Only the newest item is displayed, so read backwards from the tail
+    // segment instead of loading the entire thread
+    while (0 < segment) {
+        thread = activity.Thread(primary_id_, threadID, --segment, 1);
+
+        if (thread && (0 < thread->item_size())) { break; }
+    }
+
+    if (false == bool(thread)) {
+        thread = activity.Thread(primary_id_, threadID);
+    }
 
     OT_ASSERT(thread);
 
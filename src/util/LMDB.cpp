@@ -19,15 +19,29 @@ LMDB::LMDB(
     const TableNames& names,
     const std::string& folder,
     const TablesToInit init,
-    const Flags flags) noexcept
+    const Flags flags,
+    const GroupCommit group) noexcept
     : names_(names)
+    , group_(group)
     , env_(nullptr)
     , db_(init.size())
     , pending_()
     , lock_()
+    , group_lock_()
+    , group_cv_()
+    , group_pending_()
+    , group_bytes_(0)
+    , group_contended_(false)
+    , group_busy_(false)
+    , group_running_(0 < group_.window_.count())
+    , group_thread_()
 {
     init_environment(folder, init.size(), flags);
     init_tables(init);
+
+    if (group_running_) {
+        group_thread_ = std::thread{&LMDB::group_commit, this};
+    }
 }
 
 LMDB::Transaction::Transaction(MDB_env* env, const bool rw) noexcept(false)
@@ -141,6 +155,38 @@ auto LMDB::Commit() const noexcept -> bool
     return cleanup.success_;
 }
 
+auto LMDB::commit_group(Group& group) const noexcept -> bool
+{
+    MDB_txn* transaction{nullptr};
+
+    if (0 != ::mdb_txn_begin(env_, nullptr, 0, &transaction)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to start transaction")
+            .Flush();
+
+        return false;
+    }
+
+    OT_ASSERT(nullptr != transaction);
+
+    for (auto& write : group) {
+        const auto database = db_.at(write.table_);
+        auto key = MDB_val{write.key_.size(), write.key_.data()};
+        auto value = MDB_val{write.value_.size(), write.value_.data()};
+
+        if (0 != ::mdb_put(transaction, database, &key, &value, 0)) {
+            ::mdb_txn_abort(transaction);
+
+            return false;
+        }
+    }
+
+    if (0 != ::mdb_txn_commit(transaction)) { return false; }
+
+    for (auto& write : group) { write.promise_.set_value(true); }
+
+    return true;
+}
+
 auto LMDB::Delete(const Table table, MDB_txn* parent) const noexcept -> bool
 {
     struct Cleanup {
@@ -423,19 +469,65 @@ auto LMDB::init_tables(const TablesToInit init) noexcept -> void
     }
 }
 
+auto LMDB::group_commit() noexcept -> void
+{
+    auto lock = std::unique_lock<std::mutex>{group_lock_};
+
+    while (true) {
+        group_cv_.wait(lock, [this] {
+            return (false == group_running_) ||
+                   (false == group_pending_.empty());
+        });
+
+        if (group_pending_.empty()) { break; }
+
+        if (group_contended_) {
+            // Give concurrent writers a chance to join the group
+            group_cv_.wait_for(lock, group_.window_, [this] {
+                return (false == group_running_) ||
+                       (group_bytes_ >= group_.bytes_);
+            });
+        }
+
+        auto group = Group{};
+        group.swap(group_pending_);
+        group_bytes_ = 0;
+        group_contended_ = false;
+        group_busy_ = true;
+        lock.unlock();
+
+        if (false == commit_group(group)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Group commit failed, retrying writes individually")
+                .Flush();
+
+            // One bad write must not fail the writes it was grouped with
+            for (auto& write : group) {
+                write.promise_.set_value(
+                    Store(write.table_, write.key_, write.value_).first);
+            }
+        }
+
+        lock.lock();
+        group_busy_ = false;
+    }
+}
+
 auto LMDB::Load(
     const Table table,
     const ReadView index,
     const Callback cb,
-    const Mode multiple) const noexcept -> bool
+    const Mode multiple,
+    MDB_txn* parent) const noexcept -> bool
 {
     struct Cleanup {
         bool success_;
 
-        Cleanup(MDB_txn*& transaction, MDB_cursor*& cursor)
+        Cleanup(MDB_txn*& transaction, MDB_cursor*& cursor, const bool owned)
             : success_(false)
             , transaction_(transaction)
             , cursor_(cursor)
+            , owned_(owned)
         {
         }
 
@@ -446,7 +538,7 @@ auto LMDB::Load(
                 cursor_ = nullptr;
             }
 
-            if (nullptr != transaction_) {
+            if (owned_ && (nullptr != transaction_)) {
                 ::mdb_txn_abort(transaction_);
                 transaction_ = nullptr;
             }
@@ -455,13 +547,16 @@ auto LMDB::Load(
     private:
         MDB_txn*& transaction_;
         MDB_cursor*& cursor_;
+        const bool owned_;
     };
 
     OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
 
-    MDB_txn* transaction{nullptr};
+    const auto owned = (nullptr == parent);
+    MDB_txn* transaction{parent};
 
-    if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &transaction)) {
+    if (owned &&
+        (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &transaction))) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to start transaction")
             .Flush();
 
@@ -471,7 +566,7 @@ auto LMDB::Load(
     OT_ASSERT(nullptr != transaction);
 
     MDB_cursor* cursor{nullptr};
-    Cleanup cleanup(transaction, cursor);
+    Cleanup cleanup(transaction, cursor, owned);
     const auto database = db_.at(table);
 
     if (0 != ::mdb_cursor_open(transaction, database, &cursor)) {
@@ -514,13 +609,15 @@ auto LMDB::Load(
     const Table table,
     const std::size_t index,
     const Callback cb,
-    const Mode mode) const noexcept -> bool
+    const Mode mode,
+    MDB_txn* parent) const noexcept -> bool
 {
     return Load(
         table,
         ReadView{reinterpret_cast<const char*>(&index), sizeof(index)},
         cb,
-        mode);
+        mode,
+        parent);
 }
 
 auto LMDB::Queue(
@@ -632,6 +729,43 @@ auto LMDB::Read(const Table table, const ReadCallback cb, const Dir dir) const
     return cleanup.success_;
 }
 
+auto LMDB::Submit(
+    const Table table,
+    const ReadView key,
+    const ReadView value) const noexcept -> std::future<bool>
+{
+    auto promise = std::promise<bool>{};
+    auto output = promise.get_future();
+    Submit(table, key, value, std::move(promise));
+
+    return output;
+}
+
+auto LMDB::Submit(
+    const Table table,
+    const ReadView key,
+    const ReadView value,
+    std::promise<bool> promise) const noexcept -> void
+{
+    OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
+
+    auto lock = std::unique_lock<std::mutex>{group_lock_};
+
+    if (false == group_running_) {
+        lock.unlock();
+        promise.set_value(Store(table, key, value).first);
+
+        return;
+    }
+
+    group_contended_ |= group_busy_ || (false == group_pending_.empty());
+    group_bytes_ += key.size() + value.size();
+    group_pending_.emplace_back(
+        Write{table, std::string{key}, std::string{value}, std::move(promise)});
+    lock.unlock();
+    group_cv_.notify_all();
+}
+
 auto LMDB::Store(
     const Table table,
     const ReadView index,
@@ -815,6 +949,15 @@ auto LMDB::TransactionRW() const noexcept(false) -> Transaction
 
 LMDB::~LMDB()
 {
+    {
+        auto lock = std::unique_lock<std::mutex>{group_lock_};
+        group_running_ = false;
+    }
+
+    group_cv_.notify_all();
+
+    if (group_thread_.joinable()) { group_thread_.join(); }
+
     if (nullptr != env_) {
         ::mdb_env_close(env_);
         env_ = nullptr;
@@ -12,10 +12,14 @@
 #if OT_STORAGE_LMDB
 #include "lmdb.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <functional>
+#include <future>
 #include <map>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <tuple>
 #include <vector>
 
@@ -44,6 +48,16 @@ public:
     enum class Dir : bool { Forward = false, Backward = true };
     enum class Mode : bool { One = false, Multiple = true };
 
+    /// Writes passed to Submit are committed together in a single
+    /// transaction. A write submitted while no other write is queued or
+    /// being committed is committed immediately. Otherwise the group stays
+    /// open until window_ has passed or bytes_ have been queued. A zero
+    /// window disables grouping.
+    struct GroupCommit {
+        std::chrono::microseconds window_{0};
+        std::size_t bytes_{0};
+    };
+
     struct Transaction {
         bool success_;
 
@@ -80,16 +94,20 @@ public:
         const ReadView value,
         MDB_txn* parent = nullptr) const noexcept;
     bool Exists(const Table table, const ReadView key) const noexcept;
+    /// If parent is provided the views passed to cb remain valid until
+    /// parent is finalized, otherwise only until cb returns
     bool Load(
         const Table table,
         const ReadView key,
         const Callback cb,
-        const Mode mode = Mode::One) const noexcept;
+        const Mode mode = Mode::One,
+        MDB_txn* parent = nullptr) const noexcept;
     bool Load(
         const Table table,
         const std::size_t key,
         const Callback cb,
-        const Mode mode = Mode::One) const noexcept;
+        const Mode mode = Mode::One,
+        MDB_txn* parent = nullptr) const noexcept;
     bool Queue(
         const Table table,
         const ReadView key,
@@ -97,6 +115,16 @@ public:
         const Mode mode = Mode::One) const noexcept;
     bool Read(const Table table, const ReadCallback cb, const Dir dir) const
         noexcept;
+    /// The returned future becomes ready once the write is durable
+    std::future<bool> Submit(
+        const Table table,
+        const ReadView key,
+        const ReadView value) const noexcept;
+    void Submit(
+        const Table table,
+        const ReadView key,
+        const ReadView value,
+        std::promise<bool> promise) const noexcept;
     Result Store(
         const Table table,
         const ReadView key,
@@ -122,7 +150,8 @@ public:
         const TableNames& names,
         const std::string& folder,
         const TablesToInit init,
-        const Flags flags = 0)
+        const Flags flags = 0,
+        const GroupCommit group = {})
     noexcept;
     ~LMDB();
 
@@ -130,13 +159,34 @@ private:
     using NewKey = std::tuple<Table, Mode, std::string, std::string>;
     using Pending = std::vector<NewKey>;
 
+    struct Write {
+        Table table_;
+        std::string key_;
+        std::string value_;
+        std::promise<bool> promise_;
+    };
+
+    using Group = std::vector<Write>;
+
     const TableNames& names_;
+    const GroupCommit group_;
     mutable MDB_env* env_;
     mutable Databases db_;
     mutable Pending pending_;
     mutable std::mutex lock_;
-
+    mutable std::mutex group_lock_;
+    mutable std::condition_variable group_cv_;
+    mutable Group group_pending_;
+    mutable std::size_t group_bytes_;
+    // A write arrived while another was queued or being committed
+    mutable bool group_contended_;
+    bool group_busy_;
+    bool group_running_;
+    std::thread group_thread_;
+
+    bool commit_group(Group& group) const noexcept;
     MDB_dbi get_database(const Table table) const noexcept;
+    void group_commit() noexcept;
     MDB_dbi init_db(const Table table, const std::size_t flags) noexcept;
     void init_environment(
         const std::string& folder,
@@ -0,0 +1,82 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+// Roughly a small message, a receipt, and a busy ledger
+const std::vector<std::size_t> sizes_{2048, 32768, 1048576};
+const std::vector<std::int32_t> levels_{9, -1, 1, 0};
+constexpr auto iterations_ = std::size_t{20};
+
+class Test_ArmoredBenchmark : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& api_;
+    const std::int32_t original_level_;
+
+    static auto payload(const std::size_t size) -> std::string
+    {
+        auto output = std::string{};
+        std::size_t i{0};
+
+        while (output.size() < size) {
+            output += "<transaction type=\"pending\" transactionNum=\"" +
+                      std::to_string(i) + "\" inReferenceTo=\"" +
+                      std::to_string(i * 7) + "\" />\n";
+            ++i;
+        }
+
+        output.resize(size);
+
+        return output;
+    }
+
+    Test_ArmoredBenchmark()
+        : api_(ot::Context().StartClient(OTTestEnvironment::test_args_, 0))
+        , original_level_(ot::Armored::CompressionLevel())
+    {
+    }
+
+    ~Test_ArmoredBenchmark()
+    {
+        ot::Armored::SetCompressionLevel(original_level_);
+    }
+};
+
+TEST_F(Test_ArmoredBenchmark, round_trip)
+{
+    for (const auto size : sizes_) {
+        const auto input = ot::String::Factory(payload(size));
+
+        for (const auto level : levels_) {
+            ot::Armored::SetCompressionLevel(level);
+            auto armored = api_.Factory().Armored();
+            auto output = ot::String::Factory();
+            const auto start = std::chrono::steady_clock::now();
+
+            for (std::size_t i{0}; i < iterations_; ++i) {
+                ASSERT_TRUE(armored->SetString(input));
+                ASSERT_TRUE(armored->GetString(output));
+            }
+
+            const auto elapsed = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start);
+
+            EXPECT_STREQ(input->Get(), output->Get());
+
+            std::cout << "Level " << level << ", " << size << " bytes -> "
+                      << armored->GetLength() << " armored: "
+                      << static_cast<double>(iterations_ * size) /
+                             elapsed.count() / 1048576
+                      << " MiB/second" << std::endl;
+        }
+    }
+}
+}  // namespace
@@ -0,0 +1,90 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+// BIP158 basic filter parameters
+constexpr auto bits_ = std::uint32_t{19};
+constexpr auto fp_rate_ = std::uint32_t{784931};
+// Rough size of a recent mainnet block filter and of a busy wallet
+constexpr auto block_elements_ = std::size_t{2500};
+constexpr auto filter_count_ = std::size_t{100};
+constexpr auto wallet_elements_ = std::size_t{10000};
+
+class Test_FilterBenchmark : public ::testing::Test
+{
+public:
+    using Filter = std::unique_ptr<ot::blockchain::internal::GCS>;
+
+    const ot::api::client::internal::Manager& api_;
+
+    static auto element(const std::string& prefix, const std::size_t i)
+        -> ot::OTData
+    {
+        const auto value = prefix + std::to_string(i);
+
+        return ot::Data::Factory(value.data(), value.size());
+    }
+
+    Test_FilterBenchmark()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::test_args_, 0)))
+    {
+    }
+};
+
+TEST_F(Test_FilterBenchmark, match_wallet)
+{
+    auto filters = std::vector<Filter>{};
+    auto wallet = std::vector<ot::OTData>{};
+
+    for (std::size_t i{0}; i < wallet_elements_; ++i) {
+        wallet.emplace_back(element("wallet ", i));
+    }
+
+    for (std::size_t f{0}; f < filter_count_; ++f) {
+        auto elements = std::vector<ot::OTData>{};
+        auto key = std::array<std::byte, 16>{};
+        key[0] = static_cast<std::byte>(f);
+        key[1] = static_cast<std::byte>(f >> 8);
+
+        for (std::size_t i{0}; i < block_elements_; ++i) {
+            elements.emplace_back(
+                element("block " + std::to_string(f) + " ", i));
+        }
+
+        // Every tenth block pays the wallet
+        if (0 == (f % 10)) { elements.emplace_back(wallet.at(f)); }
+
+        filters.emplace_back(
+            ot::Factory::GCS(api_, bits_, fp_rate_, key, elements));
+
+        ASSERT_TRUE(filters.back());
+    }
+
+    auto matches = std::size_t{0};
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const auto& filter : filters) {
+        if (filter->Test(wallet)) { ++matches; }
+    }
+
+    const auto elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start);
+
+    EXPECT_GE(matches, filter_count_ / 10);
+
+    std::cout << "Matched " << filters.size() << " filters of "
+              << block_elements_ << " elements against " << wallet.size()
+              << " wallet elements: "
+              << static_cast<double>(filters.size()) / elapsed.count()
+              << " filters/second" << std::endl;
+}
+}  // namespace
@@ -120,6 +120,165 @@ TEST_F(Test_Filters, gcs)
     EXPECT_FALSE(gcs.Test(excludedElements));
 }
 
+TEST_F(Test_Filters, golomb_decoder)
+{
+    const std::uint32_t bits{19};
+    const std::vector<std::uint64_t> values{
+        0, 1, 524287, 524288, 19, 3491, 15000, 1073027, 28998, 67108863};
+    auto data = ot::Data::Factory();
+    ot::blockchain::internal::BitWriter stream(data);
+
+    for (const auto& value : values) {
+        auto quotient = value >> bits;
+
+        while (quotient > 0) {
+            stream.write(1, 1);
+            --quotient;
+        }
+
+        stream.write(1, 0);
+        stream.write(bits, value & ((std::uint64_t{1} << bits) - 1));
+    }
+
+    stream.flush();
+
+    ot::blockchain::internal::GolombDecoder decoder(bits, data->Bytes());
+
+    for (const auto& value : values) { EXPECT_EQ(decoder.next(), value); }
+}
+
+TEST_F(Test_Filters, gcs_batch)
+{
+    std::vector<ot::OTData> included{};
+    std::vector<ot::OTData> excluded{};
+    std::array<std::byte, 16> key{};
+
+    for (std::size_t ii = 0; ii < 16; ii++) {
+        key[ii] = static_cast<std::byte>(ii);
+    }
+
+    for (std::uint32_t i{0}; i < 500; ++i) {
+        const auto in = "included " + std::to_string(i);
+        const auto out = "excluded " + std::to_string(i);
+        included.emplace_back(ot::Data::Factory(in.data(), in.size()));
+        excluded.emplace_back(ot::Data::Factory(out.data(), out.size()));
+    }
+
+    std::unique_ptr<ot::blockchain::internal::GCS> pGcs{
+        ot::Factory::GCS(api_, 19, 784931, key, included)};
+
+    ASSERT_TRUE(pGcs);
+
+    const auto& gcs = *pGcs;
+
+    for (const auto& element : included) {
+        EXPECT_TRUE(gcs.Test(element));
+
+        auto targets = excluded;
+        targets.emplace_back(element);
+
+        EXPECT_TRUE(gcs.Test(targets));
+    }
+
+    EXPECT_FALSE(gcs.Test(excluded));
+    EXPECT_FALSE(gcs.Test(std::vector<ot::OTData>{}));
+}
+
+TEST_F(Test_Filters, gcs_view)
+{
+    std::vector<ot::OTData> included{};
+    std::vector<ot::OTData> excluded{};
+    std::array<std::byte, 16> key{};
+
+    for (std::size_t ii = 0; ii < 16; ii++) {
+        key[ii] = static_cast<std::byte>(ii);
+    }
+
+    for (std::uint32_t i{0}; i < 100; ++i) {
+        const auto in = "included " + std::to_string(i);
+        const auto out = "excluded " + std::to_string(i);
+        included.emplace_back(ot::Data::Factory(in.data(), in.size()));
+        excluded.emplace_back(ot::Data::Factory(out.data(), out.size()));
+    }
+
+    std::unique_ptr<ot::blockchain::internal::GCS> pGcs{
+        ot::Factory::GCS(api_, 19, 784931, key, included)};
+
+    ASSERT_TRUE(pGcs);
+
+    const auto proto = pGcs->Serialize();
+    const auto serialized = proto.SerializeAsString();
+    const auto view = ot::blockchain::internal::GCSView{
+        ot::ReadView{serialized.data(), serialized.size()}};
+
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view.Bits(), 19);
+    EXPECT_EQ(view.FPRate(), 784931);
+    EXPECT_EQ(view.Count(), included.size());
+    EXPECT_EQ(view.Key().size(), key.size());
+    EXPECT_EQ(view.Filter(), ot::ReadView{proto.filter()});
+    // The view must refer to the serialized bytes rather than a copy
+    EXPECT_GE(view.Filter().data(), serialized.data());
+    EXPECT_LE(
+        view.Filter().data() + view.Filter().size(),
+        serialized.data() + serialized.size());
+
+    for (const auto& element : included) {
+        auto targets = excluded;
+        targets.emplace_back(element);
+
+        EXPECT_TRUE(view.Test(targets));
+    }
+
+    EXPECT_FALSE(view.Test(excluded));
+
+    const auto truncated = ot::blockchain::internal::GCSView{
+        ot::ReadView{serialized.data(), serialized.size() - 1}};
+
+    EXPECT_FALSE(truncated);
+    EXPECT_FALSE(ot::blockchain::internal::GCSView{ot::ReadView{}});
+}
+
+TEST_F(Test_Filters, siphash)
+{
+    std::array<std::byte, 16> key{};
+
+    for (std::size_t ii = 0; ii < 16; ii++) {
+        key[ii] = static_cast<std::byte>(ii * 7);
+    }
+
+    auto password = api_.Factory().BinarySecret();
+
+    ASSERT_TRUE(password);
+
+    password->setMemory(key.data(), static_cast<std::uint32_t>(key.size()));
+    const ot::blockchain::internal::SipHasher hasher(
+        {reinterpret_cast<const char*>(key.data()), key.size()});
+    std::vector<ot::OTData> elements{};
+
+    for (std::uint32_t i{0}; i < 67; ++i) {
+        auto element = ot::Data::Factory();
+
+        for (std::uint32_t j{0}; j < i; ++j) {
+            element += static_cast<std::uint8_t>(i * j);
+        }
+
+        elements.emplace_back(std::move(element));
+    }
+
+    std::vector<std::uint64_t> batch(elements.size());
+    hasher(elements, batch.data());
+
+    for (std::size_t i{0}; i < elements.size(); ++i) {
+        std::uint64_t expected{};
+
+        ASSERT_TRUE(api_.Crypto().Hash().SipHash(
+            *password, elements.at(i), expected, 2, 4));
+        EXPECT_EQ(hasher(elements.at(i)->Bytes()), expected);
+        EXPECT_EQ(batch.at(i), expected);
+    }
+}
+
 TEST_F(Test_Filters, bip158_headers)
 {
     namespace bc = ot::blockchain::internal;
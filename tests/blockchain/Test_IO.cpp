@@ -0,0 +1,146 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "internal/api/client/Client.hpp"
+#include "internal/blockchain/client/Client.hpp"
+
+#include <boost/asio.hpp>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using IO = ot::blockchain::client::internal::IO;
+using Socket = IO::tcp::socket;
+
+class Test_IO : public ::testing::Test
+{
+public:
+    const ot::api::client::internal::Manager& api_;
+    const IO& io_;
+    const std::vector<IO::ThreadLoad> baseline_;
+
+    auto peers() const -> std::vector<std::size_t>
+    {
+        auto output = std::vector<std::size_t>{};
+
+        for (const auto& load : io_.Load()) {
+            output.emplace_back(load.peers_);
+        }
+
+        return output;
+    }
+
+    auto attach(const std::size_t count) const
+        -> std::vector<std::unique_ptr<Socket>>
+    {
+        auto output = std::vector<std::unique_ptr<Socket>>{};
+
+        for (std::size_t i{0}; i < count; ++i) {
+            output.emplace_back(std::make_unique<Socket>(io_.Attach()));
+        }
+
+        return output;
+    }
+
+    auto detach(std::vector<std::unique_ptr<Socket>>& sockets) const -> void
+    {
+        for (auto& socket : sockets) { io_.Detach(*socket); }
+
+        sockets.clear();
+    }
+
+    Test_IO()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::test_args_, 0)))
+        , io_(dynamic_cast<const ot::api::client::internal::Blockchain&>(
+                  api_.Blockchain())
+                  .IO())
+        , baseline_(io_.Load())
+    {
+    }
+};
+
+TEST_F(Test_IO, attach_and_detach_balance_threads)
+{
+    const auto threads = baseline_.size();
+
+    ASSERT_LT(0, threads);
+
+    for (const auto& load : baseline_) { ASSERT_EQ(load.peers_, 0); }
+
+    auto sockets = attach(2 * threads);
+
+    for (const auto count : peers()) { EXPECT_EQ(count, 2); }
+
+    // Detaching one socket makes its thread the next one selected
+    io_.Detach(*sockets.back());
+    sockets.pop_back();
+    sockets.emplace_back(std::make_unique<Socket>(io_.Attach()));
+
+    for (const auto count : peers()) { EXPECT_EQ(count, 2); }
+
+    detach(sockets);
+
+    for (const auto count : peers()) { EXPECT_EQ(count, 0); }
+}
+
+TEST_F(Test_IO, sockets_run_on_their_own_thread)
+{
+    const auto threads = baseline_.size();
+    auto sockets = attach(threads);
+    auto ids = std::set<std::thread::id>{};
+
+    for (auto& socket : sockets) {
+        auto promise = std::make_shared<std::promise<std::thread::id>>();
+        auto future = promise->get_future();
+        boost::asio::post(socket->get_executor(), [promise] {
+            promise->set_value(std::this_thread::get_id());
+        });
+
+        ASSERT_EQ(
+            future.wait_for(std::chrono::seconds(10)),
+            std::future_status::ready);
+
+        ids.emplace(future.get());
+    }
+
+    // Every thread received exactly one socket, and none of them is the
+    // thread which attached it
+    EXPECT_EQ(ids.size(), threads);
+    EXPECT_EQ(ids.count(std::this_thread::get_id()), 0);
+
+    detach(sockets);
+}
+
+TEST_F(Test_IO, load_counts_only_attached_peers)
+{
+    auto sockets = attach(1);
+    auto load = io_.Load();
+
+    ASSERT_EQ(load.size(), baseline_.size());
+
+    auto total = std::size_t{0};
+
+    for (std::size_t i{0}; i < load.size(); ++i) {
+        total += load.at(i).peers_;
+
+        // No data was received, so the traffic counters did not move
+        EXPECT_EQ(load.at(i).messages_, baseline_.at(i).messages_);
+        EXPECT_EQ(load.at(i).bytes_, baseline_.at(i).bytes_);
+    }
+
+    EXPECT_EQ(total, 1);
+
+    detach(sockets);
+}
+}  // namespace
@@ -0,0 +1,382 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "blockchain/client/Rescan.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <mutex>
+
+namespace
+{
+using Matches = ot::blockchain::client::internal::FilterOracle::Matches;
+using Rescan = ot::blockchain::client::implementation::Rescan;
+
+constexpr auto type_{ot::filter::Type::Basic_BIP158};
+
+auto element(const std::string& value) -> ot::OTData
+{
+    return ot::Data::Factory(value.data(), value.size());
+}
+
+auto block_hash(const ot::blockchain::block::Height height) -> ot::OTData
+{
+    return element("block " + std::to_string(height));
+}
+
+class FakeHeaders final : public ot::blockchain::client::HeaderOracle
+{
+public:
+    std::atomic<ot::blockchain::block::Height> tip_{0};
+
+    ot::blockchain::block::Position BestChain() const noexcept final
+    {
+        return {tip_, block_hash(tip_)};
+    }
+    ot::blockchain::block::pHash BestHash(
+        const ot::blockchain::block::Height height) const noexcept final
+    {
+        if ((0 > height) || (height > tip_)) { return ot::Data::Factory(); }
+
+        return block_hash(height);
+    }
+    std::pair<ot::blockchain::block::Position, ot::blockchain::block::Position>
+    CommonParent(const ot::blockchain::block::Position& input) const
+        noexcept final
+    {
+        return {input, BestChain()};
+    }
+    ot::blockchain::block::Position GetCheckpoint() const noexcept final
+    {
+        return {-1, ot::Data::Factory()};
+    }
+    bool IsInBestChain(const ot::blockchain::block::Hash&) const
+        noexcept final
+    {
+        return true;
+    }
+    std::unique_ptr<ot::blockchain::block::Header> LoadHeader(
+        const ot::blockchain::block::Hash&) const noexcept final
+    {
+        return {};
+    }
+    std::vector<ot::blockchain::block::pHash> RecentHashes() const
+        noexcept final
+    {
+        return {};
+    }
+    std::set<ot::blockchain::block::pHash> Siblings() const noexcept final
+    {
+        return {};
+    }
+    bool AddCheckpoint(
+        const ot::blockchain::block::Height,
+        const ot::blockchain::block::Hash&) noexcept final
+    {
+        return false;
+    }
+    bool AddHeader(
+        std::unique_ptr<ot::blockchain::block::Header>) noexcept final
+    {
+        return false;
+    }
+    bool AddHeaders(
+        std::vector<std::unique_ptr<ot::blockchain::block::Header>>&) noexcept
+        final
+    {
+        return false;
+    }
+    bool DeleteCheckpoint() noexcept final { return false; }
+};
+
+class FakeDatabase final
+    : public ot::blockchain::client::internal::FilterDatabase
+{
+public:
+    // Filters are added before the tip is raised, so the scan never reads
+    // the map while it is being modified
+    std::atomic<ot::blockchain::block::Height> tip_{0};
+    std::map<std::string, std::string> filters_{};
+    mutable std::mutex lock_{};
+    mutable std::map<std::string, ot::blockchain::block::Position> rescan_{};
+
+    ot::blockchain::block::Position FilterHeaderTip(
+        const ot::filter::Type) const noexcept final
+    {
+        return {tip_, block_hash(tip_)};
+    }
+    ot::blockchain::block::Position FilterTip(const ot::filter::Type) const
+        noexcept final
+    {
+        return {tip_, block_hash(tip_)};
+    }
+    bool HaveFilter(
+        const ot::filter::Type,
+        const ot::blockchain::block::Hash& block) const noexcept final
+    {
+        return 0 < filters_.count(std::string{block.Bytes()});
+    }
+    bool HaveFilterHeader(
+        const ot::filter::Type,
+        const ot::blockchain::block::Hash&) const noexcept final
+    {
+        return true;
+    }
+    Hash LoadFilterHash(const ot::filter::Type, const ot::ReadView) const
+        noexcept final
+    {
+        return ot::Data::Factory();
+    }
+    Hash LoadFilterHeader(const ot::filter::Type, const ot::ReadView) const
+        noexcept final
+    {
+        return ot::Data::Factory();
+    }
+    bool ReadFilters(
+        const ot::filter::Type,
+        const std::vector<ot::ReadView>& blocks,
+        const FilterVisitor& cb) const noexcept final
+    {
+        for (std::size_t i{0}; i < blocks.size(); ++i) {
+            const auto it = filters_.find(std::string{blocks.at(i)});
+            const auto view = ot::blockchain::internal::GCSView{
+                (filters_.end() == it) ? ot::ReadView{}
+                                       : ot::ReadView{it->second}};
+
+            if (false == cb(i, view)) { break; }
+        }
+
+        return true;
+    }
+    ot::blockchain::block::Position RescanTip(
+        const ot::filter::Type,
+        const ot::Identifier& key) const noexcept final
+    {
+        ot::Lock lock(lock_);
+        const auto it = rescan_.find(key.str());
+
+        if (rescan_.end() == it) { return {-1, ot::Data::Factory()}; }
+
+        return it->second;
+    }
+    bool SetFilterHeaderTip(
+        const ot::filter::Type,
+        const ot::blockchain::block::Position) const noexcept final
+    {
+        return true;
+    }
+    bool SetFilterTip(
+        const ot::filter::Type,
+        const ot::blockchain::block::Position) const noexcept final
+    {
+        return true;
+    }
+    bool SetRescanTip(
+        const ot::filter::Type,
+        const ot::Identifier& key,
+        const ot::blockchain::block::Position position) const noexcept final
+    {
+        ot::Lock lock(lock_);
+        rescan_.erase(key.str());
+        rescan_.emplace(key.str(), position);
+
+        return true;
+    }
+    bool StoreFilters(const ot::filter::Type, std::vector<Filter>) const
+        noexcept final
+    {
+        return false;
+    }
+    bool StoreFilterHeaders(
+        const ot::filter::Type,
+        const ot::ReadView,
+        const std::vector<Header>) const noexcept final
+    {
+        return false;
+    }
+};
+
+class Test_Rescan : public ::testing::Test
+{
+public:
+    const ot::api::client::internal::Manager& api_;
+    FakeHeaders headers_;
+    FakeDatabase database_;
+    const ot::OTIdentifier first_account_;
+    const ot::OTIdentifier second_account_;
+
+    // Adds blocks up to height, each with a filter containing the elements
+    // listed for it or a filler element otherwise
+    auto extend(
+        const ot::blockchain::block::Height height,
+        const std::map<ot::blockchain::block::Height, std::string>& contents)
+        -> void
+    {
+        const auto key = std::array<std::byte, 16>{};
+
+        for (auto i{database_.tip_ + 1}; i <= height; ++i) {
+            const auto it = contents.find(i);
+            const auto value = (contents.end() == it)
+                                   ? std::string{"filler"} + std::to_string(i)
+                                   : it->second;
+            const auto filter = std::unique_ptr<ot::blockchain::internal::GCS>{
+                ot::Factory::GCS(api_, 19, 784931, key, {element(value)})};
+
+            ASSERT_TRUE(filter);
+
+            database_.filters_.emplace(
+                std::string{block_hash(i)->Bytes()},
+                filter->Serialize().SerializeAsString());
+        }
+
+        headers_.tip_ = height;
+        database_.tip_ = height;
+    }
+
+    static auto heights(const Matches& matches)
+        -> std::vector<ot::blockchain::block::Height>
+    {
+        auto output = std::vector<ot::blockchain::block::Height>{};
+
+        for (const auto& [height, hash] : matches) {
+            output.emplace_back(height);
+        }
+
+        return output;
+    }
+
+    Test_Rescan()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::test_args_, 0)))
+        , headers_()
+        , database_()
+        , first_account_(ot::Identifier::Random())
+        , second_account_(ot::Identifier::Random())
+    {
+    }
+};
+
+TEST_F(Test_Rescan, match_path)
+{
+    extend(10, {{3, "wallet"}, {7, "wallet"}});
+    auto rescan = Rescan{api_, database_, headers_, 2, 2};
+    auto found = std::vector<ot::blockchain::block::Height>{};
+    const auto position = rescan.Run(
+        type_, first_account_, {element("wallet")}, [&](const auto& matches) {
+            const auto batch = heights(matches);
+            found.insert(found.end(), batch.begin(), batch.end());
+        });
+
+    EXPECT_EQ(position.first, 10);
+    EXPECT_EQ(database_.RescanTip(type_, first_account_).first, 10);
+    ASSERT_EQ(found.size(), 2);
+    EXPECT_EQ(found.at(0), 3);
+    EXPECT_EQ(found.at(1), 7);
+}
+
+TEST_F(Test_Rescan, resume_after_new_filters)
+{
+    extend(4, {{2, "wallet"}});
+    auto rescan = Rescan{api_, database_, headers_, 2, 2};
+    auto found = std::vector<ot::blockchain::block::Height>{};
+    const auto cb = [&](const auto& matches) {
+        const auto batch = heights(matches);
+        found.insert(found.end(), batch.begin(), batch.end());
+    };
+
+    EXPECT_EQ(
+        rescan.Run(type_, first_account_, {element("wallet")}, cb).first, 4);
+
+    extend(8, {{6, "wallet"}});
+
+    EXPECT_EQ(
+        rescan.Run(type_, first_account_, {element("wallet")}, cb).first, 8);
+    ASSERT_EQ(found.size(), 2);
+    EXPECT_EQ(found.at(0), 2);
+    EXPECT_EQ(found.at(1), 6);
+}
+
+TEST_F(Test_Rescan, import_after_completed_rescan)
+{
+    extend(10, {{5, "imported"}});
+    auto rescan = Rescan{api_, database_, headers_, 2, 3};
+    auto first = std::vector<ot::blockchain::block::Height>{};
+    auto second = std::vector<ot::blockchain::block::Height>{};
+
+    EXPECT_EQ(
+        rescan
+            .Run(
+                type_,
+                first_account_,
+                {element("wallet")},
+                [&](const auto& matches) { first = heights(matches); })
+            .first,
+        10);
+    EXPECT_TRUE(first.empty());
+
+    // A subaccount imported later starts from its own position
+    EXPECT_EQ(database_.RescanTip(type_, second_account_).first, -1);
+    EXPECT_EQ(
+        rescan
+            .Run(
+                type_,
+                second_account_,
+                {element("imported")},
+                [&](const auto& matches) { second = heights(matches); })
+            .first,
+        10);
+    ASSERT_EQ(second.size(), 1);
+    EXPECT_EQ(second.at(0), 5);
+}
+
+TEST_F(Test_Rescan, schedule)
+{
+    extend(6, {{4, "wallet"}});
+    auto rescan = Rescan{api_, database_, headers_, 2, 2};
+    auto lock = std::mutex{};
+    auto found = std::vector<ot::blockchain::block::Height>{};
+    auto first = std::promise<void>{};
+    auto second = std::promise<void>{};
+    auto first_ready = first.get_future();
+    auto second_ready = second.get_future();
+    rescan.Schedule(
+        type_, first_account_, {element("wallet")}, [&](const auto& matches) {
+            ot::Lock guard(lock);
+
+            for (const auto height : heights(matches)) {
+                found.emplace_back(height);
+
+                if (4 == height) { first.set_value(); }
+                if (9 == height) { second.set_value(); }
+            }
+        });
+
+    ASSERT_EQ(
+        first_ready.wait_for(std::chrono::seconds(10)),
+        std::future_status::ready);
+
+    // Wait for the first pass to save its position before adding blocks
+    while (6 != database_.RescanTip(type_, first_account_).first) {
+        ot::Sleep(std::chrono::milliseconds(10));
+    }
+
+    extend(10, {{9, "wallet"}});
+    rescan.Update();
+
+    ASSERT_EQ(
+        second_ready.wait_for(std::chrono::seconds(10)),
+        std::future_status::ready);
+
+    ot::Lock guard(lock);
+
+    ASSERT_EQ(found.size(), 2);
+    EXPECT_EQ(found.at(0), 4);
+    EXPECT_EQ(found.at(1), 9);
+}
+}  // namespace
@@ -0,0 +1,204 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTLowLevelTestEnvironment.hpp"
+
+#include "blockchain/p2p/SendQueue.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Queue = ot::blockchain::p2p::implementation::SendQueue;
+
+class Test_SendQueue : public ::testing::Test
+{
+public:
+    static auto message(const std::size_t size) -> ot::OTData
+    {
+        return ot::Data::Factory(std::vector<std::byte>(size));
+    }
+
+    static auto push(Queue& queue, const std::size_t size, const int promise)
+        -> bool
+    {
+        auto start{false};
+
+        return queue.Push(message(size), promise, start);
+    }
+
+    static auto promises(const Queue::Batch& batch) -> std::vector<int>
+    {
+        auto output = std::vector<int>{};
+
+        for (const auto& [data, promise] : batch) {
+            output.emplace_back(promise);
+        }
+
+        return output;
+    }
+};
+
+TEST_F(Test_SendQueue, batch_is_capped_by_message_count)
+{
+    auto queue = Queue{1024, 3, 1024};
+
+    for (auto i{0}; i < 7; ++i) { ASSERT_TRUE(push(queue, 1, i)); }
+
+    auto batch = Queue::Batch{};
+
+    ASSERT_TRUE(queue.Next(batch));
+    EXPECT_EQ(promises(batch), std::vector<int>({0, 1, 2}));
+
+    batch.clear();
+
+    ASSERT_TRUE(queue.Next(batch));
+    EXPECT_EQ(promises(batch), std::vector<int>({3, 4, 5}));
+
+    batch.clear();
+
+    ASSERT_TRUE(queue.Next(batch));
+    EXPECT_EQ(promises(batch), std::vector<int>({6}));
+
+    batch.clear();
+
+    EXPECT_FALSE(queue.Next(batch));
+}
+
+TEST_F(Test_SendQueue, batch_is_capped_by_bytes)
+{
+    auto queue = Queue{10, 64, 1024};
+
+    ASSERT_TRUE(push(queue, 4, 0));
+    ASSERT_TRUE(push(queue, 4, 1));
+    ASSERT_TRUE(push(queue, 4, 2));
+    ASSERT_TRUE(push(queue, 6, 3));
+
+    auto batch = Queue::Batch{};
+
+    ASSERT_TRUE(queue.Next(batch));
+    EXPECT_EQ(promises(batch), std::vector<int>({0, 1}));
+
+    batch.clear();
+
+    ASSERT_TRUE(queue.Next(batch));
+    EXPECT_EQ(promises(batch), std::vector<int>({2, 3}));
+}
+
+TEST_F(Test_SendQueue, oversized_message_is_sent_alone)
+{
+    auto queue = Queue{10, 64, 16};
+
+    // An empty queue accepts a message larger than both limits
+    ASSERT_TRUE(push(queue, 32, 0));
+    ASSERT_TRUE(push(queue, 1, 1));
+
+    auto batch = Queue::Batch{};
+
+    ASSERT_TRUE(queue.Next(batch));
+    ASSERT_EQ(promises(batch), std::vector<int>({0}));
+    EXPECT_EQ(batch.front().first->size(), 32);
+
+    batch.clear();
+
+    ASSERT_TRUE(queue.Next(batch));
+    EXPECT_EQ(promises(batch), std::vector<int>({1}));
+}
+
+TEST_F(Test_SendQueue, push_beyond_queue_limit_is_refused)
+{
+    auto queue = Queue{1024, 64, 10};
+
+    EXPECT_TRUE(push(queue, 6, 0));
+    EXPECT_TRUE(push(queue, 4, 1));
+    EXPECT_FALSE(push(queue, 1, 2));
+
+    // Taking a batch makes room for more messages
+    auto batch = Queue::Batch{};
+
+    ASSERT_TRUE(queue.Next(batch));
+    EXPECT_EQ(promises(batch), std::vector<int>({0, 1}));
+    EXPECT_TRUE(push(queue, 10, 3));
+}
+
+TEST_F(Test_SendQueue, only_first_push_while_idle_starts_writer)
+{
+    auto queue = Queue{1024, 64, 1024};
+    auto start{false};
+
+    ASSERT_TRUE(queue.Push(message(1), 0, start));
+    EXPECT_TRUE(start);
+    ASSERT_TRUE(queue.Push(message(1), 1, start));
+    EXPECT_FALSE(start);
+
+    auto batch = Queue::Batch{};
+
+    ASSERT_TRUE(queue.Next(batch));
+
+    // The writer is still running until it finds the queue empty
+    ASSERT_TRUE(queue.Push(message(1), 2, start));
+    EXPECT_FALSE(start);
+
+    batch.clear();
+
+    ASSERT_TRUE(queue.Next(batch));
+
+    batch.clear();
+
+    EXPECT_FALSE(queue.Next(batch));
+    EXPECT_TRUE(batch.empty());
+    ASSERT_TRUE(queue.Push(message(1), 3, start));
+    EXPECT_TRUE(start);
+}
+
+TEST_F(Test_SendQueue, stop_refuses_and_discards_messages)
+{
+    auto queue = Queue{1024, 64, 1024};
+
+    ASSERT_TRUE(push(queue, 1, 0));
+
+    queue.Stop();
+
+    EXPECT_FALSE(push(queue, 1, 1));
+
+    auto batch = Queue::Batch{};
+
+    EXPECT_FALSE(queue.Next(batch));
+    EXPECT_TRUE(batch.empty());
+}
+
+TEST_F(Test_SendQueue, wait_returns_once_idle)
+{
+    auto queue = Queue{1024, 64, 1024};
+
+    // Nothing was ever queued
+    queue.Wait();
+
+    ASSERT_TRUE(push(queue, 1, 0));
+
+    auto waiter = std::async(std::launch::async, [&] { queue.Wait(); });
+
+    EXPECT_EQ(
+        waiter.wait_for(std::chrono::milliseconds(100)),
+        std::future_status::timeout);
+
+    auto batch = Queue::Batch{};
+
+    ASSERT_TRUE(queue.Next(batch));
+    EXPECT_EQ(
+        waiter.wait_for(std::chrono::milliseconds(100)),
+        std::future_status::timeout);
+
+    batch.clear();
+
+    EXPECT_FALSE(queue.Next(batch));
+    EXPECT_EQ(
+        waiter.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+}
+}  // namespace
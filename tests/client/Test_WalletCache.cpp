@@ -0,0 +1,225 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "api/Cache.hpp"
+#include "Exclusive.tpp"
+
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+
+namespace opentxs
+{
+template class Exclusive<int>;
+}  // namespace opentxs
+
+namespace
+{
+using Row = std::shared_ptr<int>;
+
+struct Policy {
+    static std::size_t shard_hash(const std::string& key) noexcept
+    {
+        return std::hash<std::string>{}(key);
+    }
+    static bool evictable(const Row& row) noexcept
+    {
+        return 1 >= row.use_count();
+    }
+};
+
+using Cache = ot::api::implementation::Cache<std::string, Row, Policy>;
+
+class Test_WalletCache : public ::testing::Test
+{
+public:
+    std::unique_ptr<Cache> cache_;
+
+    // All keys share one shard, so the eviction order is predictable
+    auto single(const std::size_t bound) -> Cache::Shard&
+    {
+        cache_ = std::make_unique<Cache>(1, bound);
+
+        return *cache_->shards().at(0);
+    }
+
+    static auto add(Cache::Shard& shard, const std::string& key) -> void
+    {
+        ot::Lock lock(shard.lock_);
+        shard[key] = std::make_shared<int>(0);
+    }
+
+    static auto contains(Cache::Shard& shard, const std::string& key) -> bool
+    {
+        ot::Lock lock(shard.lock_);
+
+        return nullptr != shard.find(key);
+    }
+
+    static auto count(Cache::Shard& shard) -> std::size_t
+    {
+        ot::Lock lock(shard.lock_);
+        auto output = std::size_t{0};
+        shard.for_each([&](const auto&, const auto&) { ++output; });
+
+        return output;
+    }
+
+    // Records whether the mutex was free by the time the pin was released
+    static auto pin(std::shared_mutex& mutex, bool& unlocked)
+        -> std::shared_ptr<void>
+    {
+        static auto dummy = int{0};
+
+        return {&dummy, [&mutex, &unlocked](int*) {
+                    unlocked = mutex.try_lock();
+
+                    if (unlocked) { mutex.unlock(); }
+                }};
+    }
+
+    Test_WalletCache()
+        : cache_()
+    {
+    }
+};
+
+TEST_F(Test_WalletCache, least_recently_used_row_is_evicted)
+{
+    auto& shard = single(2);
+    add(shard, "first");
+    add(shard, "second");
+
+    EXPECT_TRUE(contains(shard, "first"));
+
+    add(shard, "third");
+
+    EXPECT_EQ(count(shard), 2);
+    EXPECT_TRUE(contains(shard, "first"));
+    EXPECT_FALSE(contains(shard, "second"));
+    EXPECT_TRUE(contains(shard, "third"));
+}
+
+TEST_F(Test_WalletCache, pinned_row_survives)
+{
+    auto& shard = single(1);
+    add(shard, "first");
+    auto pin = std::shared_ptr<void>{};
+
+    {
+        ot::Lock lock(shard.lock_);
+        pin = shard.pin("first");
+    }
+
+    // Copies of a pin keep the row pinned until the last one is gone
+    auto copy = pin;
+    pin.reset();
+    add(shard, "second");
+
+    EXPECT_EQ(count(shard), 2);
+    EXPECT_TRUE(contains(shard, "first"));
+
+    copy.reset();
+    add(shard, "third");
+
+    EXPECT_EQ(count(shard), 1);
+    EXPECT_TRUE(contains(shard, "third"));
+}
+
+TEST_F(Test_WalletCache, referenced_row_survives)
+{
+    auto& shard = single(1);
+    add(shard, "first");
+    auto reference = Row{};
+
+    {
+        ot::Lock lock(shard.lock_);
+        reference = *shard.find("first");
+    }
+
+    add(shard, "second");
+
+    EXPECT_TRUE(contains(shard, "first"));
+
+    reference.reset();
+    add(shard, "third");
+
+    EXPECT_EQ(count(shard), 1);
+    EXPECT_TRUE(contains(shard, "third"));
+}
+
+TEST_F(Test_WalletCache, capacity_is_bounded)
+{
+    constexpr auto shards = std::size_t{4};
+    constexpr auto bound = std::size_t{10};
+    cache_ = std::make_unique<Cache>(shards, bound);
+
+    for (auto i{0}; i < 100; ++i) {
+        const auto key = std::to_string(i);
+        add(cache_->shard(key), key);
+    }
+
+    auto total = std::size_t{0};
+
+    for (const auto& shard : cache_->shards()) {
+        const auto rows = count(*shard);
+
+        EXPECT_LE(rows, (bound + shards - 1) / shards);
+
+        total += rows;
+    }
+
+    EXPECT_GE(total, bound);
+}
+
+TEST_F(Test_WalletCache, zero_bound_never_evicts)
+{
+    auto& shard = single(0);
+
+    for (auto i{0}; i < 100; ++i) { add(shard, std::to_string(i)); }
+
+    EXPECT_EQ(count(shard), 100);
+}
+
+TEST_F(Test_WalletCache, shared_handle_releases_pin_after_lock)
+{
+    auto mutex = std::shared_mutex{};
+    auto value = int{0};
+    auto unlocked{false};
+    auto handle = ot::Shared<int>(&value, mutex, pin(mutex, unlocked));
+    auto moved = std::move(handle);
+
+    EXPECT_FALSE(handle.Release());
+    EXPECT_FALSE(unlocked);
+    EXPECT_TRUE(moved.Release());
+    EXPECT_TRUE(unlocked);
+}
+
+TEST_F(Test_WalletCache, exclusive_handle_releases_pin_after_lock)
+{
+    auto mutex = std::shared_mutex{};
+    auto value = std::make_unique<int>(0);
+    auto unlocked{false};
+
+    {
+        auto handle = ot::Exclusive<int>(
+            &value,
+            mutex,
+            [](auto&, auto&, bool) {},
+            nullptr,
+            pin(mutex, unlocked));
+        auto moved = std::move(handle);
+
+        EXPECT_TRUE(moved.Release());
+        EXPECT_FALSE(unlocked);
+    }
+
+    EXPECT_TRUE(unlocked);
+}
+}  // namespace
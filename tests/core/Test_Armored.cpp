@@ -0,0 +1,104 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr auto raw_{std::int32_t{0}};
+constexpr auto best_{std::int32_t{9}};
+const std::vector<std::size_t> sizes_{1, 2048, 1048576};
+
+class Test_Armored : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& api_;
+    const std::int32_t original_level_;
+
+    static auto payload(const std::size_t size) -> std::string
+    {
+        auto output = std::string{};
+        std::size_t i{0};
+
+        while (output.size() < size) {
+            output += "<transaction type=\"pending\" transactionNum=\"" +
+                      std::to_string(i++) + "\" />\n";
+        }
+
+        output.resize(size);
+
+        return output;
+    }
+
+    auto armor(const std::int32_t level, const ot::String& input)
+        -> ot::OTArmored
+    {
+        ot::Armored::SetCompressionLevel(level);
+        auto output = api_.Factory().Armored();
+
+        EXPECT_TRUE(output->SetString(input));
+
+        return output;
+    }
+
+    Test_Armored()
+        : api_(ot::Context().StartClient(OTTestEnvironment::test_args_, 0))
+        , original_level_(ot::Armored::CompressionLevel())
+    {
+    }
+
+    ~Test_Armored() { ot::Armored::SetCompressionLevel(original_level_); }
+};
+
+TEST_F(Test_Armored, round_trip)
+{
+    for (const auto level : {raw_, best_}) {
+        for (const auto size : sizes_) {
+            const auto input = ot::String::Factory(payload(size));
+            const auto armored = armor(level, input);
+            auto output = ot::String::Factory();
+
+            ASSERT_TRUE(armored->GetString(output));
+            EXPECT_STREQ(input->Get(), output->Get());
+        }
+    }
+}
+
+TEST_F(Test_Armored, levels_are_interchangeable)
+{
+    const auto input = ot::String::Factory(payload(32768));
+    const auto raw = armor(raw_, input);
+    const auto best = armor(best_, input);
+
+    EXPECT_GT(raw->GetLength(), best->GetLength());
+
+    // Decoding does not depend on the level which is currently set
+    for (const auto level : {best_, raw_}) {
+        ot::Armored::SetCompressionLevel(level);
+
+        for (const auto& armored : {raw, best}) {
+            auto output = ot::String::Factory();
+
+            ASSERT_TRUE(armored->GetString(output));
+            EXPECT_STREQ(input->Get(), output->Get());
+        }
+    }
+}
+
+TEST_F(Test_Armored, level_is_clamped)
+{
+    ot::Armored::SetCompressionLevel(42);
+
+    EXPECT_EQ(ot::Armored::CompressionLevel(), best_);
+
+    ot::Armored::SetCompressionLevel(-42);
+
+    EXPECT_EQ(ot::Armored::CompressionLevel(), -1);
+}
+}  // namespace
@@ -66,3 +66,39 @@ TEST_F(Ledger, load_nymbox)
     ASSERT_TRUE(nymbox);
     EXPECT_TRUE(nymbox->LoadNymbox());
 }
+
+TEST_F(Ledger, load_both_formats)
+{
+    const auto nym = client_.Wallet().Nym(nym_id_);
+
+    ASSERT_TRUE(nym);
+
+    auto nymbox = client_.Factory().Ledger(
+        nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, false);
+
+    ASSERT_TRUE(nymbox);
+    ASSERT_TRUE(nymbox->LoadNymbox());
+
+    auto raw = ot::String::Factory();
+
+    ASSERT_TRUE(nymbox->SaveContractRaw(raw));
+
+    // Boxes saved before the raw format was introduced are armored
+    auto legacy = ot::String::Factory();
+
+    ASSERT_TRUE(client_.Factory().Armored(raw.get())->WriteArmoredString(
+        legacy, "LEDGER"));
+
+    auto current = ot::String::Factory("OT LEDGER 1\n");
+    current->Concatenate(raw);
+
+    for (const auto& serialized : {legacy, current}) {
+        auto loaded = client_.Factory().Ledger(
+            nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, false);
+
+        ASSERT_TRUE(loaded);
+        EXPECT_TRUE(loaded->LoadNymboxFromString(serialized));
+        EXPECT_TRUE(loaded->VerifyAccount(*nym));
+        EXPECT_EQ(loaded->GetType(), ot::ledgerType::nymbox);
+    }
+}
@@ -0,0 +1,148 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTLowLevelTestEnvironment.hpp"
+
+#include "core/LogQueue.hpp"
+
+#include <chrono>
+#include <future>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Queue = ot::internal::LogQueue;
+
+class Test_LogQueue : public ::testing::Test
+{
+public:
+    static auto texts(const Queue::Batch& batch) -> std::vector<std::string>
+    {
+        auto output = std::vector<std::string>{};
+
+        for (const auto& record : batch) { output.emplace_back(record->text_); }
+
+        return output;
+    }
+};
+
+TEST_F(Test_LogQueue, batch_keeps_flush_order)
+{
+    auto queue = Queue{16};
+
+    for (auto i{0}; i < 5; ++i) {
+        EXPECT_TRUE(queue.Push(i, "thread", std::to_string(i)));
+    }
+
+    const auto batch = queue.Take(std::chrono::milliseconds(0));
+
+    ASSERT_EQ(batch.size(), 5);
+
+    for (auto i{0}; i < 5; ++i) {
+        EXPECT_EQ(batch.at(i)->level_, i);
+        EXPECT_EQ(batch.at(i)->thread_, "thread");
+        EXPECT_EQ(batch.at(i)->text_, std::to_string(i));
+    }
+
+    EXPECT_TRUE(queue.Take(std::chrono::milliseconds(0)).empty());
+}
+
+TEST_F(Test_LogQueue, records_beyond_limit_are_dropped_and_counted)
+{
+    auto queue = Queue{3};
+
+    EXPECT_TRUE(queue.Push(0, "", "first"));
+    EXPECT_TRUE(queue.Push(0, "", "second"));
+    EXPECT_TRUE(queue.Push(0, "", "third"));
+    EXPECT_FALSE(queue.Push(0, "", "fourth"));
+    EXPECT_FALSE(queue.Push(0, "", "fifth"));
+    EXPECT_EQ(queue.Dropped(), 2);
+
+    // The counter is reset each time the sink reports it
+    EXPECT_EQ(queue.Dropped(), 0);
+    EXPECT_EQ(
+        texts(queue.Take(std::chrono::milliseconds(0))),
+        std::vector<std::string>({"first", "second", "third"}));
+
+    // Taking a batch makes room for more records
+    EXPECT_TRUE(queue.Push(0, "", "sixth"));
+    EXPECT_EQ(queue.Dropped(), 0);
+}
+
+TEST_F(Test_LogQueue, records_with_promise_are_never_dropped)
+{
+    auto queue = Queue{1};
+    auto promise = std::promise<void>{};
+
+    EXPECT_TRUE(queue.Push(0, "", "first"));
+    EXPECT_FALSE(queue.Push(0, "", "dropped"));
+    EXPECT_TRUE(queue.Push(0, "", "assert", &promise));
+    EXPECT_EQ(queue.Dropped(), 1);
+
+    const auto batch = queue.Take(std::chrono::milliseconds(0));
+
+    ASSERT_EQ(batch.size(), 2);
+    EXPECT_EQ(batch.at(1)->text_, "assert");
+    EXPECT_EQ(batch.at(1)->promise_, &promise);
+}
+
+TEST_F(Test_LogQueue, push_wakes_waiting_sink)
+{
+    auto queue = Queue{16};
+    const auto start = std::chrono::steady_clock::now();
+    auto sink = std::async(std::launch::async, [&] {
+        return texts(queue.Take(std::chrono::seconds(30)));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_TRUE(queue.Push(0, "", "flushed"));
+    ASSERT_EQ(
+        sink.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    EXPECT_EQ(sink.get(), std::vector<std::string>({"flushed"}));
+    EXPECT_LT(
+        std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+}
+
+TEST_F(Test_LogQueue, empty_queue_times_out)
+{
+    auto queue = Queue{16};
+
+    EXPECT_TRUE(queue.Take(std::chrono::milliseconds(10)).empty());
+}
+
+TEST_F(Test_LogQueue, concurrent_producers_keep_their_own_order)
+{
+    constexpr auto threads{4};
+    constexpr auto records{1000};
+    auto queue = Queue{threads * records};
+    auto producers = std::vector<std::thread>{};
+
+    for (auto t{0}; t < threads; ++t) {
+        producers.emplace_back([&queue, t] {
+            for (auto i{0}; i < records; ++i) {
+                queue.Push(0, std::to_string(t), std::to_string(i));
+            }
+        });
+    }
+
+    auto next = std::map<std::string, int>{};
+    auto total{0};
+
+    while (total < (threads * records)) {
+        for (const auto& record : queue.Take(std::chrono::milliseconds(10))) {
+            EXPECT_EQ(record->text_, std::to_string(next[record->thread_]++));
+            ++total;
+        }
+    }
+
+    for (auto& producer : producers) { producer.join(); }
+
+    EXPECT_EQ(total, threads * records);
+    EXPECT_EQ(queue.Dropped(), 0);
+}
+}  // namespace
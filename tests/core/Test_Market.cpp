@@ -0,0 +1,282 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "opentxs/core/cron/OTCron.hpp"
+#include "opentxs/core/trade/OTMarket.hpp"
+#include "opentxs/core/trade/OTOffer.hpp"
+#include "opentxs/core/trade/OTTrade.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+using Numbers = std::vector<ot::TransactionNumber>;
+
+constexpr auto selling_{true};
+constexpr auto buying_{false};
+
+class Test_Market : public ::testing::Test
+{
+public:
+    const ot::api::client::internal::Manager& api_;
+    const ot::OTPasswordPrompt reason_;
+    const ot::OTServerID server_;
+    const ot::OTUnitID unit_;
+    const ot::OTUnitID currency_;
+    const ot::Time start_;
+    std::unique_ptr<ot::OTMarket> market_;
+
+    // Offers are added as if reloaded from the market file, so each one is
+    // placed in line by the time given rather than by the order of the calls
+    auto add(
+        const bool selling,
+        const std::int64_t price,
+        const ot::TransactionNumber number,
+        const std::chrono::seconds added) -> bool
+    {
+        auto offer = offer_for(selling, price, number);
+
+        if (false == market_->AddOffer(
+                         nullptr, *offer, reason_, false, start_ + added)) {
+            return false;
+        }
+
+        offer.release();
+
+        return true;
+    }
+
+    auto offer_for(
+        const bool selling,
+        const std::int64_t price,
+        const ot::TransactionNumber number) -> std::unique_ptr<ot::OTOffer>
+    {
+        auto offer = api_.Factory().Offer(server_, unit_, currency_, 1);
+
+        EXPECT_TRUE(offer);
+        EXPECT_TRUE(offer->MakeOffer(selling, price, 100, 1, number));
+
+        return offer;
+    }
+
+    auto matches(const bool selling, const std::int64_t price) -> Numbers
+    {
+        auto offer = offer_for(selling, price, 1000);
+        auto output = Numbers{};
+        market_->VisitMatches(*offer, [&](ot::OTOffer& match) {
+            output.emplace_back(match.GetTransactionNum());
+
+            return true;
+        });
+
+        return output;
+    }
+
+    static auto notary() -> ot::OTServerID
+    {
+        auto output = ot::identifier::Server::Factory();
+        output->CalculateDigest(std::string{"notary"});
+
+        return output;
+    }
+
+    static auto unit(const std::string& name) -> ot::OTUnitID
+    {
+        auto output = ot::identifier::UnitDefinition::Factory();
+        output->CalculateDigest(name);
+
+        return output;
+    }
+
+    Test_Market()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::test_args_, 0)))
+        , reason_(api_.Factory().PasswordPrompt(__FUNCTION__))
+        , server_(notary())
+        , unit_(unit("gold"))
+        , currency_(unit("dollars"))
+        , start_(ot::Clock::now())
+        , market_(api_.Factory().Market(server_, unit_, currency_, 1))
+    {
+    }
+};
+
+class Test_MarketStorage : public ::testing::Test
+{
+public:
+    const ot::api::server::internal::Manager& server_;
+    const ot::OTPasswordPrompt reason_;
+    const ot::identifier::Server& notary_;
+    const ot::Nym_p nym_;
+    const ot::OTUnitID unit_;
+    const ot::OTUnitID currency_;
+
+    auto make_cron() -> std::unique_ptr<ot::OTCron>
+    {
+        auto output = server_.Factory().Cron();
+
+        EXPECT_TRUE(output);
+
+        output->SetNotaryID(notary_);
+        output->SetServerNym(nym_);
+
+        return output;
+    }
+
+    auto sign(ot::Contract& contract) -> void
+    {
+        contract.ReleaseSignatures();
+
+        EXPECT_TRUE(contract.SignContract(*nym_, reason_));
+        EXPECT_TRUE(contract.SaveContract());
+    }
+
+    Test_MarketStorage()
+        : server_(dynamic_cast<const ot::api::server::internal::Manager&>(
+              ot::Context().StartServer(
+                  OTTestEnvironment::test_args_,
+                  0,
+                  true)))
+        , reason_(server_.Factory().PasswordPrompt(__FUNCTION__))
+        , notary_(dynamic_cast<const ot::identifier::Server&>(server_.ID()))
+        , nym_(server_.Wallet().Nym(server_.NymID()))
+        , unit_(Test_Market::unit("silver"))
+        , currency_(Test_Market::unit("euros"))
+    {
+    }
+};
+
+TEST_F(Test_Market, asks_best_price_first_then_first_in_line)
+{
+    ASSERT_TRUE(add(selling_, 12, 1, std::chrono::seconds(1)));
+    ASSERT_TRUE(add(selling_, 10, 2, std::chrono::seconds(2)));
+    ASSERT_TRUE(add(selling_, 11, 3, std::chrono::seconds(3)));
+    ASSERT_TRUE(add(selling_, 10, 4, std::chrono::seconds(4)));
+    ASSERT_TRUE(add(selling_, 0, 5, std::chrono::seconds(5)));
+
+    EXPECT_EQ(market_->GetAskCount(), 5);
+    EXPECT_EQ(market_->GetLowestAskPrice(), 10);
+    EXPECT_EQ(matches(buying_, 11), Numbers({2, 4, 3}));
+    EXPECT_EQ(matches(buying_, 9), Numbers{});
+
+    // A market order ignores price, but never matches another market order
+    EXPECT_EQ(matches(buying_, 0), Numbers({2, 4, 3, 1}));
+}
+
+TEST_F(Test_Market, bids_best_price_first_then_first_in_line)
+{
+    ASSERT_TRUE(add(buying_, 10, 1, std::chrono::seconds(1)));
+    ASSERT_TRUE(add(buying_, 12, 2, std::chrono::seconds(2)));
+    ASSERT_TRUE(add(buying_, 9, 3, std::chrono::seconds(3)));
+    ASSERT_TRUE(add(buying_, 12, 4, std::chrono::seconds(4)));
+    ASSERT_TRUE(add(buying_, 0, 5, std::chrono::seconds(5)));
+
+    EXPECT_EQ(market_->GetBidCount(), 5);
+    EXPECT_EQ(market_->GetHighestBidPrice(), 12);
+    EXPECT_EQ(matches(selling_, 10), Numbers({2, 4, 1}));
+    EXPECT_EQ(matches(selling_, 13), Numbers{});
+    EXPECT_EQ(matches(selling_, 0), Numbers({2, 4, 1, 3}));
+}
+
+TEST_F(Test_Market, reloaded_offers_keep_their_place)
+{
+    ASSERT_TRUE(add(selling_, 10, 1, std::chrono::seconds(3)));
+    ASSERT_TRUE(add(selling_, 10, 2, std::chrono::seconds(1)));
+    ASSERT_TRUE(add(selling_, 10, 3, std::chrono::seconds(2)));
+
+    EXPECT_EQ(matches(buying_, 10), Numbers({2, 3, 1}));
+}
+
+TEST_F(Test_Market, visitor_may_stop)
+{
+    ASSERT_TRUE(add(selling_, 10, 1, std::chrono::seconds(1)));
+    ASSERT_TRUE(add(selling_, 10, 2, std::chrono::seconds(2)));
+
+    auto offer = offer_for(buying_, 10, 1000);
+    auto visited = Numbers{};
+    market_->VisitMatches(*offer, [&](ot::OTOffer& match) {
+        visited.emplace_back(match.GetTransactionNum());
+
+        return false;
+    });
+
+    EXPECT_EQ(visited, Numbers({1}));
+}
+
+// Every fill saves the offers and trades it changed before the accounts, so
+// reloading before the cron slice ends must not show the volume as available
+TEST_F(Test_MarketStorage, fill_survives_reload_before_slice_ends)
+{
+    const auto number = ot::TransactionNumber{7};
+    auto marketID = ot::Identifier::Factory();
+
+    {
+        auto cron = make_cron();
+        auto market = cron->GetOrCreateMarket(unit_, currency_, 1);
+
+        ASSERT_TRUE(market);
+
+        marketID = ot::Identifier::Factory(*market);
+        auto offer = server_.Factory().Offer(notary_, unit_, currency_, 1);
+
+        ASSERT_TRUE(offer);
+        ASSERT_TRUE(offer->MakeOffer(selling_, 10, 100, 1, number));
+
+        sign(*offer);
+
+        ASSERT_TRUE(market->AddOffer(nullptr, *offer, reason_, true));
+
+        auto& added = *offer.release();
+        auto pTrade = server_.Factory().Trade(
+            notary_,
+            unit_,
+            ot::Identifier::Random(),
+            server_.NymID(),
+            currency_,
+            ot::Identifier::Random());
+
+        ASSERT_TRUE(pTrade);
+
+        std::shared_ptr<ot::OTTrade> trade{pTrade.release()};
+        trade->SetTransactionNum(number);
+        sign(*trade);
+
+        ASSERT_TRUE(cron->AddCronItem(trade, false, ot::Clock::now()));
+
+        // The in-memory part of a fill, as done by OTMarket::ProcessTrade
+        added.IncrementFinishedSoFar(40);
+        trade->IncrementTradesAlreadyDone();
+        sign(added);
+        sign(*trade);
+
+        ASSERT_TRUE(market->SaveFill(reason_));
+    }
+
+    auto cron = make_cron();
+
+    ASSERT_TRUE(cron->LoadCron());
+
+    auto market = cron->GetMarket(marketID);
+
+    ASSERT_TRUE(market);
+
+    const auto* offer = market->GetOffer(number);
+
+    ASSERT_NE(nullptr, offer);
+    EXPECT_EQ(60, offer->GetAmountAvailable());
+
+    auto trade = std::dynamic_pointer_cast<ot::OTTrade>(
+        cron->GetItemByOfficialNum(number));
+
+    ASSERT_TRUE(trade);
+    EXPECT_EQ(1, trade->GetCompletedCount());
+}
+}  // namespace
@@ -0,0 +1,86 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "opentxs/core/recurring/OTPaymentPlan.hpp"
+
+#include <chrono>
+#include <memory>
+
+namespace
+{
+constexpr auto hour_ = std::chrono::hours{1};
+constexpr auto day_ = std::chrono::hours{24};
+constexpr auto week_ = std::chrono::hours{24 * 7};
+
+class Test_PaymentPlan : public ::testing::Test
+{
+public:
+    const ot::api::client::internal::Manager& api_;
+    std::unique_ptr<ot::OTPaymentPlan> plan_;
+    ot::Time created_;
+
+    Test_PaymentPlan()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::test_args_, 0)))
+        , plan_(api_.Factory().PaymentPlan())
+        , created_()
+    {
+        EXPECT_TRUE(plan_);
+        EXPECT_TRUE(plan_->SetDateRange());
+
+        created_ = plan_->GetCreationDate();
+    }
+};
+
+TEST_F(Test_PaymentPlan, due_at_first_payment)
+{
+    ASSERT_TRUE(plan_->SetPaymentPlan(10, day_, week_));
+
+    EXPECT_EQ(plan_->GetNextDueDate(), created_ + day_);
+}
+
+TEST_F(Test_PaymentPlan, initial_payment_comes_first)
+{
+    ASSERT_TRUE(plan_->SetPaymentPlan(10, day_, week_));
+    ASSERT_TRUE(plan_->SetInitialPayment(5, hour_));
+
+    EXPECT_EQ(plan_->GetNextDueDate(), created_ + hour_);
+}
+
+TEST_F(Test_PaymentPlan, never_sooner_than_process_interval)
+{
+    const auto last = created_ + 2 * day_;
+    ASSERT_TRUE(plan_->SetPaymentPlan(10, day_, week_));
+    plan_->SetLastProcessDate(last);
+
+    EXPECT_EQ(plan_->GetNextDueDate(), last + plan_->GetProcessInterval());
+}
+
+TEST_F(Test_PaymentPlan, plan_ends_before_next_payment)
+{
+    ASSERT_TRUE(plan_->SetPaymentPlan(10, week_, week_, day_));
+
+    EXPECT_EQ(plan_->GetNextDueDate(), created_ + day_);
+}
+
+TEST_F(Test_PaymentPlan, expiry_before_next_payment)
+{
+    ASSERT_TRUE(plan_->SetDateRange(ot::Time{}, ot::Clock::now() + day_));
+    ASSERT_TRUE(plan_->SetPaymentPlan(10, week_, week_));
+
+    EXPECT_EQ(plan_->GetNextDueDate(), plan_->GetValidTo());
+}
+
+TEST_F(Test_PaymentPlan, due_now_when_flagged)
+{
+    ASSERT_TRUE(plan_->SetPaymentPlan(10, week_, week_));
+
+    plan_->FlagForRemoval();
+
+    EXPECT_EQ(plan_->GetNextDueDate(), ot::Time{});
+}
+}  // namespace
@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "opentxs/core/script/OTBylaw.hpp"
+#include "opentxs/core/script/OTScript.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace
+{
+class Scriptable final : public ot::OTScriptable
+{
+public:
+    using ot::OTScriptable::LoadScript;
+
+    Scriptable(const ot::api::internal::Core& api)
+        : ot::OTScriptable(api)
+    {
+    }
+};
+
+class Test_Scriptable : public ::testing::Test
+{
+public:
+    const ot::api::client::internal::Manager& api_;
+    Scriptable scriptable_;
+    ot::OTBylaw bylaw_;
+
+    auto run(const std::string& code) -> std::pair<ot::OTScript*, bool>
+    {
+        auto script = scriptable_.LoadScript(bylaw_, code);
+
+        EXPECT_TRUE(script);
+
+        if (false == bool(script)) { return {nullptr, false}; }
+
+        return {script.get(), script->ExecuteScript()};
+    }
+
+    Test_Scriptable()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::test_args_, 0)))
+        , scriptable_(api_)
+        , bylaw_("law", "chai")
+    {
+        bylaw_.AddClause("first", "1");
+    }
+};
+
+TEST_F(Test_Scriptable, runs_are_isolated)
+{
+    const auto [first, defined] =
+        run("global leaked_global = 5; var leaked_local = 6; "
+            "def leaked_function() { 7 }");
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_TRUE(defined);
+
+    // The same engine is reused, but nothing the first run defined remains
+    const auto [second, global] = run("leaked_global");
+
+    EXPECT_EQ(second, first);
+    EXPECT_FALSE(global);
+    EXPECT_FALSE(run("leaked_local").second);
+    EXPECT_FALSE(run("leaked_function()").second);
+
+    // The native calls registered when the engine was prepared survive
+    const auto [third, native] = run("get_time()");
+
+    EXPECT_EQ(third, first);
+    EXPECT_TRUE(native);
+}
+
+TEST_F(Test_Scriptable, changed_clause_replaces_engine)
+{
+    const auto first = run("1").first;
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(run("1").first, first);
+
+    const auto digest = bylaw_.GetDigest();
+
+    ASSERT_TRUE(bylaw_.UpdateClause("first", "2"));
+    EXPECT_NE(bylaw_.GetDigest(), digest);
+
+    const auto second = run("2").first;
+
+    EXPECT_NE(second, first);
+    EXPECT_EQ(run("2").first, second);
+
+    ASSERT_TRUE(bylaw_.AddClause("second", "3"));
+    EXPECT_NE(run("3").first, second);
+}
+}  // namespace
@@ -5,6 +5,9 @@
 
 #include "OTTestEnvironment.hpp"
 
+#include <future>
+#include <vector>
+
 using namespace opentxs;
 
 namespace
@@ -251,5 +254,116 @@ TEST_F(Test_Signatures, Secp256k1_supported_hashes)
     EXPECT_TRUE(test_signature(plaintext_1, secp256k1_, secp_, blake160_));
     EXPECT_TRUE(test_signature(plaintext_1, secp256k1_, secp_, ripemd160_));
 }
+
+TEST_F(Test_Signatures, Secp256k1_verification_cache)
+{
+    auto reason = client_.Factory().PasswordPrompt(__FUNCTION__);
+    auto sig = Data::Factory();
+
+    ASSERT_TRUE(
+        secp256k1_.Sign(client_, plaintext_1, secp_, sha256_, sig, reason));
+    EXPECT_TRUE(secp256k1_.Verify(plaintext_1, secp_, sig, sha256_));
+
+    const auto hits = crypto::AsymmetricProvider::VerificationCacheHits();
+
+    EXPECT_TRUE(secp256k1_.Verify(plaintext_1, secp_, sig, sha256_));
+    EXPECT_EQ(hits + 1, crypto::AsymmetricProvider::VerificationCacheHits());
+    EXPECT_FALSE(secp256k1_.Verify(plaintext_2, secp_, sig, sha256_));
+    EXPECT_FALSE(secp256k1_.Verify(plaintext_2, secp_, sig, sha256_));
+    EXPECT_FALSE(secp256k1_.Verify(plaintext_1, secp_, sig, sha512_));
+    EXPECT_EQ(hits + 1, crypto::AsymmetricProvider::VerificationCacheHits());
+}
+
+TEST_F(Test_Signatures, Secp256k1_batch)
+{
+    auto reason = client_.Factory().PasswordPrompt(__FUNCTION__);
+    auto plaintexts = std::vector<OTData>{};
+    auto signatures = std::vector<OTData>{};
+    auto items = std::vector<crypto::AsymmetricProvider::VerifyItem>{};
+    const std::size_t bad{13};
+
+    for (std::size_t i{0}; i < 40; ++i) {
+        const auto text = plaintext_string_1_ + std::to_string(i);
+        plaintexts.emplace_back(Data::Factory(text.data(), text.size()));
+        signatures.emplace_back(Data::Factory());
+
+        ASSERT_TRUE(secp256k1_.Sign(
+            client_,
+            plaintexts.back(),
+            secp_,
+            sha256_,
+            signatures.back(),
+            reason));
+    }
+
+    for (std::size_t i{0}; i < plaintexts.size(); ++i) {
+        const auto& plaintext = (bad == i) ? plaintext_2 : plaintexts.at(i);
+        items.emplace_back(crypto::AsymmetricProvider::VerifyItem{
+            plaintext, secp_, signatures.at(i), sha256_});
+    }
+
+    const auto failed = secp256k1_.VerifyBatch(items);
+
+    ASSERT_EQ(std::size_t{1}, failed.size());
+    EXPECT_EQ(bad, failed.front());
+}
+
+TEST_F(Test_Signatures, Secp256k1_concurrent_batches)
+{
+    constexpr std::size_t threads{8};
+    constexpr std::size_t rounds{10};
+    constexpr std::size_t count{32};
+    auto reason = client_.Factory().PasswordPrompt(__FUNCTION__);
+    auto plaintexts = std::vector<OTData>{};
+    auto signatures = std::vector<OTData>{};
+    auto batches =
+        std::vector<std::vector<crypto::AsymmetricProvider::VerifyItem>>{};
+
+    // Every batch gets its own signatures so none of them can be answered
+    // from the verification cache
+    for (std::size_t i{0}; i < threads * rounds * count; ++i) {
+        const auto text = plaintext_string_2_ + std::to_string(i);
+        plaintexts.emplace_back(Data::Factory(text.data(), text.size()));
+        signatures.emplace_back(Data::Factory());
+
+        ASSERT_TRUE(secp256k1_.Sign(
+            client_,
+            plaintexts.back(),
+            secp_,
+            sha256_,
+            signatures.back(),
+            reason));
+    }
+
+    for (std::size_t i{0}; i < plaintexts.size(); ++i) {
+        if (0 == i % count) { batches.emplace_back(); }
+
+        batches.back().emplace_back(crypto::AsymmetricProvider::VerifyItem{
+            plaintexts.at(i), secp_, signatures.at(i), sha256_});
+    }
+
+    const auto misses = crypto::AsymmetricProvider::VerificationCacheMisses();
+    // Batches submitted at the same time share the pool threads
+    auto futures = std::vector<std::future<std::size_t>>{};
+
+    for (std::size_t i{0}; i < threads; ++i) {
+        futures.emplace_back(std::async(std::launch::async, [&, i] {
+            auto failures = std::size_t{0};
+
+            for (std::size_t j{0}; j < rounds; ++j) {
+                failures +=
+                    secp256k1_.VerifyBatch(batches.at(i * rounds + j)).size();
+            }
+
+            return failures;
+        }));
+    }
+
+    for (auto& future : futures) { EXPECT_EQ(0, future.get()); }
+
+    EXPECT_LE(
+        misses + plaintexts.size(),
+        crypto::AsymmetricProvider::VerificationCacheMisses());
+}
 #endif  // OT_CRYPTO_SUPPORTED_KEY_ED25519
 }  // namespace
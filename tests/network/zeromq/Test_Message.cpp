@@ -5,6 +5,10 @@
 
 #include "OTTestEnvironment.hpp"
 
+#include <cstdint>
+#include <cstring>
+#include <string>
+
 using namespace opentxs;
 
 TEST(Message, Factory)
@@ -369,3 +373,105 @@ TEST(Message, size)
     size = multipartMessage->size();
     ASSERT_EQ(size, 3);
 }
+
+TEST(Message, AddFrame_Release)
+{
+    auto buffer = std::string(64, 'x');
+    auto released = int{0};
+
+    {
+        auto multipartMessage = network::zeromq::Message::Factory();
+        auto& frame = multipartMessage->AddFrame(
+            buffer.data(), buffer.size(), [&] { ++released; });
+
+        ASSERT_EQ(frame.data(), buffer.data());
+        ASSERT_EQ(frame.size(), buffer.size());
+
+        {
+            const auto copy = OTZMQMessage{multipartMessage};
+
+            ASSERT_EQ(copy->at(0).data(), buffer.data());
+        }
+
+        ASSERT_EQ(released, 0);
+    }
+
+    ASSERT_EQ(released, 1);
+}
+
+TEST(Message, copy_shares_frames)
+{
+    const auto payload = std::string(64, 'x');
+    auto multipartMessage = network::zeromq::Message::Factory();
+    multipartMessage->AddFrame(payload);
+    const auto copy = OTZMQMessage{multipartMessage};
+
+    ASSERT_EQ(copy->size(), 1);
+    ASSERT_EQ(copy->at(0).data(), multipartMessage->at(0).data());
+    ASSERT_EQ(std::string{copy->at(0)}, payload);
+}
+
+TEST(Message, AppendBytes)
+{
+    auto multipartMessage = network::zeromq::Message::Factory();
+    const auto view = multipartMessage->AppendBytes()(10);
+
+    ASSERT_EQ(multipartMessage->size(), 1);
+    ASSERT_NE(view.data(), nullptr);
+    ASSERT_EQ(view.size(), 10);
+
+    std::memcpy(view.data(), "testString", view.size());
+    const auto& frame = multipartMessage->at(0);
+
+    ASSERT_EQ(frame.data(), view.data());
+    ASSERT_EQ(std::string{frame}, "testString");
+}
+
+TEST(Message, AppendBytes_header_and_body)
+{
+    // Mirrors a peer message read from a socket: the header is written into
+    // the first body frame and announces the size of the second one
+    const auto payload = std::string{"payload"};
+    auto multipartMessage = network::zeromq::Message::Factory();
+    multipartMessage->AddFrame(std::string{"type"});
+    multipartMessage->AddFrame();
+    const auto header = multipartMessage->AppendBytes()(sizeof(std::uint32_t));
+    const auto announced = static_cast<std::uint32_t>(payload.size());
+    std::memcpy(header.data(), &announced, header.size());
+
+    auto bodySize = std::uint32_t{0};
+    const auto& headerFrame = multipartMessage->Body_at(0);
+
+    ASSERT_EQ(headerFrame.size(), sizeof(bodySize));
+
+    std::memcpy(&bodySize, headerFrame.data(), sizeof(bodySize));
+
+    ASSERT_EQ(bodySize, payload.size());
+
+    const auto body = multipartMessage->AppendBytes()(bodySize);
+    std::memcpy(body.data(), payload.data(), body.size());
+
+    ASSERT_EQ(multipartMessage->Header().size(), 1);
+    ASSERT_EQ(std::string{multipartMessage->Header_at(0)}, "type");
+    ASSERT_EQ(multipartMessage->Body().size(), 2);
+    ASSERT_EQ(multipartMessage->Body_at(0).data(), header.data());
+    ASSERT_EQ(std::string{multipartMessage->Body_at(1)}, payload);
+
+    // Copies share the frames which were written in place
+    const auto copy = OTZMQMessage{multipartMessage};
+
+    ASSERT_EQ(copy->Body_at(1).data(), body.data());
+}
+
+TEST(Message, AppendBytes_empty_body)
+{
+    auto multipartMessage = network::zeromq::Message::Factory();
+    multipartMessage->AddFrame();
+    multipartMessage->AppendBytes()(4);
+    const auto body = multipartMessage->AppendBytes()(0);
+
+    ASSERT_EQ(body.size(), 0);
+    ASSERT_EQ(multipartMessage->Body().size(), 2);
+    ASSERT_EQ(multipartMessage->Body_at(0).size(), 4);
+    ASSERT_EQ(multipartMessage->Body_at(1).size(), 0);
+}
@@ -0,0 +1,263 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTLowLevelTestEnvironment.hpp"
+
+#include "network/zeromq/Reactor.hpp"
+
+#include <zmq.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Reactor = ot::network::zeromq::implementation::Reactor;
+
+class Listener final : public Reactor::Listener
+{
+public:
+    std::function<bool()> cb_;
+
+    bool react() noexcept final { return cb_(); }
+
+    Listener(std::function<bool()> cb)
+        : cb_(cb)
+    {
+    }
+};
+
+class Test_Reactor : public ::testing::Test
+{
+public:
+    void* context_;
+    std::unique_ptr<Reactor> reactor_;
+    std::vector<void*> sockets_;
+
+    // Returns false if the condition did not become true in time
+    static auto wait_for(const std::function<bool()>& condition) -> bool
+    {
+        const auto limit =
+            std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+        while (false == condition()) {
+            if (std::chrono::steady_clock::now() > limit) { return false; }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        return true;
+    }
+
+    static auto drain(void* socket, std::atomic<int>& received) -> bool
+    {
+        while (true) {
+            auto events = int{0};
+            auto size = sizeof(events);
+            zmq_getsockopt(socket, ZMQ_EVENTS, &events, &size);
+
+            if (0 == (events & ZMQ_POLLIN)) { return false; }
+
+            auto message = zmq_msg_t{};
+            zmq_msg_init(&message);
+
+            if (-1 != zmq_msg_recv(&message, socket, ZMQ_DONTWAIT)) {
+                ++received;
+            }
+
+            zmq_msg_close(&message);
+        }
+    }
+
+    static auto send(void* socket) -> void
+    {
+        ASSERT_EQ(zmq_send(socket, "", 0, 0), 0);
+    }
+
+    auto pull(const std::string& endpoint) -> void*
+    {
+        auto* output = sockets_.emplace_back(zmq_socket(context_, ZMQ_PULL));
+        zmq_bind(output, endpoint.c_str());
+
+        return output;
+    }
+
+    auto push(const std::string& endpoint) -> void*
+    {
+        auto* output = sockets_.emplace_back(zmq_socket(context_, ZMQ_PUSH));
+        zmq_connect(output, endpoint.c_str());
+
+        return output;
+    }
+
+    Test_Reactor()
+        : context_(zmq_ctx_new())
+        , reactor_(std::make_unique<Reactor>(context_, 1, 4))
+        , sockets_()
+    {
+    }
+
+    ~Test_Reactor() override
+    {
+        reactor_.reset();
+        const auto linger = int{0};
+
+        for (auto* socket : sockets_) {
+            zmq_setsockopt(socket, ZMQ_LINGER, &linger, sizeof(linger));
+            zmq_close(socket);
+        }
+
+        zmq_ctx_term(context_);
+    }
+};
+
+TEST_F(Test_Reactor, add_and_remove_while_running)
+{
+    auto first = std::atomic<int>{0};
+    auto second = std::atomic<int>{0};
+    auto* firstPull = pull("inproc://test_reactor/first");
+    auto* firstPush = push("inproc://test_reactor/first");
+    auto* secondPull = pull("inproc://test_reactor/second");
+    auto* secondPush = push("inproc://test_reactor/second");
+    auto firstListener = Listener{[&] { return drain(firstPull, first); }};
+    auto secondListener = Listener{[&] { return drain(secondPull, second); }};
+
+    ASSERT_TRUE(reactor_->Add(firstListener, {firstPull}));
+
+    send(firstPush);
+    send(firstPush);
+
+    ASSERT_TRUE(wait_for([&] { return 2 == first; }));
+
+    // Registering twice is refused
+    EXPECT_FALSE(reactor_->Add(firstListener, {firstPull}));
+
+    // A message which arrives before the listener is added is not lost
+    send(secondPush);
+
+    ASSERT_TRUE(reactor_->Add(secondListener, {secondPull}));
+    ASSERT_TRUE(wait_for([&] { return 1 == second; }));
+
+    send(firstPush);
+
+    ASSERT_TRUE(wait_for([&] { return 3 == first; }));
+
+    reactor_->Remove(firstListener);
+    send(firstPush);
+    send(secondPush);
+
+    ASSERT_TRUE(wait_for([&] { return 2 == second; }));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(first, 3);
+
+    reactor_->Remove(secondListener);
+}
+
+TEST_F(Test_Reactor, listener_can_remove_itself)
+{
+    auto& reactor = *reactor_;
+    auto calls = std::atomic<int>{0};
+    auto listener = std::unique_ptr<Listener>{};
+    listener = std::make_unique<Listener>([&] {
+        ++calls;
+        reactor.Remove(*listener);
+
+        // Asking to run again has no effect once removed
+        return true;
+    });
+
+    // Adding a listener runs it once
+    ASSERT_TRUE(reactor_->Add(*listener, {}));
+    ASSERT_TRUE(wait_for([&] { return 1 == calls; }));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    reactor_->Trigger(*listener);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(calls, 1);
+
+    // Removing it again returns immediately
+    reactor_->Remove(*listener);
+
+    // The listener may be added again
+    calls = 0;
+
+    ASSERT_TRUE(reactor_->Add(*listener, {}));
+    ASSERT_TRUE(wait_for([&] { return 1 == calls; }));
+
+    // The callback may still be running, so it must finish before the
+    // listener goes out of scope
+    reactor_.reset();
+}
+
+TEST_F(Test_Reactor, shutdown_waits_for_running_workers)
+{
+    constexpr auto count{4};
+    auto started = std::atomic<int>{0};
+    auto finished = std::atomic<int>{0};
+    auto listeners = std::vector<std::unique_ptr<Listener>>{};
+
+    for (auto i{0}; i < count; ++i) {
+        listeners.emplace_back(std::make_unique<Listener>([&] {
+            ++started;
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            ++finished;
+
+            return false;
+        }));
+
+        ASSERT_TRUE(reactor_->Add(*listeners.back(), {}));
+    }
+
+    ASSERT_TRUE(wait_for([&] { return count == started; }));
+
+    reactor_.reset();
+
+    EXPECT_EQ(finished, count);
+}
+
+TEST_F(Test_Reactor, worker_count_is_capped)
+{
+    constexpr auto count{8};
+    constexpr auto workers{2};
+    reactor_ = std::make_unique<Reactor>(context_, 1, workers);
+    auto running = std::atomic<int>{0};
+    auto peak = std::atomic<int>{0};
+    auto done = std::atomic<int>{0};
+    auto listeners = std::vector<std::unique_ptr<Listener>>{};
+
+    for (auto i{0}; i < count; ++i) {
+        listeners.emplace_back(std::make_unique<Listener>([&] {
+            const auto now = ++running;
+            auto previous = peak.load();
+
+            while ((previous < now) &&
+                   (false == peak.compare_exchange_weak(previous, now))) {
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            --running;
+            ++done;
+
+            return false;
+        }));
+
+        ASSERT_TRUE(reactor_->Add(*listeners.back(), {}));
+    }
+
+    // Listeners beyond the cap wait for a free worker instead of being lost
+    ASSERT_TRUE(wait_for([&] { return count == done; }));
+    EXPECT_LE(peak, workers);
+
+    for (auto& listener : listeners) { reactor_->Remove(*listener); }
+}
+}  // namespace
@@ -0,0 +1,153 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "server/Scheduler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+using Scheduler = ot::server::Scheduler;
+
+class Test_Scheduler : public ::testing::Test
+{
+public:
+    Scheduler scheduler_;
+    std::mutex lock_;
+    std::vector<int> order_;
+
+    auto record(const int value) -> void
+    {
+        ot::Lock lock(lock_);
+        order_.emplace_back(value);
+    }
+
+    Test_Scheduler()
+        : scheduler_()
+        , lock_()
+        , order_()
+    {
+    }
+};
+
+TEST_F(Test_Scheduler, conflicting_keys_run_in_order)
+{
+    constexpr auto count{20};
+    auto active = std::atomic<int>{0};
+    auto overlap = std::atomic<bool>{false};
+    scheduler_.Start(4);
+
+    for (auto i{0}; i < count; ++i) {
+        scheduler_.Submit({"account"}, false, [&, i] {
+            if (0 != active++) { overlap = true; }
+
+            ot::Sleep(std::chrono::milliseconds(1));
+            record(i);
+            --active;
+        });
+    }
+
+    scheduler_.Stop();
+
+    EXPECT_FALSE(overlap);
+    ASSERT_EQ(order_.size(), count);
+
+    for (auto i{0}; i < count; ++i) { EXPECT_EQ(order_.at(i), i); }
+}
+
+TEST_F(Test_Scheduler, disjoint_keys_run_concurrently)
+{
+    auto promise = std::promise<void>{};
+    auto future = promise.get_future();
+    auto status = std::future_status::timeout;
+    scheduler_.Start(2);
+
+    // The first job can only finish early if the second one runs alongside it
+    scheduler_.Submit({"first"}, false, [&] {
+        status = future.wait_for(std::chrono::seconds(10));
+    });
+    scheduler_.Submit({"second"}, false, [&] { promise.set_value(); });
+    scheduler_.Stop();
+
+    EXPECT_EQ(status, std::future_status::ready);
+}
+
+TEST_F(Test_Scheduler, exclusive_job_is_a_barrier)
+{
+    auto gate = std::promise<void>{};
+    auto opened = gate.get_future().share();
+    scheduler_.Start(4);
+    scheduler_.Submit({"first"}, false, [&, opened] {
+        opened.wait();
+        record(1);
+    });
+    scheduler_.Submit({}, true, [&] { record(2); });
+    scheduler_.Submit({"second"}, false, [&] { record(3); });
+    gate.set_value();
+    scheduler_.Stop();
+
+    ASSERT_EQ(order_.size(), 3);
+    EXPECT_EQ(order_.at(0), 1);
+    EXPECT_EQ(order_.at(1), 2);
+    EXPECT_EQ(order_.at(2), 3);
+}
+
+TEST_F(Test_Scheduler, prepared_jobs_keep_submission_order)
+{
+    scheduler_.Start(4);
+
+    // A slow prepare must not let a later job on the same key overtake it
+    scheduler_.Submit([&](Scheduler::Keys& keys, Scheduler::Job& job) {
+        ot::Sleep(std::chrono::milliseconds(200));
+        keys.emplace("account");
+        job = [&] { record(1); };
+
+        return true;
+    });
+    scheduler_.Submit({"account"}, false, [&] { record(2); });
+    scheduler_.Submit([&](Scheduler::Keys& keys, Scheduler::Job& job) {
+        keys.emplace("account");
+        job = [&] { record(3); };
+
+        return true;
+    });
+    scheduler_.Stop();
+
+    ASSERT_EQ(order_.size(), 3);
+    EXPECT_EQ(order_.at(0), 1);
+    EXPECT_EQ(order_.at(1), 2);
+    EXPECT_EQ(order_.at(2), 3);
+}
+
+TEST_F(Test_Scheduler, prepared_job_may_be_exclusive)
+{
+    auto gate = std::promise<void>{};
+    auto opened = gate.get_future().share();
+    scheduler_.Start(4);
+    scheduler_.Submit({"first"}, false, [&, opened] {
+        opened.wait();
+        record(1);
+    });
+    scheduler_.Submit([&](Scheduler::Keys&, Scheduler::Job& job) {
+        job = [&] { record(2); };
+
+        return false;
+    });
+    scheduler_.Submit({"second"}, false, [&] { record(3); });
+    gate.set_value();
+    scheduler_.Stop();
+
+    ASSERT_EQ(order_.size(), 3);
+    EXPECT_EQ(order_.at(0), 1);
+    EXPECT_EQ(order_.at(1), 2);
+    EXPECT_EQ(order_.at(2), 3);
+}
+}  // namespace
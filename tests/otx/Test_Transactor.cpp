@@ -0,0 +1,98 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include <future>
+#include <set>
+#include <vector>
+
+namespace
+{
+using Numbers = std::vector<ot::TransactionNumber>;
+
+class Test_Transactor : public ::testing::Test
+{
+public:
+    const ot::api::server::internal::Manager& server_;
+    ot::server::Transactor& transactor_;
+
+    auto issue() -> ot::TransactionNumber
+    {
+        auto output = ot::TransactionNumber{0};
+
+        EXPECT_TRUE(transactor_.issueNextTransactionNumber(output));
+
+        return output;
+    }
+
+    Test_Transactor()
+        : server_(dynamic_cast<const ot::api::server::internal::Manager&>(
+              ot::Context().StartServer(
+                  OTTestEnvironment::test_args_,
+                  0,
+                  true)))
+        , transactor_(server_.Server().GetTransactor())
+    {
+    }
+};
+
+TEST_F(Test_Transactor, numbers_are_consecutive)
+{
+    const auto first = issue();
+
+    for (auto i{1}; i < 10; ++i) { EXPECT_EQ(issue(), first + i); }
+
+    EXPECT_EQ(transactor_.transactionNumber(), first + 9);
+}
+
+TEST_F(Test_Transactor, concurrent_issuers)
+{
+    const auto start = transactor_.transactionNumber();
+    auto issuers = std::vector<std::future<Numbers>>{};
+
+    for (auto i{0}; i < 4; ++i) {
+        issuers.emplace_back(std::async(std::launch::async, [&] {
+            auto output = Numbers{};
+
+            for (auto j{0}; j < 500; ++j) { output.emplace_back(issue()); }
+
+            return output;
+        }));
+    }
+
+    auto issued = std::set<ot::TransactionNumber>{};
+
+    for (auto& issuer : issuers) {
+        for (const auto number : issuer.get()) {
+            EXPECT_TRUE(issued.emplace(number).second);
+        }
+    }
+
+    ASSERT_EQ(issued.size(), 2000);
+    EXPECT_EQ(*issued.begin(), start + 1);
+    EXPECT_EQ(*issued.rbegin(), start + 2000);
+    EXPECT_EQ(transactor_.transactionNumber(), start + 2000);
+}
+
+TEST_F(Test_Transactor, restart_resumes_after_reserved_block)
+{
+    const auto saved = issue();
+    auto last = saved;
+
+    for (auto i{0}; i < 5; ++i) { last = issue(); }
+
+    // The main file was last saved when saved was issued, so the numbers
+    // after it were only recorded by the block reservation
+    transactor_.transactionNumber(saved);
+
+    ASSERT_TRUE(transactor_.loadReservedNumbers());
+
+    const auto next = issue();
+
+    EXPECT_GT(next, last);
+    EXPECT_GT(transactor_.transactionNumber(), last);
+}
+}  // namespace
@@ -0,0 +1,207 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "internal/api/storage/Storage.hpp"
+#include "storage/StorageConfig.hpp"
+#include "util/LMDB.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+using Storage = std::unique_ptr<ot::api::storage::StorageInternal>;
+
+class Test_GarbageCollection : public ::testing::Test
+{
+public:
+    const ot::api::client::internal::Manager& api_;
+    const fs::path folder_;
+    const ot::OTFlag running_;
+    ot::StorageConfig config_;
+    std::unique_ptr<const ot::api::Settings> settings_;
+
+    enum Table { Control = 0, A = 1, B = 2 };
+
+    // Opens the database directly. The storage instance must be closed.
+    auto database(
+        const std::function<void(const ot::storage::lmdb::LMDB&)>& cb) const
+        -> void
+    {
+        const auto names = ot::storage::lmdb::TableNames{
+            {Control, config_.lmdb_control_table_},
+            {A, config_.lmdb_primary_bucket_},
+            {B, config_.lmdb_secondary_bucket_},
+        };
+        const auto db = ot::storage::lmdb::LMDB{
+            names, config_.path_, {{Control, 0}, {A, 0}, {B, 0}}};
+        cb(db);
+    }
+
+    // Lists the keys in the bucket which receives writes while the current
+    // bucket flag is off
+    auto keys() const -> std::set<std::string>
+    {
+        auto output = std::set<std::string>{};
+        database([&](const auto& db) {
+            db.Read(
+                B,
+                [&](const auto key, const auto) -> bool {
+                    output.emplace(key);
+
+                    return true;
+                },
+                ot::storage::lmdb::LMDB::Dir::Forward);
+        });
+
+        return output;
+    }
+
+    auto open() -> Storage
+    {
+        auto encrypted = ot::String::Factory();
+        auto output = Storage{ot::Factory::Storage(
+            running_,
+            api_.Crypto(),
+            *settings_,
+            api_.Legacy(),
+            folder_.string(),
+            ot::String::Factory(OT_STORAGE_PRIMARY_PLUGIN_LMDB),
+            ot::String::Factory(),
+            std::chrono::seconds(1),
+            encrypted,
+            config_)};
+
+        if (output) { output->start(); }
+
+        return output;
+    }
+
+    Test_GarbageCollection()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::test_args_, 0)))
+        , folder_(
+              fs::temp_directory_path() /
+              fs::unique_path("opentxs-gc-%%%%-%%%%-%%%%-%%%%"))
+        , running_(ot::Flag::Factory(true))
+        , config_()
+        , settings_()
+    {
+        fs::create_directories(folder_);
+        settings_.reset(ot::Factory::Settings(
+            api_.Legacy(),
+            ot::String::Factory((folder_ / "storage.cfg").string())));
+    }
+
+    ~Test_GarbageCollection() { fs::remove_all(folder_); }
+};
+
+TEST_F(Test_GarbageCollection, mark_and_sweep)
+{
+    {
+        auto storage = open();
+
+        ASSERT_TRUE(storage);
+
+        // Each change replaces the seed index, tree and root objects, which
+        // leaves the previous versions unreachable
+        EXPECT_TRUE(storage->SetDefaultSeed("first"));
+        EXPECT_TRUE(storage->SetDefaultSeed("second"));
+    }
+
+    const auto before = keys();
+
+    ASSERT_FALSE(before.empty());
+
+    {
+        auto storage = open();
+
+        ASSERT_TRUE(storage);
+
+        // The interval is measured in whole seconds
+        ot::Sleep(std::chrono::seconds(3));
+        storage->RunGC();
+    }
+
+    const auto after = keys();
+
+    // Reachable objects stay in the collected bucket instead of being copied
+    // out of it, and unreachable objects are deleted
+    EXPECT_FALSE(after.empty());
+    EXPECT_LT(after.size(), before.size());
+
+    for (const auto& key : after) { EXPECT_EQ(before.count(key), 1); }
+
+    {
+        auto storage = open();
+
+        ASSERT_TRUE(storage);
+        EXPECT_EQ(storage->DefaultSeed(), "second");
+    }
+}
+
+TEST_F(Test_GarbageCollection, failed_mark_deletes_nothing)
+{
+    {
+        auto storage = open();
+
+        ASSERT_TRUE(storage);
+        EXPECT_TRUE(storage->SetDefaultSeed("first"));
+        EXPECT_TRUE(storage->SetDefaultSeed("second"));
+    }
+
+    // Remove the live seed index, which is an interior node of the tree, so
+    // the collector can not finish marking
+    auto missing = std::string{};
+
+    database([&](const auto& db) {
+        db.Read(
+            B,
+            [&](const auto key, const auto value) -> bool {
+                auto seeds = ot::proto::StorageSeeds{};
+                const auto parsed = seeds.ParseFromArray(
+                    value.data(), static_cast<int>(value.size()));
+
+                if (parsed && ("second" == seeds.defaultseed()) &&
+                    ot::proto::Validate(seeds, ot::SILENT)) {
+                    missing = key;
+
+                    return false;
+                }
+
+                return true;
+            },
+            ot::storage::lmdb::LMDB::Dir::Forward);
+
+        ASSERT_FALSE(missing.empty());
+        EXPECT_TRUE(db.Delete(B, missing));
+    });
+
+    const auto before = keys();
+
+    ASSERT_EQ(before.count(missing), 0);
+
+    {
+        auto storage = open();
+
+        ASSERT_TRUE(storage);
+
+        ot::Sleep(std::chrono::seconds(3));
+        storage->RunGC();
+    }
+
+    // Unreachable objects are kept too, since the live set is incomplete
+    EXPECT_EQ(keys(), before);
+}
+}  // namespace
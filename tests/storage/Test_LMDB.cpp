@@ -0,0 +1,142 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTLowLevelTestEnvironment.hpp"
+
+#include "util/LMDB.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+using LMDB = ot::storage::lmdb::LMDB;
+
+constexpr auto table_{0};
+const auto names_ = ot::storage::lmdb::TableNames{{table_, "values"}};
+
+class Test_LMDB : public ::testing::Test
+{
+public:
+    const fs::path folder_;
+
+    static auto elapsed(const std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::steady_clock::now() - start;
+    }
+
+    auto load(const LMDB& db, const std::string& key) const -> std::string
+    {
+        auto output = std::string{};
+        db.Load(table_, key, [&](const auto data) {
+            output.assign(data.data(), data.size());
+        });
+
+        return output;
+    }
+
+    Test_LMDB()
+        : folder_(
+              fs::temp_directory_path() /
+              fs::unique_path("opentxs-lmdb-%%%%-%%%%-%%%%-%%%%"))
+    {
+        fs::create_directories(folder_);
+    }
+
+    ~Test_LMDB() { fs::remove_all(folder_); }
+};
+
+TEST_F(Test_LMDB, single_writer_is_not_delayed)
+{
+    const auto db = LMDB{
+        names_,
+        folder_.string(),
+        {{table_, 0}},
+        0,
+        {std::chrono::seconds(1), 1024 * 1024}};
+
+    for (auto i{0}; i < 3; ++i) {
+        const auto key = "key " + std::to_string(i);
+        const auto start = std::chrono::steady_clock::now();
+
+        EXPECT_TRUE(db.Submit(table_, key, "value").get());
+        EXPECT_LT(elapsed(start), std::chrono::milliseconds(250));
+        EXPECT_EQ(load(db, key), "value");
+    }
+}
+
+TEST_F(Test_LMDB, concurrent_writes_are_grouped)
+{
+    const auto db = LMDB{
+        names_,
+        folder_.string(),
+        {{table_, 0}},
+        0,
+        {std::chrono::milliseconds(500), 1024 * 1024}};
+    const auto start = std::chrono::steady_clock::now();
+    auto writers = std::vector<std::future<bool>>{};
+
+    for (auto i{0}; i < 8; ++i) {
+        writers.emplace_back(std::async(std::launch::async, [&, i] {
+            const auto key = "key " + std::to_string(i);
+
+            return db.Submit(table_, key, "value " + std::to_string(i)).get();
+        }));
+    }
+
+    for (auto& writer : writers) { EXPECT_TRUE(writer.get()); }
+
+    // Committed one at a time each contended write would wait for a window
+    EXPECT_LT(elapsed(start), std::chrono::seconds(2));
+
+    for (auto i{0}; i < 8; ++i) {
+        EXPECT_EQ(
+            load(db, "key " + std::to_string(i)),
+            "value " + std::to_string(i));
+    }
+}
+
+TEST_F(Test_LMDB, failed_write_does_not_fail_group)
+{
+    const auto db = LMDB{
+        names_,
+        folder_.string(),
+        {{table_, 0}},
+        0,
+        {std::chrono::milliseconds(100), 1024 * 1024}};
+    // Larger than the maximum key size lmdb accepts
+    const auto bad = std::string(600, 'x');
+    auto good = std::vector<std::future<bool>>{};
+    auto failed = std::future<bool>{};
+
+    for (auto i{0}; i < 4; ++i) {
+        good.emplace_back(
+            db.Submit(table_, "key " + std::to_string(i), "value"));
+
+        if (1 == i) { failed = db.Submit(table_, bad, "value"); }
+    }
+
+    EXPECT_FALSE(failed.get());
+
+    for (auto i{0}; i < 4; ++i) {
+        EXPECT_TRUE(good.at(i).get());
+        EXPECT_EQ(load(db, "key " + std::to_string(i)), "value");
+    }
+}
+
+TEST_F(Test_LMDB, grouping_disabled)
+{
+    const auto db = LMDB{names_, folder_.string(), {{table_, 0}}};
+
+    EXPECT_TRUE(db.Submit(table_, "key", "value").get());
+    EXPECT_EQ(load(db, "key"), "value");
+}
+}  // namespace
@@ -0,0 +1,171 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "internal/api/storage/Storage.hpp"
+#include "storage/StorageConfig.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+using Keys = std::map<std::uint64_t, std::vector<std::string>>;
+using Storage = std::unique_ptr<ot::api::storage::StorageInternal>;
+
+class Test_SpentTokens : public ::testing::Test
+{
+public:
+    const ot::api::client::internal::Manager& api_;
+    const fs::path folder_;
+    const ot::OTFlag running_;
+    const ot::OTServerID notary_;
+    const ot::OTUnitID unit_;
+    ot::StorageConfig config_;
+    std::unique_ptr<const ot::api::Settings> settings_;
+
+    auto open() -> Storage
+    {
+        auto encrypted = ot::String::Factory();
+        auto output = Storage{ot::Factory::Storage(
+            running_,
+            api_.Crypto(),
+            *settings_,
+            api_.Legacy(),
+            folder_.string(),
+            ot::String::Factory(OT_STORAGE_PRIMARY_PLUGIN_LMDB),
+            ot::String::Factory(),
+            std::chrono::seconds(0),
+            encrypted,
+            config_)};
+
+        if (output) { output->start(); }
+
+        return output;
+    }
+
+    auto spent(
+        const Storage& storage,
+        const std::uint64_t series,
+        const std::string& key) const -> bool
+    {
+        return storage->CheckTokenSpent(notary_, unit_, series, key);
+    }
+
+    Test_SpentTokens()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::test_args_, 0)))
+        , folder_(
+              fs::temp_directory_path() /
+              fs::unique_path("opentxs-spent-%%%%-%%%%-%%%%-%%%%"))
+        , running_(ot::Flag::Factory(true))
+        , notary_(ot::identifier::Server::Factory(
+              ot::Identifier::Random()->str()))
+        , unit_(ot::identifier::UnitDefinition::Factory(
+              ot::Identifier::Random()->str()))
+        , config_()
+        , settings_()
+    {
+        fs::create_directories(folder_);
+        settings_.reset(ot::Factory::Settings(
+            api_.Legacy(),
+            ot::String::Factory((folder_ / "storage.cfg").string())));
+    }
+
+    ~Test_SpentTokens() { fs::remove_all(folder_); }
+};
+
+TEST_F(Test_SpentTokens, batch)
+{
+    auto storage = open();
+
+    ASSERT_TRUE(storage);
+    EXPECT_FALSE(storage->CheckTokenSpent(notary_, unit_, Keys{{1, {"a"}}}));
+    EXPECT_TRUE(storage->MarkTokenSpent(notary_, unit_, Keys{{1, {"a", "b"}}}));
+    EXPECT_TRUE(spent(storage, 1, "a"));
+    EXPECT_TRUE(spent(storage, 1, "b"));
+
+    // Spent keys are tracked per series
+    EXPECT_FALSE(spent(storage, 2, "a"));
+    EXPECT_TRUE(
+        storage->CheckTokenSpent(notary_, unit_, Keys{{1, {"x", "a"}}}));
+    EXPECT_FALSE(
+        storage->CheckTokenSpent(notary_, unit_, Keys{{1, {"x"}}, {2, {"a"}}}));
+}
+
+TEST_F(Test_SpentTokens, batch_is_all_or_nothing)
+{
+    auto storage = open();
+
+    ASSERT_TRUE(storage);
+    ASSERT_TRUE(storage->MarkTokenSpent(notary_, unit_, 1, "a"));
+
+    // One key in the batch is already spent
+    EXPECT_FALSE(storage->MarkTokenSpent(
+        notary_, unit_, Keys{{1, {"c", "a"}}, {2, {"d"}}}));
+    EXPECT_FALSE(spent(storage, 1, "c"));
+    EXPECT_FALSE(spent(storage, 2, "d"));
+
+    // The batch repeats a key
+    EXPECT_FALSE(storage->MarkTokenSpent(
+        notary_, unit_, Keys{{1, {"e"}}, {2, {"f", "f"}}}));
+    EXPECT_FALSE(spent(storage, 1, "e"));
+    EXPECT_FALSE(spent(storage, 2, "f"));
+
+    EXPECT_TRUE(storage->MarkTokenSpent(
+        notary_, unit_, Keys{{1, {"c", "e"}}, {2, {"d", "f"}}}));
+    EXPECT_TRUE(spent(storage, 1, "c"));
+    EXPECT_TRUE(spent(storage, 1, "e"));
+    EXPECT_TRUE(spent(storage, 2, "d"));
+    EXPECT_TRUE(spent(storage, 2, "f"));
+}
+
+TEST_F(Test_SpentTokens, pages_survive_restart)
+{
+    // More keys than fit in one page
+    constexpr auto count{2500};
+    auto keys = Keys{};
+
+    for (auto i{0}; i < count; ++i) {
+        keys[7].emplace_back("key " + std::to_string(i));
+    }
+
+    {
+        auto storage = open();
+
+        ASSERT_TRUE(storage);
+        ASSERT_TRUE(storage->MarkTokenSpent(notary_, unit_, keys));
+    }
+
+    {
+        auto storage = open();
+
+        ASSERT_TRUE(storage);
+
+        for (const auto& key : keys.at(7)) {
+            EXPECT_TRUE(spent(storage, 7, key));
+        }
+
+        EXPECT_FALSE(spent(storage, 7, "new"));
+        EXPECT_TRUE(storage->MarkTokenSpent(notary_, unit_, 7, "new"));
+        EXPECT_FALSE(storage->MarkTokenSpent(notary_, unit_, 7, "key 0"));
+    }
+
+    auto storage = open();
+
+    ASSERT_TRUE(storage);
+    EXPECT_TRUE(spent(storage, 7, "key 0"));
+    EXPECT_TRUE(spent(storage, 7, "key " + std::to_string(count - 1)));
+    EXPECT_TRUE(spent(storage, 7, "new"));
+}
+}  // namespace
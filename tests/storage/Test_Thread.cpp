@@ -0,0 +1,278 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "internal/api/storage/Storage.hpp"
+#include "storage/StorageConfig.hpp"
+#include "util/LMDB.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+using Storage = std::unique_ptr<ot::api::storage::StorageInternal>;
+
+// Matches the segment size used by storage::Thread
+constexpr auto segment_size_{64};
+
+class Test_Thread : public ::testing::Test
+{
+public:
+    const ot::api::client::internal::Manager& api_;
+    const fs::path folder_;
+    const ot::OTFlag running_;
+    const std::string nym_;
+    const std::string thread_;
+    ot::StorageConfig config_;
+    std::unique_ptr<const ot::api::Settings> settings_;
+    std::vector<std::string> items_;
+
+    auto add(const Storage& storage, const std::size_t count) -> void
+    {
+        for (std::size_t i{0}; i < count; ++i) {
+            const auto id = ot::Identifier::Random()->str();
+
+            ASSERT_TRUE(storage->Store(
+                nym_,
+                thread_,
+                id,
+                items_.size(),
+                "",
+                "",
+                ot::StorageBox::INCOMINGCHEQUE));
+
+            items_.emplace_back(id);
+        }
+    }
+
+    auto check(const Storage& storage) const -> void
+    {
+        auto thread = std::shared_ptr<ot::proto::StorageThread>{};
+
+        ASSERT_TRUE(storage->Load(nym_, thread_, thread));
+        ASSERT_TRUE(thread);
+        EXPECT_EQ(thread->id(), thread_);
+        ASSERT_EQ(thread->item_size(), items_.size());
+
+        for (auto i{0}; i < thread->item_size(); ++i) {
+            EXPECT_EQ(thread->item(i).id(), items_.at(i));
+        }
+    }
+
+    auto open() -> Storage
+    {
+        auto encrypted = ot::String::Factory();
+        auto output = Storage{ot::Factory::Storage(
+            running_,
+            api_.Crypto(),
+            *settings_,
+            api_.Legacy(),
+            folder_.string(),
+            ot::String::Factory(OT_STORAGE_PRIMARY_PLUGIN_LMDB),
+            ot::String::Factory(),
+            std::chrono::seconds(0),
+            encrypted,
+            config_)};
+
+        if (output) { output->start(); }
+
+        return output;
+    }
+
+    // Replaces the segment index of the thread with a single legacy
+    // proto::StorageThread holding every item. The storage instance must be
+    // closed.
+    auto write_legacy() const -> bool
+    {
+        enum Table { Control = 0, A = 1, B = 2 };
+
+        const auto names = ot::storage::lmdb::TableNames{
+            {Control, config_.lmdb_control_table_},
+            {A, config_.lmdb_primary_bucket_},
+            {B, config_.lmdb_secondary_bucket_},
+        };
+        const auto db = ot::storage::lmdb::LMDB{
+            names, config_.path_, {{Control, 0}, {A, 0}, {B, 0}}};
+        auto objects = std::map<std::string, std::string>{};
+        db.Read(
+            B,
+            [&](const auto key, const auto value) -> bool {
+                objects.emplace(key, value);
+
+                return true;
+            },
+            ot::storage::lmdb::LMDB::Dir::Forward);
+
+        for (const auto& [key, value] : objects) {
+            auto index = ot::proto::StorageNymList{};
+
+            if (false == index.ParseFromString(value)) { continue; }
+            if (0 == index.nym_size()) { continue; }
+            if (false == ot::proto::Validate(index, ot::SILENT)) { continue; }
+
+            auto legacy = ot::proto::StorageThread{};
+
+            for (const auto& entry : index.nym()) {
+                const auto it = objects.find(entry.hash());
+
+                if (objects.end() == it) { break; }
+
+                auto segment = ot::proto::StorageThread{};
+
+                if (false == segment.ParseFromString(it->second)) { break; }
+                if (segment.id() != thread_) { break; }
+
+                if (0 == legacy.item_size()) {
+                    legacy.set_version(segment.version());
+                    legacy.set_id(segment.id());
+
+                    for (const auto& participant : segment.participant()) {
+                        legacy.add_participant(participant);
+                    }
+                }
+
+                for (const auto& item : segment.item()) {
+                    *legacy.add_item() = item;
+                }
+            }
+
+            if (static_cast<std::size_t>(legacy.item_size()) != items_.size()) {
+                continue;
+            }
+
+            return db.Store(B, key, legacy.SerializeAsString()).first;
+        }
+
+        return false;
+    }
+
+    Test_Thread()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::test_args_, 0)))
+        , folder_(
+              fs::temp_directory_path() /
+              fs::unique_path("opentxs-thread-%%%%-%%%%-%%%%-%%%%"))
+        , running_(ot::Flag::Factory(true))
+        , nym_(ot::Identifier::Random()->str())
+        , thread_(ot::Identifier::Random()->str())
+        , config_()
+        , settings_()
+        , items_()
+    {
+        fs::create_directories(folder_);
+        settings_.reset(ot::Factory::Settings(
+            api_.Legacy(),
+            ot::String::Factory((folder_ / "storage.cfg").string())));
+    }
+
+    ~Test_Thread() { fs::remove_all(folder_); }
+};
+
+TEST_F(Test_Thread, round_trip)
+{
+    {
+        auto storage = open();
+
+        ASSERT_TRUE(storage);
+        ASSERT_TRUE(storage->CreateThread(nym_, thread_, {nym_}));
+
+        add(storage, 2 * segment_size_ + 3);
+
+        EXPECT_EQ(storage->ThreadSegments(nym_, thread_), 3);
+
+        check(storage);
+    }
+
+    auto storage = open();
+
+    ASSERT_TRUE(storage);
+    EXPECT_EQ(storage->ThreadSegments(nym_, thread_), 3);
+
+    check(storage);
+
+    // Reading one segment returns only its items
+    auto segment = std::shared_ptr<ot::proto::StorageThread>{};
+
+    ASSERT_TRUE(storage->Load(nym_, thread_, 1, 1, segment));
+    ASSERT_TRUE(segment);
+    ASSERT_EQ(segment->item_size(), segment_size_);
+    EXPECT_EQ(segment->item(0).id(), items_.at(segment_size_));
+}
+
+TEST_F(Test_Thread, prune_empty_tail)
+{
+    auto storage = open();
+
+    ASSERT_TRUE(storage);
+    ASSERT_TRUE(storage->CreateThread(nym_, thread_, {nym_}));
+
+    add(storage, segment_size_ + 2);
+
+    EXPECT_EQ(storage->ThreadSegments(nym_, thread_), 2);
+
+    const auto nym = ot::identifier::Nym::Factory(nym_);
+    const auto thread = ot::Identifier::Factory(thread_);
+
+    for (auto i{0}; i < 2; ++i) {
+        ASSERT_TRUE(storage->RemoveThreadItem(nym, thread, items_.back()));
+
+        items_.pop_back();
+    }
+
+    EXPECT_EQ(storage->ThreadSegments(nym_, thread_), 1);
+
+    check(storage);
+
+    // The next item starts a new tail segment again
+    add(storage, 1);
+
+    EXPECT_EQ(storage->ThreadSegments(nym_, thread_), 2);
+
+    check(storage);
+}
+
+TEST_F(Test_Thread, load_legacy)
+{
+    {
+        auto storage = open();
+
+        ASSERT_TRUE(storage);
+        ASSERT_TRUE(storage->CreateThread(nym_, thread_, {nym_}));
+
+        add(storage, segment_size_ + 10);
+    }
+
+    ASSERT_TRUE(write_legacy());
+
+    {
+        auto storage = open();
+
+        ASSERT_TRUE(storage);
+
+        // A legacy thread is split into segments when it is opened
+        EXPECT_EQ(storage->ThreadSegments(nym_, thread_), 2);
+
+        check(storage);
+        add(storage, 1);
+        check(storage);
+    }
+
+    auto storage = open();
+
+    ASSERT_TRUE(storage);
+    EXPECT_EQ(storage->ThreadSegments(nym_, thread_), 2);
+
+    check(storage);
+}
+}  // namespace
@@ -0,0 +1,179 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "OTTestEnvironment.hpp"
+
+#include "storage/Plugin.hpp"
+#include "storage/StorageConfig.hpp"
+
+#include <chrono>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Records the order of writes and holds every write until the gate opens
+class TestDriver final : public ot::Plugin
+{
+public:
+    mutable std::mutex lock_{};
+    mutable std::vector<std::string> stored_{};
+
+    bool EmptyBucket(const bool) const final { return true; }
+    bool LoadFromBucket(const std::string&, std::string&, const bool) const
+        final
+    {
+        return false;
+    }
+    std::string LoadRoot() const final { return {}; }
+    bool StoreRoot(const bool, const std::string&) const final { return true; }
+
+    void Cleanup() final { stop_writers(); }
+
+    TestDriver(
+        const ot::api::storage::Storage& storage,
+        const ot::StorageConfig& config,
+        const ot::Flag& bucket,
+        std::shared_future<void> gate)
+        : ot::Plugin(storage, config, no_digest_, no_random_, bucket)
+        , gate_(gate)
+    {
+    }
+
+    ~TestDriver() final { stop_writers(); }
+
+private:
+    static const ot::Digest no_digest_;
+    static const ot::Random no_random_;
+
+    std::shared_future<void> gate_;
+
+    void store(
+        const bool,
+        const std::string& key,
+        const std::string&,
+        const bool,
+        std::promise<bool>* promise) const final
+    {
+        gate_.wait();
+
+        {
+            ot::Lock lock(lock_);
+            stored_.emplace_back(key);
+        }
+
+        promise->set_value(true);
+    }
+};
+
+const ot::Digest TestDriver::no_digest_{};
+const ot::Random TestDriver::no_random_{};
+
+class Test_WriteQueue : public ::testing::Test
+{
+public:
+    const ot::api::client::internal::Manager& api_;
+    const ot::OTFlag bucket_;
+    ot::StorageConfig config_;
+    std::promise<void> open_;
+    std::deque<std::promise<bool>> promises_;
+    std::vector<std::future<bool>> futures_;
+
+    auto store(const TestDriver& driver, const std::string& key) -> void
+    {
+        auto& promise = promises_.emplace_back();
+        futures_.emplace_back(promise.get_future());
+        driver.Store(false, key, "value", false, promise);
+    }
+
+    Test_WriteQueue()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::test_args_, 0)))
+        , bucket_(ot::Flag::Factory(false))
+        , config_()
+        , open_()
+        , promises_()
+        , futures_()
+    {
+    }
+};
+
+TEST_F(Test_WriteQueue, single_writer_preserves_order)
+{
+    config_.storage_writer_threads_ = 1;
+    config_.storage_write_queue_limit_ = 4;
+    open_.set_value();
+    TestDriver driver{api_.Storage(), config_, bucket_, open_.get_future()};
+
+    for (auto i{0}; i < 10; ++i) { store(driver, std::to_string(i)); }
+
+    for (auto& future : futures_) { EXPECT_TRUE(future.get()); }
+
+    ot::Lock lock(driver.lock_);
+
+    ASSERT_EQ(driver.stored_.size(), 10);
+
+    for (auto i{0}; i < 10; ++i) {
+        EXPECT_EQ(driver.stored_.at(i), std::to_string(i));
+    }
+}
+
+TEST_F(Test_WriteQueue, full_queue_blocks_caller)
+{
+    config_.storage_writer_threads_ = 1;
+    config_.storage_write_queue_limit_ = 2;
+    TestDriver driver{api_.Storage(), config_, bucket_, open_.get_future()};
+
+    // One write is held by the writer thread and two fill the queue, so the
+    // fourth can not be queued until the writer makes progress
+    auto caller = std::async(std::launch::async, [&] {
+        for (auto i{0}; i < 4; ++i) { store(driver, std::to_string(i)); }
+    });
+
+    EXPECT_EQ(
+        caller.wait_for(std::chrono::milliseconds(500)),
+        std::future_status::timeout);
+    EXPECT_EQ(driver.QueueDepth(), 2);
+
+    open_.set_value();
+    caller.get();
+
+    for (auto& future : futures_) { EXPECT_TRUE(future.get()); }
+
+    EXPECT_EQ(driver.QueueDepth(), 0);
+}
+
+TEST_F(Test_WriteQueue, cleanup_finishes_queued_writes)
+{
+    config_.storage_writer_threads_ = 2;
+    open_.set_value();
+    TestDriver driver{api_.Storage(), config_, bucket_, open_.get_future()};
+
+    for (auto i{0}; i < 20; ++i) { store(driver, std::to_string(i)); }
+
+    driver.Cleanup();
+
+    EXPECT_EQ(driver.QueueDepth(), 0);
+
+    for (auto& future : futures_) {
+        ASSERT_EQ(
+            future.wait_for(std::chrono::seconds(0)),
+            std::future_status::ready);
+        EXPECT_TRUE(future.get());
+    }
+
+    // Writes submitted after the writers stop are performed by the caller
+    futures_.clear();
+    store(driver, "late");
+
+    ASSERT_EQ(
+        futures_.at(0).wait_for(std::chrono::seconds(0)),
+        std::future_status::ready);
+    EXPECT_TRUE(futures_.at(0).get());
+}
+}  // namespace